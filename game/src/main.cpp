@@ -75,7 +75,7 @@ void InitLogging() {
 #include <Windows.h>
 #endif
 
-int main() {
+int main(int argc, char **argv) {
 #ifndef ENABLE_DEBUG_SYSTEM
     FreeConsole();
 #endif
@@ -84,7 +84,7 @@ int main() {
 
     Application app;
 
-    if (app.Init()) {
+    if (app.Init(argc, argv)) {
         app.PushState<GameState>();
         app.Run();
     }
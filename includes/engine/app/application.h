@@ -16,6 +16,7 @@
 #include <app/monitor_manager.h>
 #include <app/system_manager.h>
 #include <app/engine_loop.h>
+#include <utils/thread_pool.h>
 
 class Application
 {
@@ -23,8 +24,9 @@ public:
     Application();
     ~Application();
 
-    bool Init();
+    bool Init(int argc = 0, char **argv = nullptr);
     void Run();
+    void RequestExit();
 
     template <typename T, typename... Args>
     void PushState(Args &&...args)
@@ -32,6 +34,13 @@ public:
         m_StateMachine.PushState(std::make_unique<T>(std::forward<Args>(args)...));
     }
 
+    // Shown over the current state while SceneManager::QueueLoadScene streams a scene in
+    template <typename T>
+    void SetLoadingState()
+    {
+        m_StateMachine.SetLoadingState([]() { return std::make_unique<T>(); });
+    }
+
     Scene &GetScene() { return scene; }
     PhysicsWorld &GetPhysicsWorld() { return *physicsWorld; }
     ResourceManager &GetResourceManager() { return *resourceManager; }
@@ -42,12 +51,14 @@ public:
     StateMachine& GetStateMachine() { return m_StateMachine; }
     SystemManager& GetSystemManager() { return *systemManager; }
     EngineLoop& GetEngineLoop() { return *engineLoop; }
+    ThreadPool& GetThreadPool() { return *threadPool; }
     
     KeyboardManager &GetKeyboard() const { return appHandler->GetKeyboard(); }
     MouseManager &GetMouse() const { return appHandler->GetMouse(); }
     InputManager &GetInputManager() const { return appHandler->GetInputManager(); }
 
     GLFWwindow *GetWindow() const { return monitorManager.GetWindow(); }
+    bool IsHeadless() const { return monitorManager.IsHeadless(); }
     int GetWidth() const { return monitorManager.GetWidth(); }
     int GetHeight() const { return monitorManager.GetHeight(); }
 
@@ -78,6 +89,7 @@ public:
 
 private:
     MonitorManager monitorManager;
+    std::unique_ptr<ThreadPool> threadPool;
     std::unique_ptr<AppHandler> appHandler;
     std::unique_ptr<PhysicsWorld> physicsWorld;
     std::unique_ptr<ResourceManager> resourceManager;
@@ -35,6 +35,8 @@ struct AppConfig
     int antialiasing = 1; // 0: None, 1: FXAA, 2: TAA
 
     int physicsMode = 1; // 0: Fast, 1: Balanced, 2: Accurate
+
+    bool headless = false; // Null render device, no window (also --headless)
 };
 
 class ConfigLoader
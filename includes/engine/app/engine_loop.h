@@ -1,6 +1,7 @@
 #pragma once
 
 #include <GLFW/glfw3.h>
+#include <cstdint>
 
 class Application;
 class SystemManager;
@@ -13,6 +14,9 @@ public:
     ~EngineLoop();
 
     void Run();
+    void RequestExit() { m_ExitRequested = true; }
+    void SetMaxFrames(uint64_t maxFrames) { m_MaxFrames = maxFrames; }
+    uint64_t GetFrameIndex() const { return m_FrameIndex; }
 
     void SetPhysicsStep(float step);
     void SetTimeScale(float scale);
@@ -27,6 +31,8 @@ private:
     void FixedUpdate();
     void Update();
     void Render();
+    bool ShouldExit() const;
+    double GetTime() const;
 
     Application* m_App;
 
@@ -38,4 +44,8 @@ private:
 
     float m_TimeScale = 1.0f;
     bool m_IsPaused = false;
+
+    bool m_ExitRequested = false;
+    uint64_t m_MaxFrames = 0; // 0 = unlimited
+    uint64_t m_FrameIndex = 0;
 };
@@ -20,6 +20,8 @@ public:
     ~MonitorManager();
 
     bool Init();
+    void SetHeadless(bool headless) { m_Headless = headless; }
+    bool IsHeadless() const { return m_Headless; }
     void SetWindowConfiguration(int width, int height, WindowMode mode = WindowMode::WINDOWED, int monitorIndex = 0, int refreshRate = 0);
     void SetVsync(bool enable);
     void SetFrameRateLimit(int limit);
@@ -38,6 +40,7 @@ public:
 
 private:
     GLFWwindow* m_Window = nullptr;
+    bool m_Headless = false;
     
     std::string m_Title = "Axis Engine";
     int m_Width = 800;
@@ -3,6 +3,9 @@
 #include <ecs/system.h>
 #include <graphic/core/post_process_pipeline.h>
 #include <memory>
+#include <vector>
+#include <chrono>
+#include <utils/profiler.h>
 
 #ifdef ENABLE_DEBUG_SYSTEM
 #include <debug/debug_system.h>
@@ -15,6 +18,12 @@ class SoundManager;
 class Application;
 class MouseManager;
 
+struct SystemTiming
+{
+    const char *name;
+    double milliseconds;
+};
+
 class SystemManager
 {
 public:
@@ -25,6 +34,8 @@ public:
     void ShutdownSystems();
 
     void FixedUpdateSystems(Scene &scene, PhysicsWorld &phys, float fixedDt);
+    // alpha: fraction of a fixed step left in the accumulator; only pipelined physics uses it
+    void InterpolatePhysics(float alpha);
     void UpdateSystems(Scene &scene, float deltaTime, float realDeltaTime,
                        Application *app, ResourceManager &res,
                        SoundManager &sound, MouseManager &mouse);
@@ -38,6 +49,7 @@ public:
     DebugSystem *GetDebugSystem() { return debugSystem.get(); }
 #endif
 
+    TransformSystem &GetTransformSystem() { return transformSystem; }
     RenderSystem &GetRenderSystem() { return renderSystem; }
     UIRenderSystem &GetUIRenderSystem() { return uiRenderSystem; }
     SkyboxRenderSystem &GetSkyboxRenderSystem() { return skyboxRenderSystem; }
@@ -50,7 +62,35 @@ public:
     VideoSystem &GetVideoSystem() { return videoSystem; }
     PostProcessPipeline &GetPostProcess() { return postProcess; }
 
+    // Per-system wall time, appended in execution order until ClearTimings() (used by axis_bench)
+    void SetTimingEnabled(bool enabled) { m_TimingEnabled = enabled; }
+    bool IsTimingEnabled() const { return m_TimingEnabled; }
+    const std::vector<SystemTiming> &GetTimings() const { return m_Timings; }
+    void ClearTimings() { m_Timings.clear(); }
+
 private:
+    template <typename Fn>
+    void RunTimed(const char *name, Fn &&fn)
+    {
+#if AXIS_PROFILER_ENABLED
+        Profiler::ScopedZone zone(name);
+#endif
+        if (!m_TimingEnabled)
+        {
+            fn();
+            return;
+        }
+
+        auto start = std::chrono::high_resolution_clock::now();
+        fn();
+        auto end = std::chrono::high_resolution_clock::now();
+        m_Timings.push_back({name, std::chrono::duration<double, std::milli>(end - start).count()});
+    }
+
+    bool m_TimingEnabled = false;
+    std::vector<SystemTiming> m_Timings;
+
+    TransformSystem transformSystem;
     PhysicsSystem physicsSystem;
     RenderSystem renderSystem;
     AnimationSystem animationSystem;
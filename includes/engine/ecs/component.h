@@ -10,10 +10,13 @@
 #include <graphic/geometry/model.h>
 #include <graphic/renderer/ui_model.h>
 #include <graphic/geometry/animator.h>
+#include <graphic/geometry/baked_animation.h>
 #include <graphic/renderer/font.h>
 #include <graphic/renderer/skybox.h>
 #include <graphic/renderer/particle_emitter.h>
 
+class PhysicsWorld;
+
 struct InfoComponent
 {
     std::string name = "Entity";
@@ -31,15 +34,22 @@ struct TransformComponent
 
     glm::mat4 GetLocalModelMatrix() const;
 
+    // Resolves the world matrix now, walking up the parents; use outside the frame pipeline
     glm::mat4 GetWorldModelMatrix(entt::registry &registry) const;
+    // World matrix resolved by the last TransformSystem pass (or GetWorldModelMatrix call)
+    const glm::mat4 &GetWorldMatrix() const { return m_WorldMatrix; }
 
     void SetParent(entt::entity thisEntity, entt::entity newParent, entt::registry &registry, bool keepWorldTransform = false);
     void AddChild(entt::entity thisEntity, entt::entity child, entt::registry &registry, bool keepWorldTransform = false);
     void RemoveChild(entt::entity child);
     bool HasParent() const { return parent != entt::null; }
     uint32_t GetVersion() const { return m_Version; }
+    // Bumped whenever the cached world matrix is recomputed
+    uint32_t GetWorldVersion() const { return m_WorldVersion; }
 
 private:
+    friend class TransformSystem;
+
     mutable glm::mat4 m_LocalMatrix = glm::mat4(1.0f);
     mutable glm::mat4 m_WorldMatrix = glm::mat4(1.0f);
 
@@ -51,6 +61,7 @@ private:
     mutable uint32_t m_LastParentVersion = 0;
     mutable entt::entity m_LastParent = entt::null;
     mutable uint32_t m_LastLocalVersion = 0;
+    mutable uint32_t m_WorldVersion = 0;
 };
 
 struct MeshRendererComponent
@@ -61,6 +72,13 @@ struct MeshRendererComponent
     glm::vec4 color = glm::vec4(1.0f);
 };
 
+// World-space AABB of a renderer's model; kept current by the RenderQueue when the transform changes
+struct WorldBoundsComponent
+{
+    glm::vec3 min = glm::vec3(0.0f);
+    glm::vec3 max = glm::vec3(0.0f);
+};
+
 enum class MaterialType
 {
     PHONG,
@@ -90,6 +108,40 @@ struct MaterialComponent
     glm::vec2 uvOffset = glm::vec2(0.0f);
 };
 
+// Setter calls made while a pipelined physics step is running; applied at the next sync point
+struct RigidBodyPendingWrites
+{
+    enum : uint8_t
+    {
+        LINEAR_VELOCITY = 1 << 0,
+        ANGULAR_VELOCITY = 1 << 1,
+        RESTITUTION = 1 << 2,
+        FRICTION = 1 << 3,
+        LINEAR_FACTOR = 1 << 4,
+        ANGULAR_FACTOR = 1 << 5
+    };
+
+    uint8_t mask = 0;
+    glm::vec3 linearVelocity = glm::vec3(0.0f);
+    glm::vec3 angularVelocity = glm::vec3(0.0f);
+    glm::vec3 linearFactor = glm::vec3(1.0f);
+    glm::vec3 angularFactor = glm::vec3(1.0f);
+    float restitution = 0.0f;
+    float friction = 0.0f;
+};
+
+// Last two simulated poses of a dynamic body in world space; pipelined physics renders a blend of them
+struct RigidBodySnapshot
+{
+    glm::vec3 previousPosition = glm::vec3(0.0f);
+    glm::quat previousRotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+    glm::vec3 currentPosition = glm::vec3(0.0f);
+    glm::quat currentRotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+    bool valid = false;
+    bool moving = false;  // moved by the last captured step
+    bool tracked = false; // listed by PhysicsTransformSync as blending
+};
+
 struct RigidBodyComponent
 {
     btRigidBody *body = nullptr;
@@ -102,32 +154,71 @@ struct RigidBodyComponent
     glm::vec3 linearFactor = glm::vec3(1.0f);
     glm::vec3 angularFactor = glm::vec3(1.0f);
 
+    RigidBodySnapshot snapshot;
+    RigidBodyPendingWrites pending;
+
+    // World the body was added to; set by PhysicsLoader::CreateRigidBody
+    const PhysicsWorld *world = nullptr;
+
+    // True while the world's pipelined step owns the body; setters then queue into pending instead
+    bool IsDeferringWrites() const;
+
     void SetRestitution(float restitution)
     {
+        if (IsDeferringWrites())
+        {
+            pending.restitution = restitution;
+            pending.mask |= RigidBodyPendingWrites::RESTITUTION;
+            return;
+        }
         if (body)
             body->setRestitution(restitution);
     }
 
     void SetFriction(float friction)
     {
+        if (IsDeferringWrites())
+        {
+            pending.friction = friction;
+            pending.mask |= RigidBodyPendingWrites::FRICTION;
+            return;
+        }
         if (body)
             body->setFriction(friction);
     }
 
     void SetLinearFactor(const glm::vec3 &factor)
     {
+        if (IsDeferringWrites())
+        {
+            pending.linearFactor = factor;
+            pending.mask |= RigidBodyPendingWrites::LINEAR_FACTOR;
+            return;
+        }
         if (body)
             body->setLinearFactor(btVector3(factor.x, factor.y, factor.z));
     }
 
     void SetAngularFactor(const glm::vec3 &factor)
     {
+        if (IsDeferringWrites())
+        {
+            pending.angularFactor = factor;
+            pending.mask |= RigidBodyPendingWrites::ANGULAR_FACTOR;
+            return;
+        }
         if (body)
             body->setAngularFactor(btVector3(factor.x, factor.y, factor.z));
     }
 
     void SetLinearVelocity(const glm::vec3 &vel)
     {
+        if (IsDeferringWrites())
+        {
+            pending.linearVelocity = vel;
+            pending.mask |= RigidBodyPendingWrites::LINEAR_VELOCITY;
+            return;
+        }
         if (body)
         {
             body->setLinearVelocity(btVector3(vel.x, vel.y, vel.z));
@@ -137,17 +228,70 @@ struct RigidBodyComponent
 
     void SetAngularVelocity(const glm::vec3 &vel)
     {
+        if (IsDeferringWrites())
+        {
+            pending.angularVelocity = vel;
+            pending.mask |= RigidBodyPendingWrites::ANGULAR_VELOCITY;
+            return;
+        }
         if (body)
         {
             body->setAngularVelocity(btVector3(vel.x, vel.y, vel.z));
             body->activate(true);
         }
     }
+
+    // Applies queued setter calls in the order a script would expect; call once the step is waited for
+    void FlushPendingWrites()
+    {
+        uint8_t mask = pending.mask;
+        pending.mask = 0;
+        if (mask & RigidBodyPendingWrites::RESTITUTION)
+            SetRestitution(pending.restitution);
+        if (mask & RigidBodyPendingWrites::FRICTION)
+            SetFriction(pending.friction);
+        if (mask & RigidBodyPendingWrites::LINEAR_FACTOR)
+            SetLinearFactor(pending.linearFactor);
+        if (mask & RigidBodyPendingWrites::ANGULAR_FACTOR)
+            SetAngularFactor(pending.angularFactor);
+        if (mask & RigidBodyPendingWrites::LINEAR_VELOCITY)
+            SetLinearVelocity(pending.linearVelocity);
+        if (mask & RigidBodyPendingWrites::ANGULAR_VELOCITY)
+            SetAngularVelocity(pending.angularVelocity);
+    }
+};
+
+// Update frequency picked by AnimationSystem: every frame, every 2nd, every 4th, or not at all
+enum class AnimationLod : uint8_t
+{
+    Full = 0,
+    Half,
+    Quarter,
+    Frozen,
+    Count
 };
 
 struct AnimationComponent
 {
     Animator *animator = nullptr;
+
+    // Written by RenderSystem whenever it draws the entity; read by the animation LOD next frame
+    uint32_t visibleFrame = 0;
+    float screenSize = 1.0f; // projected bounds height / viewport height
+
+    // LOD state owned by AnimationSystem
+    AnimationLod lod = AnimationLod::Full;
+    float pendingDt = 0.0f; // time not yet given to the animator while skipping frames
+};
+
+// Crowd playback from a BakedAnimation: no skeleton is evaluated on the CPU and the entity stays
+// in the instanced draw path
+struct BakedAnimationComponent
+{
+    BakedAnimation *baked = nullptr;
+    int clip = 0;
+    float time = 0.0f; // seconds
+    float speed = 1.0f;
 };
 
 struct CameraComponent
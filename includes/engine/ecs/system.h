@@ -1,5 +1,6 @@
 #pragma once
 
+#include <ecs/systems/transform_system.h>
 #include <ecs/systems/physics_system.h>
 #include <ecs/systems/animation_system.h>
 #include <ecs/systems/render_system.h>
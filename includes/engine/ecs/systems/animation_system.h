@@ -2,6 +2,26 @@
 
 #include <scene/scene.h>
 
+struct AnimationLodSettings
+{
+    bool enabled = true;
+    // Projected bounds height (fraction of the viewport) needed for Full / Half rate; smaller
+    // characters update every 4th frame
+    float fullScreenSize = 0.15f;
+    float halfScreenSize = 0.05f;
+    // Characters the camera did not draw last frame stop updating; off = they run at Quarter
+    bool freezeHidden = true;
+    // At Quarter, nodes deeper than this keep their bind pose and rotations use nlerp
+    int quarterMaxDepth = 6;
+};
+
+struct AnimationStats
+{
+    int updated = 0;
+    int skipped = 0;
+    int lodCounts[static_cast<int>(AnimationLod::Count)] = {};
+};
+
 class AnimationSystem
 {
 public:
@@ -9,7 +29,19 @@ public:
     void SetEnabled(bool enable) { m_Enabled = enable; }
     bool IsEnabled() const { return m_Enabled; }
 
+    void SetLodSettings(const AnimationLodSettings &settings) { m_Lod = settings; }
+    const AnimationLodSettings &GetLodSettings() const { return m_Lod; }
+    void SetLodEnabled(bool enable) { m_Lod.enabled = enable; }
+
+    // Counts from the last Update
+    const AnimationStats &GetStats() const { return m_Stats; }
+
 private:
+    AnimationLod SelectLod(const AnimationComponent &anim, uint32_t visibilityFrame) const;
+
     bool m_Enabled = true;
+    AnimationLodSettings m_Lod;
+    AnimationStats m_Stats;
+    uint32_t m_FrameIndex = 0;
     std::vector<entt::entity> m_Entities;
 };
@@ -5,13 +5,13 @@
 #include <unordered_map>
 #include <utility>
 #include <entt/entt.hpp>
-#include <engine/ecs/cached_query.h>
+#include <physic/physics_transform_sync.h>
+#include <physic/physics_collision_dispatcher.h>
 #include <future>
 
 class PhysicsWorld;
 class Shader;
 class PhysicsTransformSync;
-class PhysicsCollisionDispatcher;
 
 class PhysicsSystem
 {
@@ -25,17 +25,25 @@ public:
     bool IsEnabled() const { return m_Enabled; }
     void SetAsyncPhysics(bool async) { m_AsyncPhysics = async; }
 
+    // Pipelined: Update only syncs with the step started last frame, then starts the next one, which
+    // runs while the rest of the frame renders. Transforms then show the last two finished steps
+    // blended by Interpolate, and RigidBodyComponent setters are deferred to the next Update.
+    void SetPipelined(bool pipelined) { m_Pipelined = pipelined; }
+    bool IsPipelined() const { return m_Pipelined; }
+    void Interpolate(float alpha);
+
+    // Bodies synced by the last Update
+    const PhysicsSyncStats &GetSyncStats() const { return m_SyncStats; }
+
+    // Contact events of the last step, in the order scripts received them
+    const std::vector<CollisionEvent> &GetCollisionEvents() const;
+
 private:
-    using CollisionPair = std::pair<entt::entity, entt::entity>;
-    
-    struct CollisionPairHash {
-        std::size_t operator()(const CollisionPair& p) const {
-            return std::hash<uint32_t>()((uint32_t)p.first) ^ 
-                   (std::hash<uint32_t>()((uint32_t)p.second) << 1);
-        }
-    };
-    
     void WaitAsyncPhysics();
+    void UpdatePipelined(Scene &scene, PhysicsWorld &physicsWorld, float dt);
+    void EndPipelinedStep(Scene &scene, PhysicsWorld &physicsWorld);
+    void FlushPendingWrites(Scene &scene);
+    void DispatchCollisions(Scene &scene, PhysicsWorld &physicsWorld);
 
 private:
     std::unique_ptr<PhysicsTransformSync> m_transformSync;
@@ -43,6 +51,8 @@ private:
 
     std::future<void> m_physicsFuture;
     bool m_AsyncPhysics = true;
+    bool m_Pipelined = false;
+    PhysicsSyncStats m_SyncStats;
     bool m_Enabled = true;
 
     mutable entt::entity m_cachedPrimaryCamera = entt::null;
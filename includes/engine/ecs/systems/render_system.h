@@ -8,9 +8,15 @@
 #include <ecs/component.h>
 #include <graphic/renderer/shadow_renderer.h>
 #include <graphic/renderer/light_renderer.h>
+#include <graphic/renderer/render_queue.h>
+#include <graphic/core/gpu_ring_buffer.h>
+#include <graphic/core/uniform_buffer.h>
+#include <graphic/geometry/mesh_arena.h>
+#include <graphic/renderer/indirect_draw.h>
 
 class ResourceManager;
 class Shader;
+class TransformSystem;
 
 enum class AntiAliasingMode
 {
@@ -27,6 +33,9 @@ public:
     void InitShadows(ResourceManager &res);
     void Shutdown();
     void RenderShadows(Scene &scene);
+
+    // Source of moved entities for the render queue; without one every item is checked each frame
+    void SetTransformSystem(TransformSystem *system) { m_TransformSystem = system; }
     void SetEnableShadows(bool enable) { m_ShadowRenderer.SetEnableShadows(enable); }
     void SetShadowMode(int mode) { m_ShadowRenderer.SetShadowMode(mode); }
     bool IsShadowsEnabled() const { return m_ShadowRenderer.IsShadowsEnabled(); }
@@ -42,7 +51,19 @@ public:
     bool IsEnabled() const { return m_Enabled; }
     void SetDebugNoTexture(bool enable) { m_DebugNoTexture = enable; }
     void SetInstanceBatching(bool enable) { m_InstanceBatchingEnabled = enable; }
+    // Opt-in: static meshes are drawn from a shared geometry arena with glMultiDrawElementsIndirect
+    // (needs GL 4.3; falls back to regular instancing otherwise)
+    void SetMultiDrawIndirect(bool enable) { m_MultiDrawIndirect = enable; }
+    bool IsMultiDrawIndirect() const { return m_MultiDrawIndirect; }
+    static bool IsMultiDrawIndirectSupported() { return GLAD_GL_VERSION_4_3 && glMultiDrawElementsIndirect; }
     void SetFrustumCulling(bool enable) { m_FrustumCullingEnabled = enable; }
+    // AABB-tree culling for camera and shadow passes; off = flat SIMD scan
+    void SetHierarchicalCulling(bool enable)
+    {
+        m_HierarchicalCulling = enable;
+        m_ShadowRenderer.SetHierarchicalCulling(enable);
+    }
+    bool IsHierarchicalCulling() const { return m_HierarchicalCulling; }
     
     void SetShadowProjectionSize(float size) { m_ShadowRenderer.SetShadowProjectionSize(size); }
     void SetShadowFrustumCulling(bool enable) { m_ShadowRenderer.SetShadowFrustumCulling(enable); }
@@ -57,10 +78,22 @@ public:
     const glm::mat4& GetCurrViewProj() const { return m_CurrViewProj; }
 
     StaticBatchManager &GetBatchManager() { return m_BatchManager; }
+    const RenderQueue &GetRenderQueue() const { return m_RenderQueue; }
     
-    void SetupMaterialUniforms(Shader *shader, entt::entity entity, Scene &scene);
+    void SetupMaterialUniforms(Shader *shader, entt::entity entity, Scene &scene, const glm::vec4 &tintColor = glm::vec4(1.0f));
 
 private:
+    // Updates the retained queue once per frame, from whichever pass runs first
+    void PrepareQueue(Scene &scene);
+
+    // Camera, light and shadow data shared by every shader this frame
+    void UploadFrameUniforms(const glm::mat4 &projection, const glm::mat4 &view, const glm::vec3 &viewPos, bool receiveShadows);
+    // Loose-uniform fallback for shaders that do not declare FrameData / ShadowData
+    void ApplyFrameUniforms(Shader *shader, const glm::mat4 &projection, const glm::mat4 &view, const glm::vec3 &viewPos, bool receiveShadows);
+    void UploadSkinningPalette(Shader *shader, const glm::mat4 *bones, int count);
+    // Sub-allocates data from the uniform ring and binds it to block
+    void BindUniformRange(UniformBlock block, const void *data, size_t size);
+
     ShadowRenderer m_ShadowRenderer;
     LightRenderer m_LightRenderer;
     StaticBatchManager m_BatchManager;
@@ -68,7 +101,9 @@ private:
 
     bool m_Enabled = true;
     bool m_InstanceBatchingEnabled = true;
+    bool m_MultiDrawIndirect = false;
     bool m_FrustumCullingEnabled = true;
+    bool m_HierarchicalCulling = true;
     bool m_DebugNoTexture = false;
     unsigned int m_WhiteTextureID = 0;
     float m_DistanceCullingSq = 0.0f;
@@ -80,11 +115,29 @@ private:
     glm::mat4 m_PrevViewProj = glm::mat4(1.0f);
     glm::mat4 m_CurrViewProj = glm::mat4(1.0f);
 
-    struct RenderItem
-    {
-        entt::entity entity;
-        TransformComponent *transform;
-        MeshRendererComponent *renderer;
-    };
-    std::vector<RenderItem> m_RenderQueue;
+    RenderQueue m_RenderQueue;
+    TransformSystem *m_TransformSystem = nullptr;
+    bool m_QueuePrepared = false;
+    VisibilityBits m_CameraVisibility;
+    std::vector<const RenderQueueItem *> m_VisibleItems;
+
+    // Texture unit of the baked bone texture; mesh textures start at 0, shadow maps use 10-15
+    static constexpr int BAKED_BONES_UNIT = 9;
+
+    // 4 MB per frame = 65536 instance matrices before the ring has to grow
+    static constexpr size_t INSTANCE_RING_BYTES_PER_FRAME = 4 * 1024 * 1024;
+    GpuRingBuffer m_InstanceRing;
+    std::vector<glm::mat4> m_InstanceBatch;
+
+    UniformBuffer m_FrameUniforms;
+    UniformBuffer m_ShadowUniforms;
+    // Material blocks and skinning palettes; 1 MB per frame = ~150 animated draws before growing
+    static constexpr size_t UNIFORM_RING_BYTES_PER_FRAME = 1024 * 1024;
+    GpuRingBuffer m_UniformRing;
+    GPUSkinningData m_SkinningPalette = {};
+
+    static constexpr size_t MESH_ARENA_VERTICES = 1 << 20;
+    static constexpr size_t MESH_ARENA_INDICES = 3 << 20;
+    MeshArena m_MeshArena;
+    IndirectCommandBuilder m_IndirectBuilder;
 };
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+class Scene;
+
+// Resolves every TransformComponent's world matrix once per pass, parents before children.
+// Entities are kept in a flat array ordered by hierarchy depth; each depth level is a contiguous
+// range whose entries only depend on the previous level, so a level is processed in parallel.
+//
+// Results land in the flat world-matrix array and are written back into each component's cache,
+// so TransformComponent::GetWorldMatrix() is a plain load for every consumer afterwards.
+// The order is rebuilt when transforms are added/removed or a parent changes; cached results carry
+// over, so only new or relinked entities and their subtrees are recomputed by the next pass.
+//
+// Entities whose world matrix changed are collected across passes until ClearMoved(), so a consumer
+// that runs once per frame (the render queue) sees the fixed-step passes as well.
+class TransformSystem
+{
+public:
+    TransformSystem() = default;
+    ~TransformSystem();
+
+    TransformSystem(const TransformSystem &) = delete;
+    TransformSystem &operator=(const TransformSystem &) = delete;
+
+    void Update(Scene &scene);
+    void Detach();
+
+    void SetEnabled(bool enable) { m_Enabled = enable; }
+    bool IsEnabled() const { return m_Enabled; }
+
+    // Flat, depth-ordered results of the last pass
+    const std::vector<entt::entity> &GetEntities() const { return m_Entities; }
+    const std::vector<glm::mat4> &GetWorldMatrices() const { return m_WorldMatrices; }
+    size_t GetLevelCount() const { return m_LevelOffsets.empty() ? 0 : m_LevelOffsets.size() - 1; }
+    size_t GetLastDirtyCount() const { return m_LastDirtyCount; }
+
+    // Entities whose world matrix changed since the last ClearMoved(), each listed once; may hold destroyed entities
+    const std::vector<entt::entity> &GetMovedEntities() const { return m_Moved; }
+    void ClearMoved();
+
+    // Levels smaller than this run serially; parallel dispatch costs more than it saves
+    void SetParallelThreshold(size_t count) { m_ParallelThreshold = count; }
+
+private:
+    void Attach(entt::registry &registry);
+    void OnHierarchyChanged(entt::registry &, entt::entity) { m_NeedsRebuild = true; }
+    void Rebuild();
+    // Returns true when a parent changed mid-pass and the order must be rebuilt
+    bool RunPass();
+    bool ProcessSlot(uint32_t slot);
+    void CollectMoved();
+
+    entt::registry *m_Registry = nullptr;
+    bool m_Enabled = true;
+    bool m_NeedsRebuild = true;
+
+    std::vector<entt::entity> m_Entities;
+    std::vector<entt::entity> m_ParentEntities;
+    std::vector<int32_t> m_ParentSlots;
+    std::vector<glm::mat4> m_WorldMatrices;
+    std::vector<uint32_t> m_WorldVersions;
+    std::vector<uint8_t> m_Dirty;
+    std::vector<uint8_t> m_Forced; // new or relinked since the last rebuild; cleared once processed
+    std::vector<uint32_t> m_Slots;
+    std::vector<size_t> m_LevelOffsets;
+    std::vector<entt::entity> m_Moved;
+    std::vector<uint32_t> m_MovedPositions; // by entity index: position in m_Moved + 1, 0 when not listed
+
+    size_t m_ParallelThreshold = 256;
+    size_t m_LastDirtyCount = 0;
+};
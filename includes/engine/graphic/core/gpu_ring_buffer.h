@@ -0,0 +1,65 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <cstddef>
+#include <cstdint>
+
+// Frame-scoped streaming buffer for per-draw data (instance matrices). The buffer is split into
+// FRAME_COUNT regions; each frame writes into its own region, guarded by a fence so the CPU never
+// overwrites data the GPU is still reading.
+//
+// With GL 4.4 (glBufferStorage) the buffer is persistently and coherently mapped and writes are
+// plain memcpy. Older contexts fall back to one region that is orphaned every frame and filled
+// with glBufferSubData.
+//
+// Running out of space mid-frame grows the buffer. The new buffer often gets the old name back, so
+// users that cache what they bound should compare GetGeneration(), which changes on every grow.
+class GpuRingBuffer
+{
+public:
+    static constexpr uint32_t FRAME_COUNT = 3;
+    static constexpr size_t INVALID_OFFSET = SIZE_MAX;
+
+    GpuRingBuffer() = default;
+    ~GpuRingBuffer();
+
+    GpuRingBuffer(const GpuRingBuffer &) = delete;
+    GpuRingBuffer &operator=(const GpuRingBuffer &) = delete;
+
+    void Init(size_t bytesPerFrame);
+    void Shutdown();
+    bool IsInitialized() const { return m_Buffer != 0; }
+
+    // Waits for the region about to be reused and rewinds the write head
+    void BeginFrame();
+    // Fences the current region
+    void EndFrame();
+
+    // Copies size bytes and returns their offset in GetBuffer(), aligned to alignment
+    size_t Write(const void *data, size_t size, size_t alignment);
+
+    // Grows up front so the next writes, bytes in total, all land in the same buffer
+    void Reserve(size_t bytes);
+
+    GLuint GetBuffer() const { return m_Buffer; }
+    // Unique across all rings; changes whenever GetBuffer() is recreated
+    uint32_t GetGeneration() const { return m_Generation; }
+    bool IsPersistent() const { return m_Persistent; }
+    size_t GetCapacityPerFrame() const { return m_Capacity; }
+    size_t GetBytesThisFrame() const { return m_Head; }
+
+private:
+    void Create(size_t bytesPerFrame);
+    void Destroy();
+    void Grow(size_t required);
+
+    GLuint m_Buffer = 0;
+    uint32_t m_Generation = 0;
+    unsigned char *m_Mapped = nullptr;
+    bool m_Persistent = false;
+
+    size_t m_Capacity = 0;
+    size_t m_Head = 0;
+    uint32_t m_Region = 0;
+    GLsync m_Fences[FRAME_COUNT] = {};
+};
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+
+enum class RenderBackend
+{
+    OpenGL,
+    Null
+};
+
+struct RenderDeviceStats
+{
+    uint64_t drawCalls = 0;
+    uint64_t instancesDrawn = 0;
+    uint64_t indirectCommands = 0; // sub-draws inside multi-draw-indirect calls (each call is one draw call)
+    uint64_t stateChanges = 0;
+    uint64_t shaderBinds = 0;
+    uint64_t textureBinds = 0;
+    uint64_t framebufferBinds = 0;
+    uint64_t uniformUploads = 0;
+    uint64_t bufferUploads = 0;
+    uint64_t textureUploads = 0;
+    uint64_t bytesUploaded = 0;
+
+    void Reset() { *this = RenderDeviceStats(); }
+    void Accumulate(const RenderDeviceStats &other);
+};
+
+// Thin layer over the glad entry points. Every gl* call in the engine goes through a glad
+// function pointer, so the device swaps those pointers for recording wrappers (OpenGL backend)
+// or for host-side stubs that never touch a GPU (Null backend, used by --headless).
+class RenderDevice
+{
+public:
+    using LoadProc = void *(*)(const char *name);
+
+    static bool Init(RenderBackend backend, LoadProc loader = nullptr);
+    static void Shutdown();
+
+    static RenderBackend GetBackend();
+    static bool IsHeadless();
+    static bool IsInitialized();
+
+    static void EndFrame();
+
+    // Writes into persistently mapped buffers bypass the gl* entry points; report them here
+    static void RecordMappedWrite(uint64_t bytes);
+
+    static const RenderDeviceStats &GetCurrentStats();
+    static const RenderDeviceStats &GetFrameStats();
+    static const RenderDeviceStats &GetTotalStats();
+    static uint64_t GetFrameCount();
+    static void ResetStats();
+
+private:
+    static void InstallRecorders();
+};
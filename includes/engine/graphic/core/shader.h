@@ -2,6 +2,8 @@
 
 #include <glad/glad.h>
 #include <glm/glm.hpp>
+#include <graphic/core/uniform.h>
+#include <graphic/core/uniform_buffer.h>
 
 #include <string>
 #include <unordered_map>
@@ -35,7 +37,26 @@ public:
 
     int GetUniformLocation(const std::string &name) const;
 
+    // Compile-time hashed names, for uniforms set every draw
+    void setBool(UniformHandle handle, bool value) const;
+    void setInt(UniformHandle handle, int value) const;
+    void setFloat(UniformHandle handle, float value) const;
+    void setVec2(UniformHandle handle, const glm::vec2 &value) const;
+    void setVec3(UniformHandle handle, const glm::vec3 &value) const;
+    void setVec4(UniformHandle handle, const glm::vec4 &value) const;
+    void setMat4(UniformHandle handle, const glm::mat4 &mat) const;
+    // Uploads count matrices starting at an array element, e.g. "bones[0]"_uniform, in one call
+    void setMat4Array(UniformHandle handle, const glm::mat4 *mats, int count) const;
+
+    int GetUniformLocation(UniformHandle handle) const;
+
+    // Whether the program declares the block; shaders without it get loose uniforms instead
+    bool HasUniformBlock(UniformBlock block) const { return (uniformBlocks & (1u << static_cast<uint32_t>(block))) != 0; }
+
 private:
     void checkCompileErrors(GLuint shader, std::string type);
+    void bindUniformBlocks();
     mutable std::unordered_map<std::string, int> uniformLocations;
+    mutable std::unordered_map<uint64_t, int> handleLocations;
+    uint32_t uniformBlocks = 0;
 };
\ No newline at end of file
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Name of a loose shader uniform, hashed at compile time:
+//     shader.setMat4("model"_uniform, matrix);
+// Shader caches locations by hash, so setting a uniform never builds or hashes a string at runtime.
+class UniformHandle
+{
+public:
+    consteval UniformHandle(const char *name, size_t length)
+        : m_Name(name), m_Hash(Hash(name, length))
+    {
+    }
+
+    const char *GetName() const { return m_Name; }
+    uint64_t GetHash() const { return m_Hash; }
+
+private:
+    // FNV-1a
+    static constexpr uint64_t Hash(const char *text, size_t length)
+    {
+        uint64_t hash = 1469598103934665603ull;
+        for (size_t i = 0; i < length; ++i)
+        {
+            hash ^= static_cast<unsigned char>(text[i]);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    const char *m_Name;
+    uint64_t m_Hash;
+};
+
+consteval UniformHandle operator""_uniform(const char *name, size_t length)
+{
+    return UniformHandle(name, length);
+}
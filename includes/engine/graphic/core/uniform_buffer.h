@@ -0,0 +1,106 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+
+// Uniform blocks shared by the scene shaders. The enum value is the binding point; Shader binds
+// every block it finds by name when the program is linked.
+enum class UniformBlock : uint32_t
+{
+    Frame = 0,
+    Shadow = 1,
+    Material = 2,
+    Skinning = 3,
+    Count
+};
+
+inline constexpr const char *UNIFORM_BLOCK_NAMES[] = {"FrameData", "ShadowData", "MaterialData", "SkinningData"};
+static_assert(sizeof(UNIFORM_BLOCK_NAMES) / sizeof(UNIFORM_BLOCK_NAMES[0]) == static_cast<size_t>(UniformBlock::Count));
+
+// CPU mirrors of the std140 blocks; keep in sync with the declarations in src/asset/shaders
+
+struct GPUFrameData
+{
+    glm::mat4 view;
+    glm::mat4 projection;
+    glm::vec3 viewPos;
+    int numDirLights;
+    int nrPointLights;
+    int nrSpotLights;
+    int pad0;
+    int pad1;
+};
+static_assert(sizeof(GPUFrameData) == 160, "GPUFrameData must match the std140 FrameData block");
+
+struct GPUShadowData
+{
+    glm::mat4 lightSpaceMatrix[2];     // Shadow::MAX_DIR_LIGHTS_SHADOW
+    glm::mat4 lightSpaceMatrixSpot[2]; // Shadow::MAX_SPOT_LIGHTS_SHADOW
+    float farPlanePoint;
+    float farPlaneSpot;
+    int receiveShadow;
+    int pad0;
+};
+static_assert(sizeof(GPUShadowData) == 272, "GPUShadowData must match the std140 ShadowData block");
+
+// Phong and PBR parameters share one layout; each shader reads the fields it needs
+struct GPUMaterialData
+{
+    glm::vec3 specular;
+    float shininess;
+    glm::vec3 ambient;
+    float opacity;
+    glm::vec3 emission;
+    float roughness;
+    float metallic;
+    float ao;
+    float pad0;
+    float pad1;
+    glm::vec4 tintColor;
+    glm::vec2 uvScale;
+    glm::vec2 uvOffset;
+    int debugNoTexture;
+    int pad2;
+    int pad3;
+    int pad4;
+};
+static_assert(sizeof(GPUMaterialData) == 112, "GPUMaterialData must match the std140 MaterialData block");
+
+struct GPUSkinningData
+{
+    static constexpr int MAX_BONES = 100;
+    glm::mat4 finalBonesMatrices[MAX_BONES];
+};
+
+// A small UBO that is rewritten as a whole, e.g. once per frame
+class UniformBuffer
+{
+public:
+    UniformBuffer() = default;
+    ~UniformBuffer();
+
+    UniformBuffer(const UniformBuffer &) = delete;
+    UniformBuffer &operator=(const UniformBuffer &) = delete;
+
+    void Init(size_t size, UniformBlock binding);
+    void Shutdown();
+    bool IsInitialized() const { return m_Buffer != 0; }
+
+    // Orphans the storage, uploads size bytes and binds the buffer to its block
+    void Upload(const void *data, size_t size);
+
+    template <typename T>
+    void Upload(const T &data) { Upload(&data, sizeof(T)); }
+
+    GLuint GetBuffer() const { return m_Buffer; }
+
+    // GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, for sub-allocating blocks out of a shared buffer
+    static size_t GetOffsetAlignment();
+
+private:
+    GLuint m_Buffer = 0;
+    size_t m_Size = 0;
+    UniformBlock m_Binding = UniformBlock::Frame;
+};
@@ -17,34 +17,74 @@ struct AssimpNodeData
 	int childrenCount;
 	std::vector<AssimpNodeData> children;
 
-	Bone *cachedBone = nullptr;
+	int channel = -1; // index of the animating Bone in the clip, -1 = static node
 };
 
+// One node of the flattened hierarchy. Nodes are stored parent-before-child, so a single forward
+// pass over the array resolves every global transform.
+struct SkeletonNode
+{
+	glm::mat4 transformation; // bind-pose local transform, used when channel == -1
+	glm::mat4 offset;         // inverse bind matrix, valid when boneId >= 0
+	int parent = -1;          // index into the skeleton, -1 = root
+	int channel = -1;         // index of the animating Bone in the clip, -1 = static node
+	int boneId = -1;          // slot in the bone palette, -1 = not skinned
+	int depth = 0;            // distance from the root, used to drop fine bones at low LOD
+};
+
+// A loaded clip. Read-only once constructed: playback state (time, key cursors, pose) lives in
+// each Animator, so one clip can drive any number of characters in parallel.
 class Animation
 {
 public:
 	Animation();
 	Animation(const std::string &animationPath, Model *model);
+	// Builds the clip from an already imported scene; new bones are appended to boneInfoMap
+	Animation(const aiScene *scene, std::unordered_map<std::string, BoneInfo> &boneInfoMap, int &boneCount);
 	~Animation();
 
-	Bone *FindBone(const std::string &name);
+	const Bone *FindBone(const std::string &name) const;
+	// Channel index of the bone animating name, or -1
+	int FindChannel(const std::string &name) const;
+	const Bone &GetBone(int channel) const { return m_Bones[channel]; }
+	size_t GetBoneCount() const { return m_Bones.size(); }
+
+	inline float GetTicksPerSecond() const { return m_TicksPerSecond; }
+	inline float GetDuration() const { return m_Duration; }
+	inline const AssimpNodeData &GetRootNode() const { return m_RootNode; }
+	inline const std::vector<SkeletonNode> &GetSkeleton() const { return m_Skeleton; }
+	inline const std::string &GetNodeName(int node) const { return m_NodeNames[node]; }
 
-	inline float GetTicksPerSecond() { return m_TicksPerSecond; }
-	inline float GetDuration() { return m_Duration; }
-	inline AssimpNodeData &GetRootNode() { return m_RootNode; }
-	inline const std::unordered_map<std::string, BoneInfo> &GetBoneIDMap() { return m_BoneInfoMap; }
+	// remap[i] = channel of target animating skeleton node i of this clip, or -1
+	void BuildChannelRemap(const Animation &target, std::vector<int> &remap) const;
+	inline const std::unordered_map<std::string, BoneInfo> &GetBoneIDMap() const { return m_BoneInfoMap; }
+
+	// Quantizes every channel in place; call before the clip is shared with animators
+	void Compress(const ClipCompressionSettings &settings);
+	bool IsCompressed() const { return m_Compressed; }
+	const ClipCompressionReport &GetCompressionReport() const { return m_CompressionReport; }
+	// Key storage of all channels
+	size_t GetMemoryBytes() const;
 
 private:
 	float m_Duration;
 	int m_TicksPerSecond;
 	std::vector<Bone> m_Bones;
-	std::unordered_map<std::string, Bone *> m_BoneMap;
+	std::unordered_map<std::string, int> m_BoneMap;
 
 	AssimpNodeData m_RootNode;
 	std::unordered_map<std::string, BoneInfo> m_BoneInfoMap;
 
-	void ReadMissingBones(const aiAnimation *animation, Model &model);
+	std::vector<SkeletonNode> m_Skeleton;
+	std::vector<std::string> m_NodeNames;
+
+	bool m_Compressed = false;
+	ClipCompressionReport m_CompressionReport;
+
+	void Load(const aiScene *scene, std::unordered_map<std::string, BoneInfo> &boneInfoMap, int &boneCount);
+	void ReadMissingBones(const aiAnimation *animation, std::unordered_map<std::string, BoneInfo> &boneInfoMap, int &boneCount);
 	void ReadHierarchyData(AssimpNodeData &dest, const aiNode *src);
 
 	void BindNodesToBones(AssimpNodeData& node); 
+	void FlattenHierarchy(const AssimpNodeData &node, int parent, int depth);
 };
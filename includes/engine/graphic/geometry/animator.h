@@ -7,46 +7,65 @@
 
 #include <graphic/geometry/animation.h>
 
+// Per-character playback state over shared, immutable Animation clips: time, blend state, one
+// key cursor per channel and the resulting bone palette. Animators never write to their clips, so
+// any number of them can update in parallel.
 class Animator
 {
 public:
-	Animator(Animation *animation);
+	Animator(const Animation *animation);
 
 	void UpdateAnimation(float dt);
-	void AddAnimation(const std::string &name, Animation *animation);
-	void PlayAnimation(Animation *pAnimation);
+	void AddAnimation(const std::string &name, const Animation *animation);
+	void PlayAnimation(const Animation *pAnimation);
 	void PlayAnimation(const std::string &name);
 
-	void CalculateBoneTransform(const AssimpNodeData *node, glm::mat4 parentTransform);
-	std::vector<glm::mat4> GetFinalBoneMatrices();
+	const std::vector<glm::mat4> &GetFinalBoneMatrices() const { return m_FinalBoneMatrices; }
 
 	void SetSpeed(float speed) { m_Speed = speed; }
 	void SetTime(float timeInSeconds) { m_CurrentTime = timeInSeconds; }
 	void SetUpdateRate(float updatesPerSecond) { m_UpdateRate = updatesPerSecond; }
 
+	// Quality knobs for animation LOD: nodes deeper than maxDepth keep their bind pose (-1 = all)
+	void SetMaxSampledDepth(int maxDepth) { m_MaxSampledDepth = maxDepth; }
+	void SetRotationInterpolation(RotationInterpolation mode) { m_RotationInterpolation = mode; }
+
 	float GetDuration() const { return m_CurrentAnimation ? m_CurrentAnimation->GetDuration() : 0.0f; }
 
-private:
 	void CrossFade(const std::string &name, float transitionDuration);
 	void PlayBlend(const std::string &nameA, const std::string &nameB, float factor);
 
+private:
+	void EvaluatePose();
+
 	void SetBlendFactor(float factor) { m_BlendFactor = factor; }
 
 private:
 	std::vector<glm::mat4> m_FinalBoneMatrices;
-	Animation *m_CurrentAnimation;
+	const Animation *m_CurrentAnimation;
 	float m_CurrentTime;
+	std::vector<BoneCursor> m_Cursors;
 
-	Animation *m_NextAnimation = nullptr;
+	const Animation *m_NextAnimation = nullptr;
+	std::vector<BoneCursor> m_NextCursors;
 	float m_NextTime = 0.0f;
 	float m_BlendFactor = 0.0f; // 0.0 = Current, 1.0 = Next
 	bool m_IsCrossFading = false;
 	float m_TransitionSpeed = 0.0f;
 
+	// Skeleton node of the current clip -> channel of the next clip; rebuilt when the pair changes
+	std::vector<int> m_NextRemap;
+	const Animation *m_RemapFrom = nullptr;
+	const Animation *m_RemapTo = nullptr;
+
+	std::vector<glm::mat4> m_GlobalTransforms;
+
 	float m_Speed = 1.0f;
 
 	float m_UpdateRate = 0.0f;
+	int m_MaxSampledDepth = -1;
+	RotationInterpolation m_RotationInterpolation = RotationInterpolation::Slerp;
 	float m_TimeSinceLastUpdate = 0.0f;
 
-	std::unordered_map<std::string, Animation *> m_AnimationsMap;
+	std::unordered_map<std::string, const Animation *> m_AnimationsMap;
 };
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class Animation;
+
+struct BakedClip
+{
+	std::string name;
+	uint32_t firstFrame = 0;
+	uint32_t frameCount = 0;
+	float framesPerSecond = 30.0f;
+	float duration = 0.0f; // seconds
+};
+
+// Bone palettes of one model's clips, sampled at a fixed rate when loading and stored in an
+// RGBA32F texture: one row per frame, four texels (the matrix columns) per bone. Instanced draws
+// skin straight from the texture, so every character sharing the model is drawn in one call.
+//
+// Per instance, the render system packs the clip's row range and the position inside it into
+// the unused bottom row of the instance matrix; see PackInstance.
+class BakedAnimation
+{
+public:
+	explicit BakedAnimation(int boneCount);
+	~BakedAnimation();
+
+	BakedAnimation(const BakedAnimation &) = delete;
+	BakedAnimation &operator=(const BakedAnimation &) = delete;
+
+	// Samples the looping clip at framesPerSecond; returns the clip index
+	int AddClip(const std::string &name, const Animation &clip, float framesPerSecond = 30.0f);
+
+	int FindClip(const std::string &name) const;
+	const BakedClip &GetClip(int index) const { return m_Clips[index]; }
+	size_t GetClipCount() const { return m_Clips.size(); }
+	int GetBoneCount() const { return m_BoneCount; }
+	uint32_t GetFrameCount() const { return m_FrameCount; }
+
+	// Wraps time (seconds) into the clip
+	float WrapTime(int clip, float time) const;
+
+	// Writes the clip, frame position and row range into the bottom row of world
+	glm::mat4 PackInstance(const glm::mat4 &world, int clip, float time) const;
+
+	// CPU copy of the nearest frame, GetBoneCount() matrices (shadow passes, picking)
+	const glm::mat4 *GetPalette(int clip, float time) const;
+
+	// Uploads the texture on first use after clips were added, then binds it to unit
+	void Bind(int unit);
+	void Shutdown();
+
+private:
+	float FramePosition(int clip, float time) const;
+
+	int m_BoneCount = 0;
+	uint32_t m_FrameCount = 0;
+	std::vector<BakedClip> m_Clips;
+	std::vector<glm::mat4> m_Matrices; // m_FrameCount * m_BoneCount
+
+	GLuint m_Texture = 0;
+	bool m_Dirty = false;
+};
@@ -1,66 +1,76 @@
 #pragma once
 
 #include <vector>
+#include <string>
+#include <cstdint>
 #include <assimp/scene.h>
 #include <glm/glm.hpp>
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/quaternion.hpp>
 
-struct KeyPosition
-{
-	glm::vec3 position;
-	float timeStamp;
-};
+#include <graphic/geometry/clip_compression.h>
 
-struct KeyRotation
+// Last key segment used per track; owned by whoever plays the clip (Animator), never by the clip
+struct BoneCursor
 {
-	glm::quat orientation;
-	float timeStamp;
+	uint32_t position = 0;
+	uint32_t rotation = 0;
+	uint32_t scale = 0;
 };
 
-struct KeyScale
+// Nlerp skips the trig in slerp; close enough for small or distant characters
+enum class RotationInterpolation : uint8_t
 {
-	glm::vec3 scale;
-	float timeStamp;
+	Slerp,
+	Nlerp
 };
 
+// One animated channel of a clip. Keys are stored as separate time/value arrays and never change
+// after loading, so any number of animators can sample the same Bone concurrently. Compress()
+// swaps the float keys for quantized tracks once, before the clip is shared.
 class Bone
 {
 public:
 	Bone(const std::string &name, int ID, const aiNodeAnim *channel);
 
-	void Update(float animationTime);
-	glm::mat4 GetLocalTransform();
-	std::string GetBoneName() const;
-	int GetBoneID();
+	// cursor is a hint that makes forward playback O(1); any value is valid
+	void Sample(float animationTime, BoneCursor &cursor, glm::vec3 &position, glm::quat &rotation, glm::vec3 &scale,
+				RotationInterpolation rotationMode = RotationInterpolation::Slerp) const;
+	glm::mat4 SampleLocalTransform(float animationTime, BoneCursor &cursor,
+								   RotationInterpolation rotationMode = RotationInterpolation::Slerp) const;
 
-	int GetPositionIndex(float animationTime);
-	int GetRotationIndex(float animationTime);
-	int GetScaleIndex(float animationTime);
+	const std::string &GetBoneName() const { return m_Name; }
+	int GetBoneID() const { return m_ID; }
 
-	glm::vec3 GetPosition(float animationTime);
-	glm::quat GetRotation(float animationTime);
-	glm::vec3 GetScale(float animationTime);
+	// Cursor-less sampling (binary search)
+	glm::vec3 GetPosition(float animationTime) const;
+	glm::quat GetRotation(float animationTime) const;
+	glm::vec3 GetScale(float animationTime) const;
 
-private:
-	glm::vec3 InterpolatePosition(float animationTime);
-	glm::quat InterpolateRotation(float animationTime);
-	glm::vec3 InterpolateScaling(float animationTime);
+	// Drops redundant keys and quantizes the rest; the float keys are released. timeScale maps
+	// clip ticks to the 16-bit key times. Errors are measured at the original key times.
+	void Compress(const ClipCompressionSettings &settings, float timeScale, ClipCompressionReport &report);
+	bool IsCompressed() const { return m_Compressed; }
+	size_t GetMemoryBytes() const;
 
-	float GetScaleFactor(float lastTimeStamp, float nextTimeStamp, float animationTime);
+private:
+	glm::vec3 InterpolatePosition(float animationTime, uint32_t &cursor) const;
+	glm::quat InterpolateRotation(float animationTime, uint32_t &cursor, RotationInterpolation mode) const;
+	glm::vec3 InterpolateScaling(float animationTime, uint32_t &cursor) const;
 
-	std::vector<KeyPosition> m_Positions;
-	std::vector<KeyRotation> m_Rotations;
-	std::vector<KeyScale> m_Scales;
-	int m_NumPositions;
-	int m_NumRotations;
-	int m_NumScalings;
+	std::vector<float> m_PositionTimes;
+	std::vector<glm::vec3> m_Positions;
+	std::vector<float> m_RotationTimes;
+	std::vector<glm::quat> m_Rotations;
+	std::vector<float> m_ScaleTimes;
+	std::vector<glm::vec3> m_Scales;
 
-	int m_LastPositionIndex = 0;
-	int m_LastRotationIndex = 0;
-	int m_LastScaleIndex = 0;
+	bool m_Compressed = false;
+	float m_TimeScale = 0.0f;
+	CompressedVec3Track m_PackedPositions;
+	CompressedQuatTrack m_PackedRotations;
+	CompressedVec3Track m_PackedScales;
 
-	glm::mat4 m_LocalTransform;
 	std::string m_Name;
 	int m_ID;
 };
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+// Tolerances for LOAD_ANIMATION ... COMPRESSED. Keys that linear interpolation reproduces within
+// tolerance are dropped before quantization.
+struct ClipCompressionSettings
+{
+	float positionTolerance = 0.001f; // model units
+	float rotationTolerance = 0.001f; // radians
+	float scaleTolerance = 0.001f;
+};
+
+// Measured against the original keys after compression
+struct ClipCompressionReport
+{
+	size_t rawBytes = 0;
+	size_t compressedBytes = 0;
+	size_t rawKeys = 0;
+	size_t keptKeys = 0;
+	float maxPositionError = 0.0f;
+	float maxRotationError = 0.0f; // radians
+	float maxScaleError = 0.0f;
+
+	void Merge(const ClipCompressionReport &other);
+};
+
+// Key times are stored as 16-bit fractions of the clip duration
+
+// Vec3 keys in 16-bit fixed point over the track's bounding box
+struct CompressedVec3Track
+{
+	std::vector<uint16_t> times;
+	std::vector<uint16_t> values; // x, y, z per key
+	glm::vec3 offset = glm::vec3(0.0f);
+	glm::vec3 step = glm::vec3(0.0f);
+
+	size_t GetBytes() const { return (times.size() + values.size()) * sizeof(uint16_t) + sizeof(offset) + sizeof(step); }
+};
+
+// Smallest-three quaternions: the largest component is dropped and rebuilt from the unit length,
+// the other three take 15 bits each and the spare top bits of the first two hold its index
+struct CompressedQuatTrack
+{
+	std::vector<uint16_t> times;
+	std::vector<uint16_t> values; // 3 per key
+
+	size_t GetBytes() const { return (times.size() + values.size()) * sizeof(uint16_t); }
+};
+
+namespace ClipCompression
+{
+	constexpr float TIME_STEPS = 65535.0f;
+
+	// Segment [index, index + 1] containing time; times holds at least two keys. cursor is the
+	// segment found last time: forward playback moves a few keys from it, anything else searches
+	template <typename T>
+	uint32_t FindSegment(const std::vector<T> &times, float time, uint32_t &cursor)
+	{
+		uint32_t last = static_cast<uint32_t>(times.size()) - 2;
+		uint32_t index = (std::min)(cursor, last);
+
+		if (time >= static_cast<float>(times[index]))
+		{
+			for (int step = 0; step < 4 && index < last && time >= static_cast<float>(times[index + 1]); ++step)
+				++index;
+			if (index == last || time < static_cast<float>(times[index + 1]))
+			{
+				cursor = index;
+				return index;
+			}
+		}
+
+		size_t upper = std::upper_bound(times.begin(), times.end(), time, [](float t, T key)
+		{ return t < static_cast<float>(key); }) - times.begin();
+		index = upper == 0 ? 0 : (std::min)(static_cast<uint32_t>(upper - 1), last);
+		cursor = index;
+		return index;
+	}
+
+	template <typename T>
+	float SegmentFactor(const std::vector<T> &times, uint32_t index, float time)
+	{
+		float span = static_cast<float>(times[index + 1]) - static_cast<float>(times[index]);
+		if (span <= 0.0f)
+			return 0.0f;
+		return glm::clamp((time - static_cast<float>(times[index])) / span, 0.0f, 1.0f);
+	}
+
+	// Indices of the keys to keep so that interpolating between kept keys stays within tolerance;
+	// the first and last key are always kept
+	std::vector<uint32_t> ReduceVec3Keys(const std::vector<float> &times, const std::vector<glm::vec3> &values, float tolerance);
+	std::vector<uint32_t> ReduceQuatKeys(const std::vector<float> &times, const std::vector<glm::quat> &values, float toleranceRadians);
+
+	// timeScale maps clip ticks to the 16-bit range
+	CompressedVec3Track CompressVec3(const std::vector<float> &times, const std::vector<glm::vec3> &values, const std::vector<uint32_t> &keep, float timeScale);
+	CompressedQuatTrack CompressQuat(const std::vector<float> &times, const std::vector<glm::quat> &values, const std::vector<uint32_t> &keep, float timeScale);
+
+	void EncodeQuat(const glm::quat &q, uint16_t out[3]);
+	glm::quat DecodeQuat(const uint16_t in[3]);
+
+	// Decodes keys index and index + 1 and blends them (SSE when available)
+	glm::vec3 SampleVec3(const CompressedVec3Track &track, uint32_t index, float factor);
+	void DecodeQuatPair(const CompressedQuatTrack &track, uint32_t index, glm::quat &a, glm::quat &b);
+
+	// Angle between two rotations
+	float RotationError(const glm::quat &a, const glm::quat &b);
+}
@@ -39,9 +39,22 @@ public:
 
     Mesh(std::vector<Vertex> vertices, std::vector<unsigned int> indices, std::vector<Texture> textures);
     void Draw(Shader &shader);
-    void DrawInstanced(Shader &shader, const std::vector<glm::mat4> &models);
+    // Instance matrices are read from instanceBuffer starting at byteOffset (a GpuRingBuffer
+    // allocation shared by every mesh of the model). bufferGeneration is the ring's GetGeneration()
+    void DrawInstanced(Shader &shader, unsigned int instanceBuffer, uint32_t bufferGeneration, size_t byteOffset, size_t count);
+    void BindTextures(Shader &shader);
+
+    // Vertex attributes 0-6 for the Vertex layout, read from the bound GL_ARRAY_BUFFER
+    static void SetupVertexAttributes();
+    // Per-instance mat4 at locations 10-13, read from the bound GL_ARRAY_BUFFER at byteOffset
+    static void SetupInstanceAttributes(size_t byteOffset);
 
 private:
     unsigned int VBO, EBO, instanceVBO;
+    unsigned int m_InstanceSource = 0;
+    uint32_t m_InstanceSourceGeneration = 0; // 0: the mesh's own instanceVBO
+    size_t m_InstanceSourceOffset = 0;
     void setupMesh();
+    bool isInstanceSource(unsigned int buffer, uint32_t generation, size_t byteOffset) const;
+    void bindInstanceAttributes(unsigned int buffer, uint32_t generation, size_t byteOffset);
 };
\ No newline at end of file
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <graphic/renderer/indirect_draw.h>
+#include <cstdint>
+#include <vector>
+
+class Model;
+class Mesh;
+
+struct ArenaModel
+{
+    const Model *model = nullptr;
+    std::vector<ArenaMeshRange> meshes;
+};
+
+// Static geometry of every model drawn through the multi-draw-indirect path, sub-allocated from
+// one vertex buffer and one index buffer that share the Vertex layout and a single VAO. Models are
+// uploaded on first use and stay resident until Shutdown; the buffers double (GPU-side copy)
+// when full.
+class MeshArena
+{
+public:
+    MeshArena() = default;
+    ~MeshArena();
+
+    MeshArena(const MeshArena &) = delete;
+    MeshArena &operator=(const MeshArena &) = delete;
+
+    void Init(size_t vertexCapacity, size_t indexCapacity);
+    void Shutdown();
+    bool IsInitialized() const { return m_VAO != 0; }
+
+    // Sub-mesh ranges of the model, uploading it on first use; nullptr if it has no geometry
+    const ArenaModel *Acquire(Model &model);
+
+    // Binds the shared VAO with the per-instance matrices read from instanceBuffer, whose ring
+    // generation (GpuRingBuffer::GetGeneration) tells a grown buffer from one reusing its name
+    void Bind(GLuint instanceBuffer, uint32_t bufferGeneration);
+
+    Mesh *GetMesh(uint32_t meshId) const { return m_Meshes[meshId]; }
+    size_t GetVertexCount() const { return m_VertexCount; }
+    size_t GetIndexCount() const { return m_IndexCount; }
+
+private:
+    void Reserve(size_t vertices, size_t indices);
+    void CreateVertexArray();
+
+    GLuint m_VAO = 0;
+    GLuint m_VBO = 0;
+    GLuint m_EBO = 0;
+    GLuint m_InstanceSource = 0;
+    uint32_t m_InstanceSourceGeneration = 0;
+
+    size_t m_VertexCount = 0;
+    size_t m_VertexCapacity = 0;
+    size_t m_IndexCount = 0;
+    size_t m_IndexCapacity = 0;
+
+    std::vector<ArenaModel> m_Models;
+    std::vector<Mesh *> m_Meshes;
+};
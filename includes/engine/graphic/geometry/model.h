@@ -3,11 +3,58 @@
 #include <glm/glm.hpp>
 #include <assimp/scene.h>
 
+#include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include <graphic/geometry/mesh.h>
 #include <graphic/core/shader.h>
 #include <graphic/geometry/animdata.h>
+#include <resource/image_decode_cache.h>
+
+// Texture of an import waiting for Model::UploadImage. Pixels come from ImageDecodeCache, so models
+// referencing the same file share one decode.
+struct ModelImage
+{
+	std::string type;
+	std::string path; // as written in the material; generated 1x1 fallbacks use INTERNAL_* names
+	bool fallback = false; // 1x1 colour: nearest filtering, no mipmaps
+	std::shared_ptr<const DecodedImage> pixels; // released once uploaded
+	unsigned int id = 0; // GL texture once uploaded
+};
+
+struct ModelMeshData
+{
+	std::vector<Vertex> vertices;
+	std::vector<unsigned int> indices;
+	std::vector<uint32_t> images; // indices into ModelImportData::images, in binding order
+};
+
+// Milliseconds per stage of one model load
+struct ModelLoadTimings
+{
+	float readMs = 0.0f;   // assimp ReadFile and post-processing
+	float gatherMs = 0.0f; // mesh list, bone ids, texture references
+	float jobsMs = 0.0f;   // wall time of the parallel mesh and texture jobs
+	float meshMs = 0.0f;   // vertex/index building, summed over threads
+	float decodeMs = 0.0f; // image decoding, summed over threads
+	float uploadMs = 0.0f; // GL textures and buffers, main thread
+	int textures = 0;      // distinct images referenced by the file
+	int decoded = 0;       // of those, decoded by this load rather than served by the cache
+};
+
+// CPU half of a model load: the assimp import, vertex/index data and decoded texture pixels. Needs no
+// GL context, so it can run on a worker thread; Model(ModelImportData &&) then does the uploads.
+struct ModelImportData
+{
+	std::string directory;
+	bool valid = false;
+	std::vector<ModelMeshData> meshes;
+	std::vector<ModelImage> images;
+	std::unordered_map<std::string, BoneInfo> boneInfoMap;
+	int boneCount = 0;
+	ModelLoadTimings timings;
+};
 
 class Model
 {
@@ -18,11 +65,23 @@ public:
 	bool gammaCorrection;
 	glm::vec3 AABBmin;
 	glm::vec3 AABBmax;
+	uint32_t arenaHandle = 0; // MeshArena slot + 1; 0 = not resident
+	ModelLoadTimings loadTimings;
 
+	// Imports and uploads on the calling thread, which must own the GL context
 	Model(std::string const &path, bool isStatic = false, bool gamma = false);
+	// Uploads an import made elsewhere; images already sent with UploadImage are reused. Main thread.
+	explicit Model(ModelImportData &&data);
+
+	// Thread-safe; false (with data.valid unset) when assimp cannot read the file. Meshes are built and
+	// textures decoded on helper threads, all before this returns.
+	static bool Import(std::string const &path, bool isStatic, ModelImportData &data);
+	static void UploadImage(ModelImage &image);
+	// Deletes textures of an import that will never become a Model
+	static void ReleaseImages(ModelImportData &data);
 
 	void Draw(Shader &shader);
-    void DrawInstanced(Shader &shader, const std::vector<glm::mat4> &models);
+	void DrawInstanced(Shader &shader, unsigned int instanceBuffer, uint32_t bufferGeneration, size_t byteOffset, size_t count);
 
 	std::unordered_map<std::string, BoneInfo> &GetBoneInfoMap();
 	int &GetBoneCount();
@@ -31,13 +90,5 @@ private:
 	std::unordered_map<std::string, BoneInfo> m_BoneInfoMap;
 	int m_BoneCounter = 0;
 
-	void loadModel(std::string const &path, bool isStatic);
-	void processNode(aiNode *node, const aiScene *scene);
-	void SetVertexBoneDataToDefault(Vertex &vertex);
-	Mesh processMesh(aiMesh *mesh, const aiScene *scene);
-	void SetVertexBoneData(Vertex &vertex, int boneID, float weight);
-	void ExtractBoneWeightForVertices(std::vector<Vertex> &vertices, aiMesh *mesh, const aiScene *scene);
-	
-	unsigned int TextureFromFile(const char *path, const std::string &directory, const aiScene* scene, bool gamma = false);
-	std::vector<Texture> loadMaterialTextures(aiMaterial *mat, aiTextureType type, std::string typeName, const aiScene* scene);
+	void Upload(ModelImportData &data);
 };
\ No newline at end of file
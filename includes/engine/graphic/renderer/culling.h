@@ -0,0 +1,63 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+class Frustum;
+class DynamicAABBTree;
+
+// World AABBs stored structure-of-arrays so the culling kernels can load 4 (SSE) or 8 (AVX2)
+// boxes per instruction. Arrays are padded to a multiple of 8; padding lanes are masked off.
+struct BoundsSoA
+{
+    std::vector<float> minX, minY, minZ;
+    std::vector<float> maxX, maxY, maxZ;
+    size_t count = 0;
+
+    void Resize(size_t size);
+    void Set(size_t index, const glm::vec3 &min, const glm::vec3 &max);
+};
+
+// One bit per box, bit i of word i / 64
+using VisibilityBits = std::vector<uint64_t>;
+
+namespace Culling
+{
+    // Fills bits with every box marked visible
+    void SetAll(size_t count, VisibilityBits &bits);
+
+    // Clears bits of boxes completely outside any frustum plane
+    void FrustumCull(const Frustum &frustum, const BoundsSoA &bounds, VisibilityBits &bits);
+
+    // Clears bits of boxes whose closest point is farther than sqrt(maxDistanceSq) from point
+    void DistanceCull(const glm::vec3 &point, float maxDistanceSq, const BoundsSoA &bounds, VisibilityBits &bits);
+
+    // Walks the scene AABB tree instead of testing every box; leaves carry queue indices.
+    // Resets bits to count entries and sets only the visible ones.
+    void HierarchicalCull(const DynamicAABBTree &tree, const Frustum &frustum, const glm::vec3 &point, float maxDistanceSq,
+                          size_t count, VisibilityBits &bits);
+
+    inline bool IsVisible(const VisibilityBits &bits, size_t index)
+    {
+        return (bits[index >> 6] >> (index & 63)) & 1u;
+    }
+
+    // Calls fn(index) for each set bit in ascending order
+    template <typename Fn>
+    void ForEachVisible(const VisibilityBits &bits, Fn &&fn)
+    {
+        for (size_t word = 0; word < bits.size(); ++word)
+        {
+            uint64_t mask = bits[word];
+            while (mask)
+            {
+                fn(word * 64 + static_cast<size_t>(std::countr_zero(mask)));
+                mask &= mask - 1;
+            }
+        }
+    }
+
+    const char *GetKernelName();
+}
@@ -21,11 +21,20 @@ struct AABB
     glm::vec3 max;
 };
 
+enum class FrustumResult
+{
+    Outside,
+    Intersect,
+    Inside
+};
+
 class Frustum
 {
 public:
     void Update(const glm::mat4 &viewProjection);
     bool IsBoxVisible(const glm::vec3 &min, const glm::vec3 &max) const;
+    FrustumResult ClassifyBox(const glm::vec3 &min, const glm::vec3 &max) const;
+    const Plane &GetPlane(int index) const { return planes[index]; }
 
 private:
     Plane planes[6];
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+// Matches the GL layout consumed by glMultiDrawElementsIndirect
+struct DrawElementsIndirectCommand
+{
+    uint32_t count = 0;
+    uint32_t instanceCount = 0;
+    uint32_t firstIndex = 0;
+    int32_t baseVertex = 0;
+    uint32_t baseInstance = 0;
+};
+static_assert(sizeof(DrawElementsIndirectCommand) == 20, "Indirect command must match the GL layout");
+
+// Where one sub-mesh lives in the shared geometry arena
+struct ArenaMeshRange
+{
+    uint32_t indexCount = 0;
+    uint32_t firstIndex = 0;
+    int32_t baseVertex = 0;
+    uint32_t meshId = 0;     // arena-wide mesh index, used to bind that mesh's textures
+    uint64_t textureKey = 0; // meshes with equal keys bind the same textures
+};
+
+// A run of commands submitted with one glMultiDrawElementsIndirect call
+struct IndirectBatch
+{
+    uint64_t stateKey = 0;
+    uint64_t textureKey = 0;
+    uint32_t meshId = 0;
+    uint32_t userData = 0; // from the first Add() of the batch
+    uint32_t firstCommand = 0;
+    uint32_t commandCount = 0;
+};
+
+// Turns the culled, sorted render queue into indirect draw commands without touching GL, so it
+// can be exercised without a GPU.
+//
+// Consecutive Add() calls with the same state and model collapse into one instanced command per
+// sub-mesh. Finish() then groups commands by (state, textures); every group is one batch.
+class IndirectCommandBuilder
+{
+public:
+    void Reset();
+
+    void Add(uint64_t stateKey, uint32_t modelId, const ArenaMeshRange *meshes, uint32_t meshCount,
+             const glm::mat4 &world, uint32_t userData = 0);
+
+    // baseInstance offsets every command, i.e. the instance index of GetInstances()[0] in the
+    // instance buffer
+    void Finish(uint32_t baseInstance = 0);
+
+    // Number of commands Finish() will produce, for sizing buffers up front
+    size_t CountCommands() const;
+
+    bool Empty() const { return m_Instances.empty(); }
+    const std::vector<glm::mat4> &GetInstances() const { return m_Instances; }
+    const std::vector<DrawElementsIndirectCommand> &GetCommands() const { return m_Commands; }
+    const std::vector<IndirectBatch> &GetBatches() const { return m_Batches; }
+
+private:
+    struct Run
+    {
+        uint64_t stateKey;
+        uint32_t modelId;
+        const ArenaMeshRange *meshes;
+        uint32_t meshCount;
+        uint32_t firstInstance;
+        uint32_t instanceCount;
+        uint32_t userData;
+    };
+
+    struct PendingCommand
+    {
+        uint64_t stateKey;
+        uint64_t textureKey;
+        uint32_t meshId;
+        uint32_t userData;
+        DrawElementsIndirectCommand command;
+    };
+
+    std::vector<Run> m_Runs;
+    std::vector<glm::mat4> m_Instances;
+    std::vector<PendingCommand> m_Pending;
+    std::vector<DrawElementsIndirectCommand> m_Commands;
+    std::vector<IndirectBatch> m_Batches;
+};
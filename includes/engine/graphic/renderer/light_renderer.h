@@ -70,6 +70,15 @@ public:
     void Init();
     void UploadLightData(Scene &scene, Shader *shader);
 
+    // Gathers the active lights into the SSBOs; once per frame is enough for every shader
+    void Upload(Scene &scene);
+    // Light counts as loose uniforms, for shaders without the FrameData block
+    void Apply(Shader *shader) const;
+
+    int GetDirLightCount() const { return (int)m_DirLights.size(); }
+    int GetPointLightCount() const { return (int)m_PointLights.size(); }
+    int GetSpotLightCount() const { return (int)m_SpotLights.size(); }
+
 private:
     unsigned int m_DirLightSSBO = 0;
     unsigned int m_PointLightSSBO = 0;
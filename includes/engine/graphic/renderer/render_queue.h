@@ -0,0 +1,104 @@
+#pragma once
+
+#include <entt/entt.hpp>
+#include <graphic/renderer/culling.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+class Model;
+class Shader;
+class DynamicAABBTree;
+
+// Sort key layout, most significant first: shader | material | model | depth bucket (16 bits each).
+// Shader, material and model are small interned ids, so items that can share state end up adjacent.
+struct RenderQueueItem
+{
+    uint64_t key = 0;
+    entt::entity entity = entt::null;
+    Shader *shader = nullptr;
+    Model *model = nullptr;
+    glm::vec3 worldMin = glm::vec3(0.0f);
+    glm::vec3 worldMax = glm::vec3(0.0f);
+    uint32_t worldVersion = 0;
+    uint16_t materialId = 0;
+    bool castShadow = true;
+    int32_t proxyId = -1;
+};
+
+// Retained list of everything with Transform + MeshRenderer, kept sorted by key.
+// Structural changes arrive through registry signals and moved transforms through a list fed by
+// the TransformSystem; only those items are refreshed. Items whose key changed (including ones
+// whose depth bucket changed after the camera moved) are radix sorted and merged back in.
+//
+// World AABBs are mirrored into WorldBoundsComponent, into a SoA copy (same order as the items)
+// for the SIMD culling kernels, and into the scene's AABB tree, whose leaves carry the item index.
+//
+// Renderer and material edits (model, shader, castShadow, material values) must go through
+// registry.patch<MeshRendererComponent/MaterialComponent>() so the item is rebuilt.
+class RenderQueue
+{
+public:
+    RenderQueue() = default;
+    ~RenderQueue();
+
+    RenderQueue(const RenderQueue &) = delete;
+    RenderQueue &operator=(const RenderQueue &) = delete;
+
+    // Connects to the registry's signals; re-attaching to a different registry rebuilds the queue.
+    // The tree, when given, is owned by the caller and receives one proxy per item.
+    void Attach(entt::registry &registry, DynamicAABBTree *tree = nullptr);
+    void Detach();
+
+    // Drains pending signals, refreshes the moved entities and merges re-keyed items back.
+    // Without a moved list every item's world version is checked instead.
+    void Update(const glm::vec3 &cameraPos, const std::vector<entt::entity> *moved = nullptr);
+
+    const std::vector<RenderQueueItem> &GetItems() const { return m_Items; }
+    const BoundsSoA &GetBounds() const { return m_Bounds; }
+
+    void SetDepthBucketSize(float size) { m_DepthBucketSize = size; }
+
+    size_t GetLastChangedCount() const { return m_LastChangedCount; }
+
+    static constexpr uint64_t SHADER_SHIFT = 48;
+    static constexpr uint64_t MATERIAL_SHIFT = 32;
+    static constexpr uint64_t MODEL_SHIFT = 16;
+
+private:
+    void OnEntityChanged(entt::registry &registry, entt::entity entity);
+
+    // Returns true when the key changed; rebuild also re-reads the renderer
+    bool RefreshItem(RenderQueueItem &item, bool rebuild);
+    uint32_t FindItem(entt::entity entity) const;
+    uint64_t BuildStateKey(const RenderQueueItem &item);
+    uint16_t GetDepthBucket(const RenderQueueItem &item) const;
+    uint16_t InternShader(Shader *shader);
+    uint16_t InternModel(Model *model);
+    uint16_t InternMaterial(entt::entity entity);
+
+    static void RadixSort(std::vector<RenderQueueItem> &items, std::vector<RenderQueueItem> &scratch);
+
+    entt::registry *m_Registry = nullptr;
+    DynamicAABBTree *m_Tree = nullptr;
+
+    std::vector<RenderQueueItem> m_Items;
+    std::vector<RenderQueueItem> m_Changed;
+    std::vector<RenderQueueItem> m_Scratch;
+    std::vector<entt::entity> m_Pending;
+    std::vector<uint32_t> m_Rekeyed;
+    std::vector<uint32_t> m_ItemIndices; // by entity index, rebuilt whenever items move
+    std::vector<std::pair<entt::entity, int32_t>> m_RemovedProxies;
+    BoundsSoA m_Bounds;
+    bool m_BoundsDirty = false;
+
+    std::unordered_map<const Shader *, uint16_t> m_ShaderIds;
+    std::unordered_map<const Model *, uint16_t> m_ModelIds;
+    std::unordered_map<uint64_t, uint16_t> m_MaterialIds;
+
+    glm::vec3 m_DepthOrigin = glm::vec3(0.0f);
+    bool m_HasDepthOrigin = false;
+    float m_DepthBucketSize = 4.0f;
+    size_t m_LastChangedCount = 0;
+};
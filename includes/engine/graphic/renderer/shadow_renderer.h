@@ -3,6 +3,8 @@
 #include <scene/scene.h>
 #include <graphic/renderer/shadow.h>
 #include <graphic/renderer/frustum.h>
+#include <graphic/renderer/culling.h>
+#include <graphic/renderer/render_queue.h>
 
 class ResourceManager;
 class Shader;
@@ -12,7 +14,7 @@ class ShadowRenderer
 public:
     void Init(ResourceManager &res);
     void Shutdown();
-    void RenderShadows(Scene &scene);
+    void RenderShadows(Scene &scene, const RenderQueue &queue);
 
     void SetEnableShadows(bool enable) { m_EnableShadows = enable; }
     void SetShadowMode(int mode) { m_ShadowMode = mode; }
@@ -21,6 +23,7 @@ public:
     
     void SetShadowProjectionSize(float size) { m_ShadowProjectionSize = size; }
     void SetShadowFrustumCulling(bool enable) { m_ShadowFrustumCullingEnabled = enable; }
+    void SetHierarchicalCulling(bool enable) { m_HierarchicalCulling = enable; }
     void SetShadowDistanceCulling(float distance) { m_ShadowDistanceCullingSq = distance * distance; }
 
     Shadow &GetShadow() { return m_Shadow; }
@@ -30,7 +33,13 @@ public:
     float GetFarPlaneSpot() const { return m_FarPlaneSpot; }
 
 private:
+    // Frustum (optional) + distance culling of queue items into m_Visibility, casters only
+    void CullShadowCasters(const RenderQueue &queue, const DynamicAABBTree *tree, const Frustum *lightFrustum, const glm::vec3 &camPos);
+    // Bone palette of an Animator or a BakedAnimation; hasAnimation = false for static casters
+    void ApplySkinning(Shader *shader, Scene &scene, entt::entity entity);
+
     Shadow m_Shadow;
+    VisibilityBits m_Visibility;
     
     glm::mat4 m_LightSpaceMatrixDir[Shadow::MAX_DIR_LIGHTS_SHADOW];
     glm::mat4 m_LightSpaceMatrixSpot[Shadow::MAX_SPOT_LIGHTS_SHADOW];
@@ -41,5 +50,6 @@ private:
     
     float m_ShadowProjectionSize = 20.0f;
     bool m_ShadowFrustumCullingEnabled = true;
+    bool m_HierarchicalCulling = true;
     float m_ShadowDistanceCullingSq = 10000.0f; // Default 100^2
 };
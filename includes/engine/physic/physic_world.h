@@ -1,9 +1,19 @@
 #pragma once
 
 #include <btBulletDynamicsCommon.h>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 #include <physic/debug_drawer.h>
+#include <physic/physics_motion_state.h>
+#include <physic/physics_body_pool.h>
+#include <physic/physics_shape_cache.h>
+
+class ThreadPool;
+class PhysicsTaskScheduler;
+class btConstraintSolverPoolMt;
 
 class PhysicsWorld
 {
@@ -14,28 +24,59 @@ public:
     void Update(float dt);
     void Clear();
 
+    // Pipelined stepping: BeginStep runs Update(dt) on the physics step thread and returns at once;
+    // WaitForStep blocks until it has finished. Every other member waits for the in-flight step
+    // first, so the world is never touched from two threads. Main thread only.
+    void BeginStep(float dt);
+    void WaitForStep();
+    bool IsStepping() const { return m_StepInFlight; }
+
+    // Waits for an in-flight step before handing the world out
     btDiscreteDynamicsWorld *GetWorld();
+    // Bodies come from a block pool; release them with DestroyRigidBody, never delete
     btRigidBody *CreateRigidBody(float mass, const btTransform &startTransform, btCollisionShape *shape);
+    // Removes the body from the world and frees it together with its motion state
+    void DestroyRigidBody(btRigidBody *body);
+    // Takes ownership of a shape that did not come from the shape cache
     void RegisterShape(btCollisionShape* shape);
+    PhysicsShapeCache &GetShapeCache() { return m_ShapeCache; }
+    size_t GetBodyCount() const { return m_BodyPool.GetLiveCount(); }
     
     // 0: Fast, 1: Balanced, 2: Accurate
     void SetMode(int mode);
 
+    // Non-null: rebuild as btDiscreteDynamicsWorldMt stepping on pool's workers. nullptr: back to
+    // the single-threaded world. Bodies and constraints are carried over. Main thread only.
+    void SetParallel(ThreadPool *pool);
+    bool IsParallel() const { return m_TaskScheduler != nullptr; }
+
     void AddConstraint(btTypedConstraint* constraint, bool disableCollisionsBetweenLinkedBodies = true);
     void RemoveConstraint(btTypedConstraint* constraint);
     
     DebugDrawer* GetDebugDrawer() { return debugDrawer.get(); }
 
+    // Dynamic bodies Bullet moved since the owner last cleared the list (bodies get a
+    // PhysicsMotionState from CreateRigidBody). Waits for an in-flight step.
+    PhysicsChangeList &GetPoseChanges();
+
 private:
     std::unique_ptr<btDefaultCollisionConfiguration> collisionConfig;
     std::unique_ptr<btCollisionDispatcher> dispatcher;
     std::unique_ptr<btBroadphaseInterface> overlappingPairCache;
-    std::unique_ptr<btSequentialImpulseConstraintSolver> solver;
+    std::unique_ptr<btConstraintSolver> solver;
+    std::unique_ptr<btConstraintSolverPoolMt> solverPool;
     std::unique_ptr<btDiscreteDynamicsWorld> dynamicsWorld;
+    std::unique_ptr<PhysicsTaskScheduler> m_TaskScheduler;
+
+    void CreateWorld(ThreadPool *pool);
+    void StepThreadLoop();
 
     std::unique_ptr<DebugDrawer> debugDrawer;
 
     std::vector<btCollisionShape *> m_collisionShapes;
+    PhysicsShapeCache m_ShapeCache;
+    PhysicsBodyPool m_BodyPool;
+    PhysicsChangeList m_PoseChanges;
     
     float m_linearSleepingThreshold = 0.8f;
     float m_angularSleepingThreshold = 1.0f;
@@ -43,4 +84,14 @@ private:
     // Simulation settings
     float m_timeStep = 1.0f / 60.0f;
     int m_maxSubSteps = 1;
+
+    // Started by the first BeginStep
+    std::thread m_StepThread;
+    std::mutex m_StepMutex;
+    std::condition_variable m_StepWake;
+    std::condition_variable m_StepDone;
+    bool m_StepPending = false; // guarded by m_StepMutex
+    bool m_StepStopping = false;
+    float m_StepDt = 0.0f;
+    bool m_StepInFlight = false; // main thread view: a step was begun and not yet waited for
 };
\ No newline at end of file
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <btBulletDynamicsCommon.h>
+#include <physic/physics_motion_state.h>
+#include <memory>
+#include <vector>
+
+// Rigid bodies and their motion states constructed side by side in fixed-size blocks: bulk-spawned
+// bodies cost one allocation per block instead of two per body, and end up next to each other.
+class PhysicsBodyPool
+{
+public:
+    PhysicsBodyPool() = default;
+    PhysicsBodyPool(const PhysicsBodyPool &) = delete;
+    PhysicsBodyPool &operator=(const PhysicsBodyPool &) = delete;
+
+    // info.m_motionState is replaced by a pooled PhysicsMotionState starting at startTransform
+    btRigidBody *Create(const btRigidBody::btRigidBodyConstructionInfo &info, const btTransform &startTransform, PhysicsChangeList &changes);
+    // The body must already be out of the world
+    void Destroy(btRigidBody *body);
+    bool Owns(const btRigidBody *body) const;
+
+    size_t GetLiveCount() const { return m_Live; }
+    size_t GetCapacity() const { return m_Blocks.size() * SLOTS_PER_BLOCK; }
+
+private:
+    static constexpr size_t SLOTS_PER_BLOCK = 256;
+
+    struct Slot
+    {
+        alignas(16) unsigned char body[sizeof(btRigidBody)];
+        alignas(16) unsigned char motionState[sizeof(PhysicsMotionState)];
+        Slot *nextFree = nullptr;
+    };
+
+    std::vector<std::unique_ptr<Slot[]>> m_Blocks;
+    Slot *m_FreeList = nullptr;
+    size_t m_Live = 0;
+};
@@ -1,29 +1,61 @@
 #pragma once
 
 #include <entt/entt.hpp>
-#include <unordered_set>
+#include <cstdint>
 #include <vector>
 
 class Scene;
 class PhysicsWorld;
 
-struct CollisionPair
+enum class CollisionEventType : uint8_t
+{
+    Enter,
+    Stay,
+    Exit
+};
+
+// One touching (or separating) pair from the last step; a is the lower entity id
+struct CollisionEvent
 {
     entt::entity a;
     entt::entity b;
-
-    bool operator==(const CollisionPair &other) const
-    {
-        return (a == other.a && b == other.b) || (a == other.b && b == other.a);
-    }
+    CollisionEventType type;
+    bool trigger;
 };
 
-struct CollisionPairHash
+// Open-addressed (linear probing) set of touching entity pairs that survives between steps. Each
+// step stamps the pairs it sees with its generation; pairs left with an older stamp have separated.
+class CollisionPairTable
 {
-    std::size_t operator()(const CollisionPair &k) const
+public:
+    struct Entry
     {
-        return std::hash<uint32_t>()((uint32_t)k.a) ^ std::hash<uint32_t>()((uint32_t)k.b);
+        uint64_t key = EMPTY;
+        uint32_t generation = 0;
+        bool trigger = false;
+    };
+
+    static constexpr uint64_t EMPTY = ~0ull;
+
+    static uint64_t MakeKey(entt::entity a, entt::entity b)
+    {
+        return (static_cast<uint64_t>(entt::to_integral(a)) << 32) | entt::to_integral(b);
     }
+
+    // Returns the entry for key, inserting it if missing; inserted is set when it was
+    Entry &FindOrInsert(uint64_t key, bool &inserted);
+    void Remove(uint64_t key);
+    void Clear();
+
+    std::vector<Entry> &GetEntries() { return m_Entries; }
+    size_t GetSize() const { return m_Size; }
+
+private:
+    void Grow();
+    size_t Home(uint64_t key) const;
+
+    std::vector<Entry> m_Entries;
+    size_t m_Size = 0;
 };
 
 class PhysicsCollisionDispatcher
@@ -32,11 +64,24 @@ public:
     PhysicsCollisionDispatcher(Scene& scene, PhysicsWorld& physics);
     ~PhysicsCollisionDispatcher();
 
+    // Diffs the world's manifolds against the pair table into the event buffer, then calls the
+    // On{Collision,Trigger}{Enter,Stay,Exit} hooks from the buffer
     void DispatchEvents();
 
+    // Events of the last DispatchEvents, valid until the next one
+    const std::vector<CollisionEvent> &GetEvents() const { return m_Events; }
+
 private:
+    void OnScriptsChanged(entt::registry &, entt::entity) { m_ListenersDirty = true; }
+    void UpdateListeners();
+    void Deliver(const CollisionEvent &event, entt::entity target, entt::entity other);
+
     Scene& m_Scene;
     PhysicsWorld& m_Physics;
 
-    std::unordered_set<CollisionPair, CollisionPairHash> m_activeCollisions;
+    CollisionPairTable m_Pairs;
+    uint32_t m_Generation = 0;
+    std::vector<CollisionEvent> m_Events;
+    std::vector<uint64_t> m_Separated;
+    bool m_ListenersDirty = true;
 };
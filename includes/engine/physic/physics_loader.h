@@ -2,11 +2,64 @@
 
 #include <scene/scene.h>
 #include <physic/physic_world.h>
-#include <sstream>
-#include <fstream>
+#include <scene/scene_tokenizer.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+enum class RigidBodyShapeType : uint8_t
+{
+    None,
+    Box,
+    Sphere,
+    Capsule,
+    Compound
+};
+
+enum class RigidBodyMotionType : uint8_t
+{
+    Unknown, // decided by mass
+    Static,
+    Dynamic,
+    Kinematic
+};
+
+// One SHAPE line of a COMPOUND body
+struct RigidBodyChildDesc
+{
+    RigidBodyShapeType shape = RigidBodyShapeType::None;
+    glm::vec3 size = glm::vec3(0.0f); // box half extents, (radius) or (radius, height)
+    glm::vec3 position = glm::vec3(0.0f);
+    glm::vec3 eulerDegrees = glm::vec3(0.0f);
+};
+
+// Everything a RIGIDBODY command describes, before any Bullet object exists
+struct RigidBodyDesc
+{
+    RigidBodyShapeType shape = RigidBodyShapeType::None;
+    glm::vec3 size = glm::vec3(0.0f); // box half extents or (radius, height)
+    float mass = 0.0f;
+    RigidBodyMotionType motion = RigidBodyMotionType::Unknown;
+    glm::vec3 centerOffset = glm::vec3(0.0f);
+    float restitution = 0.0f;
+    glm::vec3 angularFactor = glm::vec3(1.0f);
+    glm::vec3 linearFactor = glm::vec3(1.0f);
+    bool hasRotFactor = false;
+    bool isParentMatter = false;
+    bool isChildrenMatter = false;
+    bool isAttachedToParent = false;
+    std::vector<RigidBodyChildDesc> children;
+};
 
 class PhysicsLoader
 {
 public:
-    static void LoadRigidBody(Scene& scene, entt::entity entity, std::stringstream& ss, PhysicsWorld& physics, std::ifstream& file);
+    // A COMPOUND body consumes its SHAPE lines from lines, up to and including END_RIGIDBODY
+    static void LoadRigidBody(Scene& scene, entt::entity entity, SceneTokens& tokens, PhysicsWorld& physics, SceneLineReader& lines);
+
+    static RigidBodyDesc ParseRigidBody(SceneTokens& tokens, SceneLineReader& lines);
+    // Needs the entity's TransformComponent; reuses a RigidBodyComponent that is already there
+    static void CreateRigidBody(Scene& scene, entt::entity entity, const RigidBodyDesc& desc, PhysicsWorld& physics);
+    // The cached collision shape for desc, or nullptr for a shapeless body. Safe off the main thread.
+    static btCollisionShape* GetShape(const RigidBodyDesc& desc, PhysicsShapeCache& shapes);
 };
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <btBulletDynamicsCommon.h>
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <cstdint>
+#include <vector>
+
+class PhysicsMotionState;
+
+// World pose Bullet handed to a dynamic body's motion state during a step
+struct PhysicsPoseChange
+{
+    entt::entity entity;
+    const btRigidBody *body; // compared against RigidBodyComponent::body, never dereferenced
+    glm::vec3 position;
+    glm::quat rotation;
+};
+
+// Bodies that moved since the last Clear, one entry each (a later pose overwrites the earlier one).
+// Filled on whichever thread steps the world; read it only while no step is running.
+class PhysicsChangeList
+{
+public:
+    void Record(PhysicsMotionState &state, const btTransform &worldTransform);
+    void Clear();
+
+    const std::vector<PhysicsPoseChange> &GetChanges() const { return m_Changes; }
+
+private:
+    std::vector<PhysicsPoseChange> m_Changes;
+    uint32_t m_Generation = 1;
+};
+
+// btDefaultMotionState that also records every pose Bullet writes into a PhysicsChangeList. Bullet
+// only writes motion states of active bodies, so transform sync can skip everything asleep.
+class PhysicsMotionState : public btDefaultMotionState
+{
+public:
+    PhysicsMotionState(const btTransform &startTransform, PhysicsChangeList &changes);
+
+    void SetBody(const btRigidBody *body) { m_Body = body; }
+    const btRigidBody *GetBody() const { return m_Body; }
+
+    void setWorldTransform(const btTransform &worldTransform) override;
+
+private:
+    friend class PhysicsChangeList;
+
+    PhysicsChangeList &m_Changes;
+    const btRigidBody *m_Body = nullptr;
+    uint32_t m_Generation = 0; // list generation of m_Slot
+    uint32_t m_Slot = 0;
+};
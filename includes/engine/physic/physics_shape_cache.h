@@ -0,0 +1,44 @@
+#pragma once
+
+#include <btBulletDynamicsCommon.h>
+#include <glm/glm.hpp>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+// Shares collision shapes between bodies created with the same parameters; a scene of 11k identical
+// capsules then holds one shape. Shapes are owned by the cache and must be treated as immutable
+// (e.g. setLocalScaling would affect every body using the shape). Lookups are thread-safe so scene
+// streaming can build shapes on a worker; Clear is not, and needs every other user stopped.
+class PhysicsShapeCache
+{
+public:
+    using ChildShape = std::pair<btTransform, btCollisionShape *>;
+
+    btCollisionShape *GetBox(const glm::vec3 &halfExtents);
+    btCollisionShape *GetSphere(float radius);
+    btCollisionShape *GetCapsule(float radius, float height);
+    // Children must come from this cache
+    btCollisionShape *GetCompound(const std::vector<ChildShape> &children);
+    // shape moved by offset inside a compound (RIGIDBODY ... OFFSET)
+    btCollisionShape *GetOffset(btCollisionShape *shape, const glm::vec3 &offset);
+
+    bool Owns(const btCollisionShape *shape) const;
+    size_t GetUniqueCount() const;
+    size_t GetRequestCount() const;
+
+    void Clear();
+
+private:
+    btCollisionShape *Find(const std::string &key);
+    btCollisionShape *Insert(std::string key, btCollisionShape *shape);
+
+    std::unordered_map<std::string, std::unique_ptr<btCollisionShape>> m_Shapes;
+    std::unordered_set<const btCollisionShape *> m_Owned;
+    size_t m_Requests = 0;
+    mutable std::mutex m_Mutex;
+};
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <LinearMath/btThreads.h>
+
+class ThreadPool;
+
+// Runs Bullet's btParallelFor / btParallelSum on the engine's ThreadPool, so the Mt world shares
+// workers with the rest of the engine instead of starting its own
+class PhysicsTaskScheduler : public btITaskScheduler
+{
+public:
+    explicit PhysicsTaskScheduler(ThreadPool &pool);
+
+    int getMaxNumThreads() const override;
+    int getNumThreads() const override;
+    void setNumThreads(int numThreads) override;
+    void parallelFor(int iBegin, int iEnd, int grainSize, const btIParallelForBody &body) override;
+    btScalar parallelSum(int iBegin, int iEnd, int grainSize, const btIParallelSumBody &body) override;
+
+private:
+    ThreadPool &m_Pool;
+};
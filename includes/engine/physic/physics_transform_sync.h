@@ -1,11 +1,20 @@
-#include <unordered_map>
-#include <engine/ecs/cached_query.h>
+#pragma once
+
 #include <engine/ecs/component.h>
 #include <glm/glm.hpp>
+#include <vector>
 
 class Scene;
 class PhysicsWorld;
 
+// Bodies touched by the last sync, for the overlay and axis_bench
+struct PhysicsSyncStats
+{
+    int bodies = 0;
+    int toPhysics = 0;   // kinematic/static children pushed into Bullet
+    int fromPhysics = 0; // dynamic bodies Bullet moved, written back to transforms
+};
+
 class PhysicsTransformSync
 {
 public:
@@ -13,20 +22,38 @@ public:
     ~PhysicsTransformSync();
 
     void Init();
+    // Pushes static/kinematic bodies whose parented world matrix changed since they were last pushed
     void SyncToPhysics();
+    // Writes back only the bodies in PhysicsWorld's change list, then clears it
     void SyncFromPhysics();
+
+    // Pipelined physics: CaptureSnapshot shifts each moved body's current pose to previous and takes
+    // the change list as current; ApplySnapshot writes the blend at alpha into the transforms
+    void CaptureSnapshot();
+    void ApplySnapshot(float alpha);
+    void ResetSnapshots();
+
+    const PhysicsSyncStats &GetStats() const { return m_Stats; }
     
     // Legacy support (optional)
     void SyncTransformToPhysics(entt::entity entity);
     void SyncPhysicsToTransform(entt::entity entity);
 
 private:
-    glm::mat4 GetCachedWorldMatrix(entt::entity entity);
+    void OnBodiesChanged(entt::registry &, entt::entity) { m_NeedsRebuild = true; }
+    void Rebuild();
+    void WriteWorldPose(TransformComponent &transform, const RigidBodyComponent &rb, const glm::vec3 &worldPos, const glm::quat &worldRot);
 
     Scene& m_Scene;
     PhysicsWorld& m_Physics;
 
-    CachedQuery<RigidBodyComponent, TransformComponent> m_simulationQuery;
-    std::unordered_map<entt::entity, glm::mat4> m_worldMatrixCache;
+    // Static and kinematic bodies, with the world version of their transform last pushed to Bullet
+    std::vector<entt::entity> m_DrivenEntities;
+    std::vector<uint32_t> m_DrivenVersions;
+    // Bodies whose snapshot is blending (pipelined)
+    std::vector<entt::entity> m_MovingEntities;
+
+    PhysicsSyncStats m_Stats;
+    bool m_NeedsRebuild = true;
     bool m_initialized = false;
 };
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <graphic/geometry/animation.h>
+#include <graphic/geometry/baked_animation.h>
 #include <string>
 #include <map>
 #include <memory>
@@ -11,11 +12,17 @@ public:
     AnimationCache();
     ~AnimationCache();
 
-    void LoadAnimation(const std::string& name, const std::string& path, Model* model);
+    // compression == nullptr keeps the float keys
+    void LoadAnimation(const std::string& name, const std::string& path, Model* model, const ClipCompressionSettings* compression = nullptr);
     Animation* GetAnimation(const std::string& name);
+
+    // Bakes already loaded clips into one texture for instanced crowds of model
+    void BakeAnimation(const std::string& name, Model* model, const std::vector<std::string>& clipNames, float framesPerSecond);
+    BakedAnimation* GetBakedAnimation(const std::string& name);
     
     void Clear();
 
 private:
     std::map<std::string, std::unique_ptr<Animation>> m_Animations;
+    std::map<std::string, std::unique_ptr<BakedAnimation>> m_BakedAnimations;
 };
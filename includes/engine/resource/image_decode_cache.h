@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// RGBA8 pixels, shared between every model that references the same image
+struct DecodedImage
+{
+    int width = 0;
+    int height = 0;
+    std::vector<unsigned char> pixels;
+};
+
+// Path-keyed image decodes shared across model imports. Threads asking for a key that is already being
+// decoded wait for that decode instead of starting their own. Entries are held weakly, so pixels live
+// only while some import still holds them (usually until its GL upload) and then go away.
+class ImageDecodeCache
+{
+public:
+    using Handle = std::shared_ptr<const DecodedImage>;
+
+    struct Stats
+    {
+        size_t requests = 0;
+        size_t decodes = 0; // requests that ran the decoder; the rest were served by the cache
+    };
+
+    static ImageDecodeCache &Instance();
+
+    ImageDecodeCache(const ImageDecodeCache &) = delete;
+    ImageDecodeCache &operator=(const ImageDecodeCache &) = delete;
+
+    // Thread-safe. decode fills the image and returns false on failure, which yields nullptr and is not
+    // remembered. decoded (optional) tells whether this call ran decode itself.
+    Handle Decode(const std::string &key, const std::function<bool(DecodedImage &)> &decode, bool *decoded = nullptr);
+
+    // Drops keys whose pixels are gone
+    void Trim();
+    Stats GetStats() const;
+
+private:
+    ImageDecodeCache() = default;
+
+    struct Entry
+    {
+        std::weak_ptr<const DecodedImage> image;
+        std::shared_future<Handle> pending; // valid while the first requester decodes
+    };
+
+    mutable std::mutex m_Mutex;
+    std::unordered_map<std::string, Entry> m_Entries;
+    Stats m_Stats;
+};
@@ -20,6 +20,8 @@ public:
     ~ModelInstanceManager();
 
     Model* GetOrLoadModel(const std::string& name, const std::string& path, bool isStatic = false);
+    // Takes ownership of a model built elsewhere; if the name is taken the new one is deleted
+    Model* AddModel(const std::string& name, Model* model);
     void AddInstance(const std::string& modelPath, const glm::mat4& transform, entt::entity entity);
     void RemoveInstance(const std::string& modelPath, entt::entity entity);
     
@@ -35,9 +35,13 @@ public:
     void UnloadTexture(const std::string& name);
     
     void LoadModel(const std::string& name, const std::string& path, bool isStatic = false);
+    // Finishes a load whose Model::Import ran elsewhere (scene streaming). Main thread.
+    void LoadModel(const std::string& name, ModelImportData&& data, bool isStatic = false);
+    bool HasModel(const std::string& name) const { return m_ModelPaths.count(name) != 0; }
     void UnloadModel(const std::string& name);
     
-    void LoadAnimation(const std::string& name, const std::string& path, const std::string& modelName);
+    void LoadAnimation(const std::string& name, const std::string& path, const std::string& modelName, const ClipCompressionSettings* compression = nullptr);
+    void BakeAnimation(const std::string& name, const std::string& modelName, const std::vector<std::string>& clipNames, float framesPerSecond = 30.0f);
     void LoadFont(const std::string& name, const std::string& path, unsigned int fontSize);
     void LoadSound(const std::string& name, const std::string& path, irrklang::ISoundEngine* engine);
     void LoadSkybox(const std::string& name, const std::vector<std::string>& faces);
@@ -47,6 +51,7 @@ public:
     Texture* GetTexture(const std::string& name);
     Model* GetModel(const std::string& name);
     Animation* GetAnimation(const std::string& name);
+    BakedAnimation* GetBakedAnimation(const std::string& name);
     Font* GetFont(const std::string& name);
     irrklang::ISoundSource* GetSound(const std::string& name);
     Skybox* GetSkybox(const std::string& name);
@@ -4,13 +4,15 @@
 #include <resource/resource_manager.h>
 #include <audio/sound_manager.h>
 #include <app/application.h>
+#include <scene/scene_tokenizer.h>
 #include <sstream>
 
 class ComponentLoader
 {
 public:
-    static void LoadRenderer(Scene &scene, entt::entity entity, std::stringstream &ss, ResourceManager &res);
+    static void LoadRenderer(Scene &scene, entt::entity entity, SceneTokens &tokens, ResourceManager &res);
     static void LoadAnimator(Scene &scene, entt::entity entity, std::stringstream &ss, ResourceManager &res);
+    static void LoadBakedAnimator(Scene &scene, entt::entity entity, std::stringstream &ss, ResourceManager &res);
     static void LoadLightDir(Scene &scene, entt::entity entity, std::stringstream &ss);
     static void LoadLightPoint(Scene &scene, entt::entity entity, std::stringstream &ss);
     static void LoadLightSpot(Scene &scene, entt::entity entity, std::stringstream &ss);
@@ -26,6 +28,7 @@ public:
     static void LoadAudioSource(Scene &scene, entt::entity entity, std::stringstream &ss);
     static void LoadVideoPlayer(Scene &scene, entt::entity entity, std::stringstream &ss);
     static void LoadParticleEmitter(Scene &scene, entt::entity entity, std::stringstream &ss, ResourceManager &res);
-    static void LoadMaterial(Scene &scene, entt::entity entity, std::stringstream &ss);
+    static void LoadMaterial(Scene &scene, entt::entity entity, SceneTokens &tokens);
+    static MaterialComponent ParseMaterial(SceneTokens &tokens);
     static void LoadCamera(Scene &scene, entt::entity entity, std::stringstream &ss);
 };
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+// Binary layout written by SceneCooker and read by SceneLoader. Every section is a packed array of
+// one record type at a 4-byte aligned offset from the start of the file, so a mapped file is read
+// in place. Native byte order; bump VERSION whenever a record changes.
+namespace CookedScene
+{
+    constexpr char MAGIC[8] = {'A', 'X', 'S', 'C', 'E', 'N', 'E', '\0'};
+    constexpr uint32_t VERSION = 1;
+    constexpr uint32_t NO_ENTITY = ~0u;
+    // "level.scene" cooks to "level.scenec" next to it
+    constexpr std::string_view EXTENSION = ".scenec";
+
+    struct Section
+    {
+        uint32_t offset = 0; // bytes from the start of the file
+        uint32_t count = 0;  // records (bytes for stringData)
+    };
+
+    struct Header
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t fileSize;
+
+        Section strings;      // StringRef
+        Section resources;    // Command: LOAD_* and CONFIG, replayed before any entity exists
+        Section entities;     // Entity, in NEW_ENTITY order
+        Section transforms;   // Transform
+        Section renderers;    // Renderer
+        Section materials;    // Material
+        Section bodies;       // Body
+        Section bodyChildren; // BodyChild, referenced by Body::firstChild
+        Section commands;     // Command: every other line, replayed once bodies exist
+        Section stringData;   // UTF-8 bytes of every string, not terminated
+    };
+
+    struct StringRef
+    {
+        uint32_t offset; // into stringData
+        uint32_t length;
+    };
+
+    // A line kept as text; args is everything after the command word
+    struct Command
+    {
+        uint32_t entity;  // index into entities, or NO_ENTITY
+        uint32_t args;    // string
+        uint32_t command; // SceneCommand
+    };
+
+    struct Entity
+    {
+        uint32_t name;
+        uint32_t tag;
+    };
+
+    struct Transform
+    {
+        uint32_t entity;
+        glm::vec3 position;
+        glm::quat rotation;
+        glm::vec3 scale;
+    };
+
+    struct Renderer
+    {
+        uint32_t entity;
+        uint32_t model;  // string
+        uint32_t shader; // string
+    };
+
+    struct Material
+    {
+        uint32_t entity;
+        uint32_t type; // MaterialType
+        float roughness;
+        float opacity;
+        glm::vec3 emission;
+        float shininess;
+        glm::vec3 specular;
+        glm::vec3 ambient;
+        float metallic;
+        float ao;
+        glm::vec2 uvScale;
+        glm::vec2 uvOffset;
+    };
+
+    enum BodyFlags : uint8_t
+    {
+        BODY_HAS_ROT_FACTOR = 1 << 0,
+        BODY_PARENT_MATTER = 1 << 1,
+        BODY_CHILDREN_MATTER = 1 << 2,
+        BODY_ATTACH_TO_PARENT = 1 << 3
+    };
+
+    struct Body
+    {
+        uint32_t entity;
+        uint8_t shape;  // RigidBodyShapeType
+        uint8_t motion; // RigidBodyMotionType
+        uint8_t flags;  // BodyFlags
+        uint8_t padding;
+        glm::vec3 size;
+        float mass;
+        glm::vec3 centerOffset;
+        float restitution;
+        glm::vec3 angularFactor;
+        glm::vec3 linearFactor;
+        uint32_t firstChild;
+        uint32_t childCount;
+    };
+
+    struct BodyChild
+    {
+        uint32_t shape; // RigidBodyShapeType
+        glm::vec3 size;
+        glm::vec3 position;
+        glm::vec3 eulerDegrees;
+    };
+
+    static_assert(sizeof(glm::vec3) == 12 && sizeof(glm::quat) == 16, "cooked records assume tightly packed glm types");
+    static_assert(std::is_trivially_copyable_v<Transform> && std::is_trivially_copyable_v<Material> &&
+                      std::is_trivially_copyable_v<Body> && std::is_trivially_copyable_v<BodyChild>,
+                  "cooked records are read in place");
+    static_assert(alignof(Header) == 4 && alignof(Transform) == 4 && alignof(Material) == 4 && alignof(Body) == 4,
+                  "sections are only 4-byte aligned");
+}
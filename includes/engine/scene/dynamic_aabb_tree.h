@@ -0,0 +1,296 @@
+#pragma once
+
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+#include <graphic/renderer/frustum.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+// Incremental bounding-volume hierarchy over scene entities, in the spirit of Bullet's btDbvt
+// and Box2D's b2DynamicTree: leaves hold fattened AABBs so small moves are free, inserts pick the
+// sibling by surface-area cost and the tree is rebalanced with rotations on the way back up.
+//
+// Each leaf (proxy) carries the entity it belongs to plus a free 32-bit user value; the render
+// queue stores its item index there.
+class DynamicAABBTree
+{
+public:
+    static constexpr int32_t NULL_NODE = -1;
+
+    int32_t CreateProxy(const glm::vec3 &min, const glm::vec3 &max, entt::entity entity, uint32_t userData = 0);
+    void DestroyProxy(int32_t proxyId);
+
+    // Returns true when the tight box escaped the fat box and the leaf was reinserted
+    bool MoveProxy(int32_t proxyId, const glm::vec3 &min, const glm::vec3 &max);
+
+    void SetUserData(int32_t proxyId, uint32_t userData) { m_Nodes[proxyId].userData = userData; }
+    uint32_t GetUserData(int32_t proxyId) const { return m_Nodes[proxyId].userData; }
+    entt::entity GetEntity(int32_t proxyId) const { return m_Nodes[proxyId].entity; }
+    const glm::vec3 &GetFatMin(int32_t proxyId) const { return m_Nodes[proxyId].min; }
+    const glm::vec3 &GetFatMax(int32_t proxyId) const { return m_Nodes[proxyId].max; }
+
+    void Clear();
+
+    void SetMargin(float margin) { m_Margin = margin; }
+    int32_t GetHeight() const { return m_Root == NULL_NODE ? 0 : m_Nodes[m_Root].height; }
+    size_t GetProxyCount() const { return m_ProxyCount; }
+
+    // fn(proxyId) -> bool; return false to stop
+    template <typename Fn>
+    void QueryBox(const glm::vec3 &min, const glm::vec3 &max, Fn &&fn) const;
+
+    template <typename Fn>
+    void QuerySphere(const glm::vec3 &center, float radius, Fn &&fn) const;
+
+    // fn(proxyId, entryDistance) -> float; the returned value clips the ray (return 0 to stop)
+    template <typename Fn>
+    void Raycast(const glm::vec3 &origin, const glm::vec3 &direction, float maxDistance, Fn &&fn) const;
+
+    // Slab test of the ray origin + t * dir, t >= 0, with invDir = 1 / dir. Axes the ray runs
+    // parallel to (infinite invDir) are tested by origin containment, so no 0 * inf NaNs
+    static bool IntersectRay(const glm::vec3 &origin, const glm::vec3 &invDir, const glm::vec3 &min, const glm::vec3 &max, float &entry, float &exit);
+
+    // Hierarchical frustum (+ optional distance) culling. Subtrees fully inside the frustum are
+    // emitted without further plane tests. fn(proxyId); maxDistanceSq <= 0 disables the distance test.
+    template <typename Fn>
+    void QueryFrustum(const Frustum &frustum, const glm::vec3 &point, float maxDistanceSq, Fn &&fn) const;
+
+private:
+    struct Node
+    {
+        glm::vec3 min = glm::vec3(0.0f);
+        glm::vec3 max = glm::vec3(0.0f);
+        int32_t parent = NULL_NODE; // next free node while in the free list
+        int32_t child1 = NULL_NODE;
+        int32_t child2 = NULL_NODE;
+        int32_t height = -1;        // leaf = 0, free = -1
+        entt::entity entity = entt::null;
+        uint32_t userData = 0;
+
+        bool IsLeaf() const { return child1 == NULL_NODE; }
+    };
+
+    // Depth-first traversal stack; spills to the heap only for pathological trees
+    class Stack
+    {
+    public:
+        void Push(int32_t value)
+        {
+            if (m_Size < LOCAL_CAPACITY)
+                m_Local[m_Size] = value;
+            else
+                m_Heap.push_back(value);
+            ++m_Size;
+        }
+
+        int32_t Pop()
+        {
+            --m_Size;
+            if (m_Size < LOCAL_CAPACITY)
+                return m_Local[m_Size];
+            int32_t value = m_Heap.back();
+            m_Heap.pop_back();
+            return value;
+        }
+
+        bool Empty() const { return m_Size == 0; }
+
+    private:
+        static constexpr size_t LOCAL_CAPACITY = 128;
+        int32_t m_Local[LOCAL_CAPACITY];
+        std::vector<int32_t> m_Heap;
+        size_t m_Size = 0;
+    };
+
+    int32_t AllocateNode();
+    void FreeNode(int32_t nodeId);
+    void InsertLeaf(int32_t leaf);
+    void RemoveLeaf(int32_t leaf);
+    int32_t Balance(int32_t nodeId);
+    void Refit(int32_t nodeId);
+
+    static float SurfaceArea(const glm::vec3 &min, const glm::vec3 &max)
+    {
+        glm::vec3 d = max - min;
+        return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+    }
+
+    static bool Overlaps(const Node &node, const glm::vec3 &min, const glm::vec3 &max)
+    {
+        return node.min.x <= max.x && node.max.x >= min.x &&
+               node.min.y <= max.y && node.max.y >= min.y &&
+               node.min.z <= max.z && node.max.z >= min.z;
+    }
+
+    static float DistanceSq(const Node &node, const glm::vec3 &point)
+    {
+        glm::vec3 d = glm::max(node.min - point, glm::max(glm::vec3(0.0f), point - node.max));
+        return glm::dot(d, d);
+    }
+
+    std::vector<Node> m_Nodes;
+    int32_t m_Root = NULL_NODE;
+    int32_t m_FreeList = NULL_NODE;
+    size_t m_ProxyCount = 0;
+    float m_Margin = 0.1f;
+};
+
+template <typename Fn>
+void DynamicAABBTree::QueryBox(const glm::vec3 &min, const glm::vec3 &max, Fn &&fn) const
+{
+    if (m_Root == NULL_NODE)
+        return;
+
+    Stack stack;
+    stack.Push(m_Root);
+    while (!stack.Empty())
+    {
+        int32_t nodeId = stack.Pop();
+        const Node &node = m_Nodes[nodeId];
+        if (!Overlaps(node, min, max))
+            continue;
+
+        if (node.IsLeaf())
+        {
+            if (!fn(nodeId))
+                return;
+        }
+        else
+        {
+            stack.Push(node.child1);
+            stack.Push(node.child2);
+        }
+    }
+}
+
+template <typename Fn>
+void DynamicAABBTree::QuerySphere(const glm::vec3 &center, float radius, Fn &&fn) const
+{
+    if (m_Root == NULL_NODE)
+        return;
+
+    float radiusSq = radius * radius;
+    Stack stack;
+    stack.Push(m_Root);
+    while (!stack.Empty())
+    {
+        int32_t nodeId = stack.Pop();
+        const Node &node = m_Nodes[nodeId];
+        if (DistanceSq(node, center) > radiusSq)
+            continue;
+
+        if (node.IsLeaf())
+        {
+            if (!fn(nodeId))
+                return;
+        }
+        else
+        {
+            stack.Push(node.child1);
+            stack.Push(node.child2);
+        }
+    }
+}
+
+inline bool DynamicAABBTree::IntersectRay(const glm::vec3 &origin, const glm::vec3 &invDir, const glm::vec3 &min, const glm::vec3 &max, float &entry, float &exit)
+{
+    entry = 0.0f;
+    exit = INFINITY;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        if (!std::isfinite(invDir[axis]))
+        {
+            if (origin[axis] < min[axis] || origin[axis] > max[axis])
+                return false;
+            continue;
+        }
+
+        float t0 = (min[axis] - origin[axis]) * invDir[axis];
+        float t1 = (max[axis] - origin[axis]) * invDir[axis];
+        entry = (std::max)(entry, (std::min)(t0, t1));
+        exit = (std::min)(exit, (std::max)(t0, t1));
+    }
+    return entry <= exit;
+}
+
+template <typename Fn>
+void DynamicAABBTree::Raycast(const glm::vec3 &origin, const glm::vec3 &direction, float maxDistance, Fn &&fn) const
+{
+    if (m_Root == NULL_NODE)
+        return;
+
+    glm::vec3 invDir = 1.0f / direction;
+    float clip = maxDistance;
+
+    Stack stack;
+    stack.Push(m_Root);
+    while (!stack.Empty())
+    {
+        int32_t nodeId = stack.Pop();
+        const Node &node = m_Nodes[nodeId];
+
+        float entry, exit;
+        if (!IntersectRay(origin, invDir, node.min, node.max, entry, exit) || entry > clip)
+            continue;
+
+        if (node.IsLeaf())
+        {
+            clip = fn(nodeId, entry);
+            if (clip <= 0.0f)
+                return;
+        }
+        else
+        {
+            stack.Push(node.child1);
+            stack.Push(node.child2);
+        }
+    }
+}
+
+template <typename Fn>
+void DynamicAABBTree::QueryFrustum(const Frustum &frustum, const glm::vec3 &point, float maxDistanceSq, Fn &&fn) const
+{
+    if (m_Root == NULL_NODE)
+        return;
+
+    bool useDistance = maxDistanceSq > 0.0f;
+
+    // Low bit marks a subtree already known to be fully inside the frustum and distance
+    Stack stack;
+    stack.Push(m_Root << 1);
+    while (!stack.Empty())
+    {
+        int32_t entry = stack.Pop();
+        int32_t nodeId = entry >> 1;
+        bool inside = entry & 1;
+        const Node &node = m_Nodes[nodeId];
+
+        if (!inside)
+        {
+            if (useDistance && DistanceSq(node, point) > maxDistanceSq)
+                continue;
+
+            FrustumResult result = frustum.ClassifyBox(node.min, node.max);
+            if (result == FrustumResult::Outside)
+                continue;
+
+            if (result == FrustumResult::Inside)
+            {
+                glm::vec3 farthest = glm::max(glm::abs(node.min - point), glm::abs(node.max - point));
+                inside = !useDistance || glm::dot(farthest, farthest) <= maxDistanceSq;
+            }
+        }
+
+        if (node.IsLeaf())
+        {
+            fn(nodeId);
+        }
+        else
+        {
+            stack.Push((node.child1 << 1) | (inside ? 1 : 0));
+            stack.Push((node.child2 << 1) | (inside ? 1 : 0));
+        }
+    }
+}
@@ -2,8 +2,8 @@
 
 #include <sstream>
 #include <string>
-#include <fstream>
 #include <entt/entt.hpp>
+#include <scene/scene_tokenizer.h>
 
 class Scene;
 class ResourceManager;
@@ -15,9 +15,10 @@ namespace SceneHandlers
     class ComponentCommandHandler
     {
     public:
-        static void HandleRenderer(std::stringstream &ss, Scene &scene, entt::entity entity, ResourceManager &res);
+        static void HandleRenderer(SceneTokens &tokens, Scene &scene, entt::entity entity, ResourceManager &res);
         static void HandleAnimator(std::stringstream &ss, Scene &scene, entt::entity entity, ResourceManager &res);
-        static void HandleMaterial(std::stringstream &ss, Scene &scene, entt::entity entity);
+        static void HandleBakedAnimator(std::stringstream &ss, Scene &scene, entt::entity entity, ResourceManager &res);
+        static void HandleMaterial(SceneTokens &tokens, Scene &scene, entt::entity entity);
         static void HandleVideoMap(std::stringstream &ss, Scene &scene, entt::entity entity);
 
         static void HandleDirectionalLight(std::stringstream &ss, Scene &scene, entt::entity entity);
@@ -26,8 +27,9 @@ namespace SceneHandlers
 
         static void HandleCamera(std::stringstream &ss, Scene &scene, entt::entity entity);
 
-        static void HandleRigidBody(std::stringstream &ss, Scene &scene, entt::entity entity,
-                                    PhysicsWorld &phys, std::ifstream &file);
+        // COMPOUND bodies read their SHAPE lines from lines, up to END_RIGIDBODY
+        static void HandleRigidBody(SceneTokens &tokens, Scene &scene, entt::entity entity,
+                                    PhysicsWorld &phys, SceneLineReader &lines);
 
         static void HandleUITransform(std::stringstream &ss, Scene &scene, entt::entity entity);
         static void HandleUIRenderer(std::stringstream &ss, Scene &scene, entt::entity entity, ResourceManager &res);
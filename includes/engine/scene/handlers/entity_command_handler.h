@@ -5,16 +5,20 @@
 #include <vector>
 #include <map>
 #include <entt/entt.hpp>
+#include <scene/scene_tokenizer.h>
 
 class Scene;
+struct TransformComponent;
 
 namespace SceneHandlers
 {
     class EntityCommandHandler
     {
     public:
-        static entt::entity HandleNewEntity(std::stringstream &ss, Scene &scene);
-        static void HandleTransform(std::stringstream &ss, Scene &scene, entt::entity entity);
+        static entt::entity HandleNewEntity(SceneTokens &tokens, Scene &scene);
+        static void HandleTransform(SceneTokens &tokens, Scene &scene, entt::entity entity);
+        // Position, euler degrees and scale of a TRANSFORM line
+        static void ReadTransform(SceneTokens &tokens, TransformComponent &transform);
         static void HandleParent(std::stringstream &ss, Scene &scene, entt::entity entity);
         static void HandleChildren(
             std::stringstream &ss,
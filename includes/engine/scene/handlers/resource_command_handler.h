@@ -14,6 +14,7 @@ namespace SceneHandlers
         static void HandleLoadShader(std::stringstream &ss, ResourceManager &res);
         static void HandleLoadModel(std::stringstream &ss, ResourceManager &res, bool isStatic);
         static void HandleLoadAnimation(std::stringstream &ss, ResourceManager &res);
+        static void HandleBakeAnimation(std::stringstream &ss, ResourceManager &res);
         static void HandleLoadFont(std::stringstream &ss, ResourceManager &res);
         static void HandleLoadSound(std::stringstream &ss, ResourceManager &res, SoundManager &sound);
         static void HandleLoadSkybox(std::stringstream &ss, ResourceManager &res);
@@ -5,10 +5,20 @@
 #include <scene/light_manager.h>
 #include <scene/camera_manager.h>
 #include <scene/entity_factory.h>
+#include <scene/dynamic_aabb_tree.h>
+#include <scene/scene_name_index.h>
 #include <memory>
+#include <string_view>
 
 class SceneManager;
 
+struct SceneRaycastHit
+{
+    entt::entity entity = entt::null;
+    float distance = 0.0f;
+    glm::vec3 point = glm::vec3(0.0f);
+};
+
 struct Scene
 {
     entt::registry registry;
@@ -26,6 +36,30 @@ struct Scene
     CameraManager &GetCameraManager() { return *cameraManager; }
     EntityFactory &GetEntityFactory() { return *entityFactory; }
 
+    // Spatial queries over rendered entities (WorldBoundsComponent), answered by the scene's
+    // AABB tree. Bounds are refreshed by the render queue once per frame.
+    std::vector<entt::entity> QueryBox(const glm::vec3 &min, const glm::vec3 &max) const;
+    std::vector<entt::entity> QuerySphere(const glm::vec3 &center, float radius) const;
+    // Nearest world AABB hit along the ray; direction does not need to be normalized
+    bool Raycast(const glm::vec3 &origin, const glm::vec3 &direction, float maxDistance, SceneRaycastHit &hit) const;
+
+    // Lookups by InfoComponent name/tag, answered by the scene's name index instead of a view scan
+    entt::entity FindByName(std::string_view name) const;
+    std::vector<entt::entity> FindByTag(std::string_view tag) const;
+    // Renames through registry.patch so the index sees the change
+    void RenameEntity(entt::entity entity, const std::string &name);
+    void SetEntityTag(entt::entity entity, const std::string &tag);
+
+    SceneNameIndex &GetNameIndex() { return m_NameIndex; }
+    const SceneNameIndex &GetNameIndex() const { return m_NameIndex; }
+
+    DynamicAABBTree &GetSpatialTree() { return m_SpatialTree; }
+    const DynamicAABBTree &GetSpatialTree() const { return m_SpatialTree; }
+
+    // Bumped by every camera cull; components stamp it when drawn. 0 = nothing culled yet
+    uint32_t GetVisibilityFrame() const { return m_VisibilityFrame; }
+    void AdvanceVisibilityFrame() { ++m_VisibilityFrame; }
+
     void InitializeManagers();
     void ShutdownManagers();
 
@@ -34,6 +68,10 @@ private:
     std::unique_ptr<CameraManager> cameraManager;
     std::unique_ptr<EntityFactory> entityFactory;
     
+    DynamicAABBTree m_SpatialTree;
+    SceneNameIndex m_NameIndex{registry};
+
     entt::entity m_ActiveSkybox = entt::null;
     entt::entity m_ActiveCamera = entt::null;
+    uint32_t m_VisibilityFrame = 0;
 };
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+struct SceneCookStats
+{
+    size_t entities = 0;
+    size_t transforms = 0;
+    size_t renderers = 0;
+    size_t materials = 0;
+    size_t bodies = 0;
+    size_t commands = 0; // lines kept as text, resources included
+    size_t strings = 0;
+    size_t bytes = 0;
+};
+
+// Compiles a text .scene into the binary layout in cooked_scene_format.h. Needs no GPU, window or
+// physics world: nothing is loaded, only parsed. The text file stays the source of truth.
+class SceneCooker
+{
+public:
+    // Both paths as given (no FileSystem::getPath); false and a logged error on failure
+    static bool Cook(const std::string &scenePath, const std::string &outPath, SceneCookStats *stats = nullptr);
+    // The same compile into memory; touches no shared state, so it can run on a worker thread
+    static void CookText(std::string_view text, std::string &blob, SceneCookStats *stats = nullptr);
+
+    static std::string GetCookedPath(const std::string &scenePath);
+    // A cooked file that exists and is at least as new as its source
+    static bool IsCookedUpToDate(const std::string &scenePath, const std::string &cookedPath);
+};
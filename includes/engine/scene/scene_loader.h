@@ -1,17 +1,62 @@
 #pragma once
 
+#include <map>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 #include <entt/entt.hpp>
+#include <scene/scene_tokenizer.h>
 
 class Scene;
 class ResourceManager;
 class PhysicsWorld;
 class SoundManager;
 class Application;
+class PhysicsShapeCache;
+
+// What the text and cooked paths share while one scene file loads
+struct SceneLoadContext
+{
+    Scene &scene;
+    ResourceManager &res;
+    PhysicsWorld &phys;
+    SoundManager &sound;
+    Application *app;
+
+    SceneLoadContext(Scene &scene, ResourceManager &res, PhysicsWorld &phys, SoundManager &sound, Application *app)
+        : scene(scene), res(res), phys(phys), sound(sound), app(app) {}
+
+    entt::entity currentEntity = entt::null;
+    std::map<entt::entity, std::vector<std::string>> deferredChildren;
+};
 
 class SceneLoader
 {
 public:
+    // "x.scene" loads from "x.scenec" instead when scene_cook has produced one at least as new as the
+    // text; a cooked path can also be passed directly
     static std::vector<entt::entity> Load(const std::string& path, Scene& scene, ResourceManager& res, PhysicsWorld& phys, SoundManager& sound, Application* app);
+
+    static bool IsCookedScene(std::string_view data);
+
+private:
+    friend class SceneStream;
+
+    static void LoadText(std::string_view text, SceneLoadContext &context, std::vector<entt::entity> &loadedEntities);
+    // False, with nothing loaded, when the blob is from another version or damaged. Without
+    // replayResources the LOAD_* and CONFIG lines are skipped (their resources are already loaded).
+    static bool LoadCooked(std::string_view blob, SceneLoadContext &context, std::vector<entt::entity> &loadedEntities, bool replayResources = true);
+    // Hierarchy, light, physics and camera checks plus the summary log, after either path
+    static void FinishLoad(const std::string &fullPath, SceneLoadContext &context, const std::vector<entt::entity> &loadedEntities);
+
+    // Worker-safe helpers for SceneStream: nothing here touches the scene, GPU or physics world
+    static bool IsValidCooked(std::string_view blob);
+    // The cooked form of fullPath: a fresh, valid sibling .scenec, or else the text cooked in memory
+    static bool ReadCooked(const std::string &fullPath, std::string &blob);
+    // Both expect a blob that passed IsValidCooked
+    static void GetCookedResources(std::string_view blob, std::vector<std::pair<SceneCommand, std::string_view>> &resources);
+    static size_t BuildCookedShapes(std::string_view blob, PhysicsShapeCache &shapes);
+    // Commands whose handlers still read a stream; args is the line after the command word
+    static void RunStreamCommand(SceneCommand command, std::string_view args, SceneLoadContext &context);
 };
@@ -4,8 +4,11 @@
 #include <string>
 #include <vector>
 #include <unordered_map>
+#include <functional>
+#include <memory>
 
 #include <scene/scene.h>
+#include <scene/scene_stream.h>
 #include <resource/resource_manager.h>
 #include <audio/sound_manager.h>
 #include <physic/physic_world.h>
@@ -17,6 +20,7 @@ class SceneManager
 {
 public:
     SceneManager(Scene &scene, ResourceManager &res, PhysicsWorld &phys, SoundManager &sound, Application *app);
+    ~SceneManager();
 
     void AddEntity(entt::entity entity, const std::string &sceneName)
     {
@@ -31,9 +35,19 @@ public:
 
     PhysicsWorld &GetPhysicsWorld() { return m_Physics; }
 
+    // Replaces every loaded scene with path, streamed in over the following frames (see SceneStream).
+    // Safe to call from scripts: the old scene is cleared at the start of the next frame.
     void QueueLoadScene(const std::string &path);
+    // Called once per frame by the engine loop: starts a queued load and advances the current one
     void UpdatePendingScene();
-    bool HasPendingScene() const { return m_isPending; }
+    bool HasPendingScene() const { return m_isPending || m_Stream->IsActive(); }
+
+    // Main-thread milliseconds a streamed load may spend per frame (CONFIG STREAM_BUDGET)
+    void SetStreamingBudget(float milliseconds) { m_StreamBudget = milliseconds; }
+    float GetStreamingBudget() const { return m_StreamBudget; }
+    // Called every frame while a streamed load runs, and once when it ends; the StateMachine is told too
+    void SetLoadProgressCallback(std::function<void(const SceneLoadProgress &)> callback) { m_ProgressCallback = std::move(callback); }
+    const SceneLoadProgress &GetLoadProgress() const { return m_Stream->GetProgress(); }
 
 private:
     Scene &m_Scene;
@@ -46,4 +60,10 @@ private:
 
     std::string m_pendingPath = "";
     bool m_isPending = false;
+
+    std::unique_ptr<SceneStream> m_Stream;
+    float m_StreamBudget = 4.0f;
+    std::function<void(const SceneLoadProgress &)> m_ProgressCallback;
+
+    void ReportProgress();
 };
\ No newline at end of file
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <entt/entt.hpp>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Interned InfoComponent name/tag -> entities. Kept current through the registry's InfoComponent
+// signals, so every emplace/insert/destroy is tracked. Renames must go through registry.patch or
+// registry.replace (Scene::RenameEntity/SetEntityTag); editing InfoComponent in place is not seen.
+class SceneNameIndex
+{
+public:
+    explicit SceneNameIndex(entt::registry &registry);
+    ~SceneNameIndex();
+
+    SceneNameIndex(const SceneNameIndex &) = delete;
+    SceneNameIndex &operator=(const SceneNameIndex &) = delete;
+
+    // The entity carrying the name, or entt::null. When names repeat the newest wins (last created
+    // or renamed), matching the first hit of the InfoComponent view lookups this index replaced
+    entt::entity FindByName(std::string_view name) const;
+    // Every entity under the name/tag, oldest first; empty when none. Invalidated by the next InfoComponent change
+    const std::vector<entt::entity> &FindAllByName(std::string_view name) const;
+    const std::vector<entt::entity> &FindAllByTag(std::string_view tag) const;
+
+    size_t GetEntityCount() const { return m_Entries.size(); }
+
+private:
+    struct StringHash
+    {
+        using is_transparent = void;
+        size_t operator()(std::string_view text) const { return std::hash<std::string_view>{}(text); }
+    };
+
+    struct Entry
+    {
+        uint32_t name;
+        uint32_t tag;
+        uint32_t namePos; // slot inside m_Names.buckets[name]
+        uint32_t tagPos;  // slot inside m_Tags.buckets[tag]
+    };
+
+    void OnConstruct(entt::registry &registry, entt::entity entity);
+    void OnDestroy(entt::registry &registry, entt::entity entity);
+    void OnUpdate(entt::registry &registry, entt::entity entity);
+
+    void Add(entt::registry &registry, entt::entity entity);
+    void Remove(entt::entity entity);
+
+    // One interned string space with a bucket of entities per string
+    struct Table
+    {
+        std::unordered_map<std::string, uint32_t, StringHash, std::equal_to<>> ids;
+        std::vector<std::vector<entt::entity>> buckets;
+
+        uint32_t Intern(std::string_view text);
+        const std::vector<entt::entity> &Find(std::string_view text) const;
+    };
+
+    uint32_t Push(Table &table, uint32_t id, entt::entity entity);
+    void Erase(Table &table, uint32_t id, uint32_t pos, bool isName);
+
+    entt::registry &m_Registry;
+    Table m_Names;
+    Table m_Tags;
+    std::unordered_map<entt::entity, Entry> m_Entries;
+};
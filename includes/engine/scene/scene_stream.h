@@ -0,0 +1,118 @@
+#pragma once
+
+#include <scene/scene_loader.h>
+#include <scene/scene_tokenizer.h>
+#include <graphic/geometry/model.h>
+#include <entt/entt.hpp>
+#include <cstdint>
+#include <future>
+#include <string>
+#include <vector>
+
+enum class SceneLoadStage : uint8_t
+{
+    Parsing,       // worker: reading or cooking the scene file, building collision shapes
+    Loading,       // workers import models; the main thread uploads them and runs the other LOAD_* lines
+    Instantiating, // main thread: entities, components and bodies
+    Done,
+    Failed,
+    Cancelled // Cancel() or a scene clear stopped the load part way
+};
+
+struct SceneLoadProgress
+{
+    std::string path;
+    SceneLoadStage stage = SceneLoadStage::Parsing;
+    int completedSteps = 0;
+    int totalSteps = 0; // 0 until the file has been parsed
+
+    bool IsFinished() const { return stage == SceneLoadStage::Done || stage == SceneLoadStage::Failed || stage == SceneLoadStage::Cancelled; }
+    float GetFraction() const
+    {
+        if (stage == SceneLoadStage::Done)
+            return 1.0f;
+        return totalSteps > 0 ? static_cast<float>(completedSteps) / static_cast<float>(totalSteps) : 0.0f;
+    }
+};
+
+// Loads one scene over several frames. Parsing, assimp imports with their image decoding, and
+// collision shapes run on worker threads; GL uploads, the remaining resource lines and entity
+// creation run in Update on the main thread, which starts no new step once its budget is spent.
+class SceneStream
+{
+public:
+    SceneStream(Scene &scene, ResourceManager &res, PhysicsWorld &phys, SoundManager &sound, Application *app);
+    ~SceneStream();
+
+    SceneStream(const SceneStream &) = delete;
+    SceneStream &operator=(const SceneStream &) = delete;
+
+    // Cancels a load already in flight. The scene is not cleared here
+    void Begin(const std::string &filePath);
+    // Main thread. Runs at least one ready step, then more until budgetMs is used up; true while work remains
+    bool Update(float budgetMs);
+    // Waits for the workers and drops what they produced; resources already uploaded stay loaded.
+    // A load still in flight ends in SceneLoadStage::Cancelled
+    void Cancel();
+
+    bool IsActive() const { return m_Active; }
+    const SceneLoadProgress &GetProgress() const { return m_Progress; }
+    // Valid once the stage is Done
+    const std::vector<entt::entity> &GetEntities() const { return m_Entities; }
+
+    // Model imports allowed to run at once (default: hardware threads - 1)
+    void SetMaxWorkers(int count) { m_MaxWorkers = count > 0 ? count : 1; }
+
+private:
+    struct Parsed
+    {
+        bool ok = false;
+        std::string blob;
+    };
+
+    struct ModelJob
+    {
+        std::string name;
+        std::string path;
+        bool isStatic = false;
+        std::future<ModelImportData> import;
+        bool started = false;
+        bool finished = false;  // the worker is done; the result may not be collected yet
+        bool collected = false; // moved into data on the main thread
+        ModelImportData data;
+        size_t nextImage = 0;
+    };
+
+    // A resource line in file order; model lines with an import point at their job
+    struct ResourceStep
+    {
+        SceneCommand command;
+        std::string_view args;
+        int job = -1;
+    };
+
+    void OnParsed();
+    void PollImports();
+    // False when the next step waits on a worker
+    bool RunStep();
+    void Instantiate();
+
+    Scene &m_Scene;
+    ResourceManager &m_Resources;
+    PhysicsWorld &m_Physics;
+    SoundManager &m_Sound;
+    Application *m_App;
+
+    bool m_Active = false;
+    std::string m_FullPath;
+    SceneLoadProgress m_Progress;
+
+    std::future<Parsed> m_Parse;
+    Parsed m_Parsed;
+    std::vector<ModelJob> m_Jobs;
+    std::vector<ResourceStep> m_Steps;
+    size_t m_NextStep = 0;
+    int m_MaxWorkers = 1;
+
+    std::vector<entt::entity> m_Entities;
+};
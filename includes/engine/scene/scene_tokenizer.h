@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// Every top-level scene command. The enumerator is spelled exactly like the keyword in the file.
+#define AXIS_SCENE_COMMANDS(X) \
+    X(LOAD_SHADER)             \
+    X(LOAD_MODEL)              \
+    X(LOAD_STATIC_MODEL)       \
+    X(LOAD_ANIMATION)          \
+    X(BAKE_ANIMATION)          \
+    X(LOAD_FONT)               \
+    X(LOAD_SOUND)              \
+    X(LOAD_SKYBOX)             \
+    X(LOAD_PARTICLE)           \
+    X(NEW_ENTITY)              \
+    X(TRANSFORM)               \
+    X(PARENT)                  \
+    X(CHILDREN)                \
+    X(RENDERER)                \
+    X(ANIMATOR)                \
+    X(BAKED_ANIMATOR)          \
+    X(MATERIAL)                \
+    X(VIDEO_MAP)               \
+    X(CAMERA)                  \
+    X(RIGIDBODY)               \
+    X(LIGHT_DIR)               \
+    X(LIGHT_POINT)             \
+    X(LIGHT_SPOT)              \
+    X(UI_TRANSFORM)            \
+    X(UI_RENDERER)             \
+    X(UI_TEXT)                 \
+    X(UI_ANIMATION)            \
+    X(SKYBOX_RENDERER)         \
+    X(SCRIPT)                  \
+    X(AUDIO_SOURCE)            \
+    X(VIDEO_PLAYER)            \
+    X(PARTICLE_EMITTER)        \
+    X(CONFIG)
+
+enum class SceneCommand : uint8_t
+{
+    Unknown,
+#define AXIS_SCENE_COMMAND_ENUM(name) name,
+    AXIS_SCENE_COMMANDS(AXIS_SCENE_COMMAND_ENUM)
+#undef AXIS_SCENE_COMMAND_ENUM
+};
+
+// Unknown for anything that isn't a command keyword, including "//" comments
+SceneCommand LookupSceneCommand(std::string_view token);
+const char *GetSceneCommandName(SceneCommand command);
+
+// Splits a scene file held in memory into lines, without copying. Handles \n and \r\n.
+class SceneLineReader
+{
+public:
+    explicit SceneLineReader(std::string_view text) : m_Rest(text) {}
+
+    bool NextLine(std::string_view &line);
+    int GetLineNumber() const { return m_LineNumber; }
+
+private:
+    std::string_view m_Rest;
+    int m_LineNumber = 0;
+};
+
+// Whitespace-separated tokens of one line. Reads behave like the istream extraction the handlers
+// used to do: a read that fails leaves its value untouched and makes every later read fail too.
+class SceneTokens
+{
+public:
+    explicit SceneTokens(std::string_view line) : m_Rest(line) {}
+
+    // Empty once the line is exhausted (or a read has failed)
+    std::string_view Next();
+    bool Next(std::string &value);
+    bool Next(float &value);
+    bool Next(int &value);
+
+    // Reads each value in turn, stopping at the first failure (like chained >>)
+    template <typename... Values>
+    bool Read(Values &...values)
+    {
+        return (Next(values) && ...);
+    }
+
+    // Unread remainder of the line, for handlers that still take a stream
+    std::string_view Rest() const { return m_Rest; }
+    bool Failed() const { return m_Failed; }
+
+private:
+    std::string_view m_Rest;
+    bool m_Failed = false;
+};
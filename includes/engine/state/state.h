@@ -18,6 +18,8 @@ public:
     virtual void OnFixedUpdate(float fixedDt) {}
     virtual void OnRender() = 0;
     virtual void OnExit() = 0;
+    // Every frame of a streamed scene load (SceneManager::QueueLoadScene) and once at its end
+    virtual void OnLoadProgress(const SceneLoadProgress &) {}
 
     class RenderSystem &GetRenderSystem();
     class PhysicsSystem &GetPhysicsSystem();
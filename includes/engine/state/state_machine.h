@@ -2,6 +2,7 @@
 
 #include <stack>
 #include <memory>
+#include <functional>
 #include "state.h"
 
 class StateMachine
@@ -20,7 +21,17 @@ public:
     void FixedUpdate(float fixedDt);
     void Render();
 
+    // The loading state is pushed when a streamed scene load starts and popped when it ends; without
+    // one the current state still gets OnLoadProgress
+    void SetLoadingState(std::function<std::unique_ptr<State>()> factory) { m_LoadingFactory = std::move(factory); }
+    void OnSceneLoadProgress(const SceneLoadProgress &progress);
+    bool IsLoading() const { return m_Loading; }
+
 private:
     std::stack<std::unique_ptr<State>> m_States;
     Application *m_App;
+
+    std::function<std::unique_ptr<State>()> m_LoadingFactory;
+    State *m_LoadingState = nullptr;
+    bool m_Loading = false;
 };
\ No newline at end of file
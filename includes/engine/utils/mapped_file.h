@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// Read-only view of a whole file. Mapped into memory where the platform allows it, otherwise read
+// into an owned buffer; either way View() stays valid until Close() or destruction.
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    bool Open(const std::string &path);
+    void Close();
+
+    bool IsOpen() const { return m_Open; }
+    bool IsMapped() const { return m_Mapping != nullptr; }
+    std::string_view View() const { return {m_Data, m_Size}; }
+
+private:
+    const char *m_Data = nullptr;
+    size_t m_Size = 0;
+    bool m_Open = false;
+
+    void *m_Mapping = nullptr; // base address of the mapping, null when read into m_Buffer
+    std::string m_Buffer;
+};
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+// Scoped CPU profiler. Enabled with -DAXIS_ENABLE_PROFILER=ON (defines AXIS_PROFILER_ENABLED=1);
+// otherwise every AXIS_PROFILE_* macro expands to nothing, like the LOGGER_* macros.
+//
+//   AXIS_PROFILE_FRAME();                     // once per frame, main thread
+//   AXIS_PROFILE_SCOPE("PhysicsWorld::Update"); // string literal only, stored by pointer
+//   AXIS_PROFILE_CAPTURE(120, "trace.json");  // next 120 frames -> Chrome trace / Perfetto JSON
+
+#ifndef AXIS_PROFILER_ENABLED
+#define AXIS_PROFILER_ENABLED 0
+#endif
+
+#if AXIS_PROFILER_ENABLED
+
+class Profiler
+{
+public:
+    struct Zone
+    {
+        const char *name;
+        uint64_t startNs;
+        uint64_t endNs;
+        uint32_t depth;
+    };
+
+    class ScopedZone
+    {
+    public:
+        explicit ScopedZone(const char *name);
+        ~ScopedZone();
+
+        ScopedZone(const ScopedZone &) = delete;
+        ScopedZone &operator=(const ScopedZone &) = delete;
+
+    private:
+        const char *m_Name;
+        uint64_t m_Start;
+    };
+
+    static uint64_t NowNs();
+    static void SetThreadName(const char *name);
+
+    // Frame boundary; drives pending captures
+    static void MarkFrame();
+
+    static void RequestCapture(int frames, const std::string &path);
+    static bool IsCapturing();
+
+    // Writes every zone recorded in [startNs, endNs] from all thread buffers
+    static bool WriteChromeTrace(const std::string &path, uint64_t startNs, uint64_t endNs);
+};
+
+#define AXIS_PROFILE_CONCAT_INNER(a, b) a##b
+#define AXIS_PROFILE_CONCAT(a, b) AXIS_PROFILE_CONCAT_INNER(a, b)
+
+#define AXIS_PROFILE_SCOPE(name) Profiler::ScopedZone AXIS_PROFILE_CONCAT(axisProfileZone, __LINE__)("" name)
+#define AXIS_PROFILE_FUNCTION() Profiler::ScopedZone AXIS_PROFILE_CONCAT(axisProfileZone, __LINE__)(__func__)
+#define AXIS_PROFILE_FRAME() Profiler::MarkFrame()
+#define AXIS_PROFILE_THREAD(name) Profiler::SetThreadName("" name)
+#define AXIS_PROFILE_CAPTURE(frames, path) Profiler::RequestCapture(frames, path)
+
+#else
+
+#define AXIS_PROFILE_SCOPE(name) ((void)0)
+#define AXIS_PROFILE_FUNCTION() ((void)0)
+#define AXIS_PROFILE_FRAME() ((void)0)
+#define AXIS_PROFILE_THREAD(name) ((void)0)
+#define AXIS_PROFILE_CAPTURE(frames, path) ((void)0)
+
+#endif
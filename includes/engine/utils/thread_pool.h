@@ -0,0 +1,49 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Persistent worker threads for data-parallel loops inside a frame (physics islands, narrowphase).
+// Workers spin briefly after a loop so back-to-back loops don't pay a wake-up each; then they sleep.
+class ThreadPool
+{
+public:
+    // workerCount <= 0: one worker per hardware thread besides the caller
+    explicit ThreadPool(int workerCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    int GetWorkerCount() const { return static_cast<int>(m_Workers.size()); }
+    // Threads that execute a ParallelFor: the workers plus the calling thread
+    int GetThreadCount() const { return GetWorkerCount() + 1; }
+
+    // Runs body(chunkBegin, chunkEnd) over [begin, end) in chunks of grainSize on the workers and
+    // the calling thread, and returns once every chunk is done. Calls made from inside a body run inline.
+    void ParallelFor(int begin, int end, int grainSize, const std::function<void(int, int)> &body);
+
+private:
+    void WorkerLoop();
+    void RunChunks();
+
+    std::vector<std::thread> m_Workers;
+
+    std::mutex m_Mutex;
+    std::condition_variable m_Wake;
+    std::atomic<uint64_t> m_Generation{0}; // bumped once per ParallelFor
+    bool m_Stopping = false;
+
+    // The loop being run; written before m_Generation is bumped
+    std::mutex m_SubmitMutex;
+    const std::function<void(int, int)> *m_Body = nullptr;
+    int m_End = 0;
+    int m_Grain = 1;
+    std::atomic<int> m_Next{0};
+    std::atomic<int> m_Busy{0}; // workers that have not finished the current loop
+};
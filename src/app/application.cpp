@@ -1,10 +1,13 @@
 #include <app/application.h>
 #include <app/config_loader.h>
 #include <utils/logger.h>
+#include <utils/profiler.h>
 
 #include <utils/filesystem.h>
 #include <utils/bullet_glm_helpers.h>
 #include <iostream>
+#include <cstring>
+#include <cstdlib>
 
 void framebuffer_size_callback(GLFWwindow *window, int width, int height)
 {
@@ -58,14 +61,31 @@ Application::~Application()
 
     systemManager.reset();
     engineLoop.reset();
+    threadPool.reset();
 
     LOGGER_INFO("Application") << "Application shutdown completed.";
 }
 
-bool Application::Init()
+bool Application::Init(int argc, char **argv)
 {
     AppConfig config = ConfigLoader::Load(FileSystem::getPath("configuration/settings.json"));
 
+    int maxFrames = 0;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--headless") == 0)
+            config.headless = true;
+        else if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+            maxFrames = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--trace") == 0 && i + 1 < argc)
+        {
+            // Parsed outside the macro, which expands to nothing when the profiler is off
+            [[maybe_unused]] int traceFrames = std::atoi(argv[++i]);
+            AXIS_PROFILE_CAPTURE(traceFrames, "axis_trace.json");
+        }
+    }
+
+    monitorManager.SetHeadless(config.headless);
     monitorManager.SetWindowTitle(config.title);
     monitorManager.SetWindowConfiguration(config.width, config.height, (WindowMode)config.windowMode, config.monitorIndex, config.refreshRate);
     monitorManager.SetVsync(config.vsync);
@@ -84,12 +104,16 @@ bool Application::Init()
         glDisable(GL_CULL_FACE);
 
     GLFWwindow *window = monitorManager.GetWindow();
-    glfwSetWindowUserPointer(window, this);
-    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
-    glfwSetCursorPosCallback(window, mouse_callback);
-    glfwSetMouseButtonCallback(window, mouse_button_callback);
-    glfwSetScrollCallback(window, scroll_callback);
+    if (window)
+    {
+        glfwSetWindowUserPointer(window, this);
+        glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+        glfwSetCursorPosCallback(window, mouse_callback);
+        glfwSetMouseButtonCallback(window, mouse_button_callback);
+        glfwSetScrollCallback(window, scroll_callback);
+    }
 
+    threadPool = std::make_unique<ThreadPool>();
     physicsWorld = std::make_unique<PhysicsWorld>();
     appHandler = std::make_unique<AppHandler>(window);
     appHandler->OnResize(monitorManager.GetWidth(), monitorManager.GetHeight());
@@ -127,8 +151,9 @@ bool Application::Init()
     sceneManager->LoadScene("src/asset/load.scene");
 
     engineLoop = std::make_unique<EngineLoop>(this);
+    engineLoop->SetMaxFrames(maxFrames);
 
-    if (!config.iconPath.empty())
+    if (!config.iconPath.empty() && !config.headless)
     {
         LOGGER_DEBUG("Application") << "Setting window icon from: " << config.iconPath;
         monitorManager.SetWindowIcon(FileSystem::getPath(config.iconPath));
@@ -144,6 +169,12 @@ void Application::Run()
     engineLoop->Run();
 }
 
+void Application::RequestExit()
+{
+    if (engineLoop)
+        engineLoop->RequestExit();
+}
+
 void Application::SetPhysicsStep(float step)
 {
     engineLoop->SetPhysicsStep(step);
@@ -91,6 +91,8 @@ AppConfig ConfigLoader::Load(const std::string &path)
             config.physicsMode = std::stoi(value);
         else if (key == "width")
              config.width = std::stoi(value);
+        else if (key == "headless")
+            config.headless = (value == "true");
         else if (key == "antialiasing")
         {
             if (value == "FXAA") config.antialiasing = 1;
@@ -115,6 +117,15 @@ void ConfigLoader::LoadConfig(std::stringstream &ss, Application *app)
             app->GetRenderSystem().SetShadowMode(mode);
         }
     }
+    else if (subCmd == "STREAM_BUDGET")
+    {
+        float budget = 4.0f;
+        ss >> budget;
+        if (app)
+        {
+            app->GetSceneManager().SetStreamingBudget(budget);
+        }
+    }
     else if (subCmd == "SHADOW_SIZE")
     {
         float size = 20.0f;
@@ -254,6 +265,33 @@ void ConfigLoader::LoadConfig(std::stringstream &ss, Application *app)
                 app->GetRenderSystem().SetFrustumCulling(enable != 0);
         }
     }
+    else if (subCmd == "CULLING_BVH")
+    {
+        int enable = 0;
+        if (ss >> enable)
+        {
+            if (app)
+                app->GetRenderSystem().SetHierarchicalCulling(enable != 0);
+        }
+    }
+    else if (subCmd == "MULTI_DRAW_INDIRECT")
+    {
+        int enable = 0;
+        if (ss >> enable)
+        {
+            if (app)
+                app->GetRenderSystem().SetMultiDrawIndirect(enable != 0);
+        }
+    }
+    else if (subCmd == "ANIMATION_LOD")
+    {
+        int enable = 0;
+        if (ss >> enable)
+        {
+            if (app)
+                app->GetAnimationSystem().SetLodEnabled(enable != 0);
+        }
+    }
     else if (subCmd == "SHADOW_FRUSTUM")
     {
         int enable = 0;
@@ -302,6 +340,21 @@ void ConfigLoader::LoadConfig(std::stringstream &ss, Application *app)
             {
                 app->GetPhysicsWorld().SetMode(mode);
             }
+
+            // Optional threading: PARALLEL steps btDiscreteDynamicsWorldMt on the engine thread pool
+            std::string threadingStr;
+            if (ss >> threadingStr)
+            {
+                if (threadingStr == "PARALLEL" || threadingStr == "SERIAL")
+                {
+                    if (app)
+                        app->GetPhysicsWorld().SetParallel(threadingStr == "PARALLEL" ? &app->GetThreadPool() : nullptr);
+                }
+                else
+                {
+                    LOGGER_WARN("ConfigLoader") << "Invalid PHYSICS_MODE threading: " << threadingStr << ". Supported: SERIAL, PARALLEL.";
+                }
+            }
         }
     }
     else if (subCmd == "PHYSICS_ASYNC")
@@ -316,6 +369,17 @@ void ConfigLoader::LoadConfig(std::stringstream &ss, Application *app)
             }
         }
     }
+    else if (subCmd == "PHYSICS_PIPELINE")
+    {
+        int enabled = 0;
+        if (ss >> enabled)
+        {
+            if (app)
+            {
+                app->GetPhysicsSystem().SetPipelined(enabled != 0);
+            }
+        }
+    }
     else if (subCmd == "ANTIALIASING")
     {
         std::string valStr;
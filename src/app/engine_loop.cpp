@@ -11,13 +11,16 @@
 #include <resource/resource_manager.h>
 #include <audio/sound_manager.h>
 #include <physic/physic_world.h>
+#include <graphic/core/render_device.h>
 #include <utils/logger.h>
+#include <utils/profiler.h>
 
 #ifdef ENABLE_DEBUG_SYSTEM
 #include <debug/debug_system.h>
 #endif
 
 #include <iostream>
+#include <chrono>
 
 EngineLoop::EngineLoop(Application* app)
     : m_App(app)
@@ -31,20 +34,46 @@ EngineLoop::~EngineLoop()
 void EngineLoop::Run()
 {
     LOGGER_INFO("EngineLoop") << "Starting engine loop";
-    while (!glfwWindowShouldClose(m_App->GetWindow()))
+    AXIS_PROFILE_THREAD("Main");
+    while (!ShouldExit())
     {
         ProcessFrame();
     }
 }
 
+bool EngineLoop::ShouldExit() const
+{
+    if (m_ExitRequested)
+        return true;
+    if (m_MaxFrames > 0 && m_FrameIndex >= m_MaxFrames)
+        return true;
+
+    GLFWwindow *window = m_App->GetWindow();
+    return window && glfwWindowShouldClose(window);
+}
+
+double EngineLoop::GetTime() const
+{
+    if (!m_App->IsHeadless())
+        return glfwGetTime();
+
+    static const auto start = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
 void EngineLoop::ProcessFrame()
 {
-    float currentFrame = (float)glfwGetTime();
+    AXIS_PROFILE_FRAME();
+    AXIS_PROFILE_SCOPE("EngineLoop::ProcessFrame");
+
+    float currentFrame = (float)GetTime();
     realDeltaTime = currentFrame - lastFrame;
     deltaTime = realDeltaTime;
     lastFrame = currentFrame;
 
-    glfwPollEvents();
+    GLFWwindow *window = m_App->GetWindow();
+    if (window)
+        glfwPollEvents();
     m_App->GetMouse().Update();
 
     if (m_IsPaused)
@@ -57,7 +86,9 @@ void EngineLoop::ProcessFrame()
     }
 
     m_App->GetResourceManager().Update(realDeltaTime);
-    m_App->GetAppHandler().ProcessInput(m_App->GetWindow());
+    m_App->GetSceneManager().UpdatePendingScene();
+    if (window)
+        m_App->GetAppHandler().ProcessInput(window);
 
 #ifdef ENABLE_DEBUG_SYSTEM
     m_App->GetSystemManager().UpdateDebugSystem(realDeltaTime);
@@ -67,18 +98,25 @@ void EngineLoop::ProcessFrame()
     Update();
     Render();
 
-    glfwSwapBuffers(m_App->GetWindow());
+    if (window)
+    {
+        AXIS_PROFILE_SCOPE("EngineLoop::SwapBuffers");
+        glfwSwapBuffers(window);
+    }
+
+    RenderDevice::EndFrame();
+    ++m_FrameIndex;
 
     int frameRateLimit = m_App->GetMonitorManager().GetFrameRateLimit();
     if (frameRateLimit > 0)
     {
         double targetFrameTime = 1.0 / (double)frameRateLimit;
-        double frameEnd = glfwGetTime();
+        double frameEnd = GetTime();
         double frameElapsed = frameEnd - currentFrame;
 
         while (frameElapsed < targetFrameTime)
         {
-            frameEnd = glfwGetTime();
+            frameEnd = GetTime();
             frameElapsed = frameEnd - currentFrame;
         }
     }
@@ -86,6 +124,7 @@ void EngineLoop::ProcessFrame()
 
 void EngineLoop::FixedUpdate()
 {
+    AXIS_PROFILE_SCOPE("EngineLoop::FixedUpdate");
     m_Accumulator += deltaTime;
 
     int physicsSteps = 0;
@@ -105,10 +144,13 @@ void EngineLoop::FixedUpdate()
     {
         m_Accumulator = 0.0f;
     }
+
+    m_App->GetSystemManager().InterpolatePhysics(m_Accumulator / m_FixedDeltaTime);
 }
 
 void EngineLoop::Update()
 {
+    AXIS_PROFILE_SCOPE("EngineLoop::Update");
     auto& systemMgr = m_App->GetSystemManager();
     
     systemMgr.UpdateSystems(
@@ -127,6 +169,7 @@ void EngineLoop::Update()
 
 void EngineLoop::Render()
 {
+    AXIS_PROFILE_SCOPE("EngineLoop::Render");
     auto& systemMgr = m_App->GetSystemManager();
 
     systemMgr.RenderShadows(m_App->GetScene());
@@ -1,4 +1,5 @@
 #include <app/monitor_manager.h>
+#include <graphic/core/render_device.h>
 #include <utils/logger.h>
 #include <iostream>
 #include <stb_image.h>
@@ -16,11 +17,25 @@ MonitorManager::~MonitorManager()
         glfwDestroyWindow(m_Window);
         m_Window = nullptr;
     }
-    glfwTerminate();
+    RenderDevice::Shutdown();
+    if (!m_Headless)
+        glfwTerminate();
 }
 
 bool MonitorManager::Init()
 {
+    if (m_Headless)
+    {
+        if (!RenderDevice::Init(RenderBackend::Null))
+        {
+            LOGGER_ERROR("MonitorManager") << "Failed to initialize null render device";
+            return false;
+        }
+        LOGGER_INFO("MonitorManager") << "Running headless (" << m_Width << "x" << m_Height << "), no window created";
+        glViewport(0, 0, m_Width, m_Height);
+        return true;
+    }
+
     if (!glfwInit())
     {
         LOGGER_ERROR("MonitorManager") << "Failed to initialize GLFW";
@@ -49,7 +64,7 @@ bool MonitorManager::Init()
         glfwSwapInterval(0);
     }
 
-    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+    if (!RenderDevice::Init(RenderBackend::OpenGL, (RenderDevice::LoadProc)glfwGetProcAddress))
     {
         LOGGER_ERROR("MonitorManager") << "Failed to initialize GLAD";
         return false;
@@ -67,6 +82,12 @@ void MonitorManager::SetWindowConfiguration(int width, int height, WindowMode mo
     m_MonitorIndex = monitorIndex;
     m_RefreshRate = refreshRate;
 
+    if (m_Headless)
+    {
+        glViewport(0, 0, m_Width, m_Height);
+        return;
+    }
+
     int count;
     GLFWmonitor **monitors = glfwGetMonitors(&count);
     GLFWmonitor *targetMonitor = nullptr;
@@ -119,7 +140,8 @@ void MonitorManager::SetWindowConfiguration(int width, int height, WindowMode mo
 void MonitorManager::SetVsync(bool enable)
 {
     m_Vsync = enable;
-    glfwSwapInterval(enable ? 1 : 0);
+    if (!m_Headless)
+        glfwSwapInterval(enable ? 1 : 0);
 }
 
 void MonitorManager::SetFrameRateLimit(int limit)
@@ -177,6 +199,8 @@ void MonitorManager::OnResize(int width, int height)
 std::vector<DeviceInfo> MonitorManager::GetAllDevices() const
 {
     std::vector<DeviceInfo> devices;
+    if (m_Headless)
+        return devices;
     int count;
     GLFWmonitor **monitors = glfwGetMonitors(&count);
 
@@ -6,12 +6,14 @@
 #include <app/application.h>
 #include <input/mouse_manager.h>
 #include <utils/logger.h>
+#include <utils/profiler.h>
 #include <iostream>
 
 #include <glad/glad.h>
 
 SystemManager::SystemManager()
 {
+    renderSystem.SetTransformSystem(&transformSystem);
 }
 
 SystemManager::~SystemManager()
@@ -34,46 +36,63 @@ void SystemManager::ShutdownSystems()
 {
     LOGGER_INFO("SystemManager") << "Shutting down systems...";
     renderSystem.Shutdown();
+    transformSystem.Detach();
     postProcess.Shutdown();
 }
 
 void SystemManager::FixedUpdateSystems(Scene& scene, PhysicsWorld& phys, float fixedDt)
 {
-    physicsSystem.Update(scene, phys, fixedDt);
+    AXIS_PROFILE_SCOPE("SystemManager::FixedUpdateSystems");
+    RunTimed("Transform", [&]() { transformSystem.Update(scene); });
+    RunTimed("Physics", [&]() { physicsSystem.Update(scene, phys, fixedDt); });
+}
+
+void SystemManager::InterpolatePhysics(float alpha)
+{
+    if (!physicsSystem.IsPipelined())
+        return;
+    RunTimed("PhysicsInterpolate", [&]() { physicsSystem.Interpolate(alpha); });
 }
 
 void SystemManager::UpdateSystems(Scene& scene, float deltaTime, float realDeltaTime,
                                   Application* app, ResourceManager& res,
                                   SoundManager& sound, MouseManager& mouse)
 {
-    scriptSystem.Update(scene, deltaTime, realDeltaTime, app);
-    animationSystem.Update(scene, deltaTime);
-    videoSystem.Update(scene, res, deltaTime);
-    uiInteractSystem.Update(scene, deltaTime, mouse);
-    audioSystem.Update(scene, sound);
-    particleSystem.Update(scene, deltaTime);
+    AXIS_PROFILE_SCOPE("SystemManager::UpdateSystems");
+    RunTimed("Script", [&]() { scriptSystem.Update(scene, deltaTime, realDeltaTime, app); });
+    RunTimed("Animation", [&]() { animationSystem.Update(scene, deltaTime); });
+    RunTimed("Video", [&]() { videoSystem.Update(scene, res, deltaTime); });
+    RunTimed("UIInteract", [&]() { uiInteractSystem.Update(scene, deltaTime, mouse); });
+    RunTimed("Audio", [&]() { audioSystem.Update(scene, sound); });
+    RunTimed("Particle", [&]() { particleSystem.Update(scene, deltaTime); });
 }
 
 void SystemManager::RenderShadows(Scene& scene)
 {
-    renderSystem.RenderShadows(scene);
+    AXIS_PROFILE_SCOPE("SystemManager::RenderShadows");
+    // Resolve world matrices after scripts, animation and game states moved things this frame
+    RunTimed("Transform", [&]() { transformSystem.Update(scene); });
+    RunTimed("Shadows", [&]() { renderSystem.RenderShadows(scene); });
 }
 
 void SystemManager::RenderSystems(Scene& scene, ResourceManager& res, int width, int height)
 {
+    AXIS_PROFILE_SCOPE("SystemManager::RenderSystems");
     glViewport(0, 0, width, height);
     postProcess.BeginCapture();
 
-    skyboxRenderSystem.Render(scene);
-    renderSystem.Render(scene, width, height);
-    particleSystem.Render(scene, res);
+    RunTimed("Skybox", [&]() { skyboxRenderSystem.Render(scene); });
+    RunTimed("Render", [&]() { renderSystem.Render(scene, width, height); });
+    RunTimed("ParticleRender", [&]() { particleSystem.Render(scene, res); });
 
-    uiRenderSystem.Render(scene, (float)width, (float)height);
+    RunTimed("UIRender", [&]() { uiRenderSystem.Render(scene, (float)width, (float)height); });
 
-    postProcess.ApplyAntiAliasing(renderSystem.GetAntiAliasingMode(), 
-                                  renderSystem.GetPrevViewProj(), 
-                                  renderSystem.GetCurrViewProj(), 
-                                  renderSystem.GetJitterOffset());
+    RunTimed("AntiAliasing", [&]() {
+        postProcess.ApplyAntiAliasing(renderSystem.GetAntiAliasingMode(), 
+                                      renderSystem.GetPrevViewProj(), 
+                                      renderSystem.GetCurrViewProj(), 
+                                      renderSystem.GetJitterOffset());
+    });
 
     postProcess.EndCapture();
 }
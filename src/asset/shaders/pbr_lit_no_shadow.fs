@@ -7,19 +7,13 @@ in vec2 TexCoords;
 in vec3 Normal;
 in vec3 FragPos;
 
-struct Material {
+struct MaterialMaps {
     sampler2D texture_diffuse1;
     sampler2D texture_metallic1;
     sampler2D texture_roughness1;
     sampler2D texture_ao1;
     sampler2D texture_normal1;
     sampler2D texture_emission1;
-
-    float roughness;
-    float metallic;
-    float ao;
-    vec3 emission;
-    float opacity;
 };
 
 struct DirLight {
@@ -62,18 +56,37 @@ layout(std430, binding = 2) buffer SpotLightBuffer {
     SpotLight spotLights[];
 };
 
-uniform int numDirLights;
-uniform int nrPointLights;
-uniform int nrSpotLights;
-
 // uniform DirLight dirLight;
 // uniform DirLight dirLights[NR_DIR_LIGHTS];
 // uniform PointLight pointLights[NR_POINT_LIGHTS];
 
-uniform vec3 viewPos;
-uniform Material material;
-uniform vec4 tintColor;
-uniform bool debug_noTexture;
+layout(std140) uniform FrameData
+{
+    mat4 view;
+    mat4 projection;
+    vec3 viewPos;
+    int numDirLights;
+    int nrPointLights;
+    int nrSpotLights;
+};
+
+struct MaterialParams {
+    vec3 specular; float shininess;
+    vec3 ambient; float opacity;
+    vec3 emission; float roughness;
+    float metallic; float ao;
+};
+
+layout(std140) uniform MaterialData
+{
+    MaterialParams material;
+    vec4 tintColor;
+    vec2 uvScale;
+    vec2 uvOffset;
+    bool debug_noTexture;
+};
+
+uniform MaterialMaps materialMaps;
 
 const float PI = 3.14159265359;
 
@@ -98,10 +111,10 @@ void main()
     }
     else
     {
-        albedo = pow(texture(material.texture_diffuse1, TexCoords).rgb, vec3(2.2)) * tintColor.rgb;
-        metallic = texture(material.texture_metallic1, TexCoords).r * material.metallic;
-        roughness = texture(material.texture_roughness1, TexCoords).r * material.roughness;
-        ao = texture(material.texture_ao1, TexCoords).r * material.ao;
+        albedo = pow(texture(materialMaps.texture_diffuse1, TexCoords).rgb, vec3(2.2)) * tintColor.rgb;
+        metallic = texture(materialMaps.texture_metallic1, TexCoords).r * material.metallic;
+        roughness = texture(materialMaps.texture_roughness1, TexCoords).r * material.roughness;
+        ao = texture(materialMaps.texture_ao1, TexCoords).r * material.ao;
     }
 
     vec3 N = normalize(Normal);
@@ -194,7 +207,7 @@ void main()
     vec3 ambient = vec3(0.03) * albedo * ao;
     vec3 color = ambient + Lo;
 
-    vec3 emission = texture(material.texture_emission1, TexCoords).rgb + material.emission;
+    vec3 emission = texture(materialMaps.texture_emission1, TexCoords).rgb + material.emission;
     color += emission;
 
     if (material.opacity < 0.1) discard;
@@ -10,18 +10,61 @@ out vec3 Normal;
 out vec2 TexCoords;
 
 uniform mat4 model;
-uniform mat4 view;
-uniform mat4 projection;
+
+layout(std140) uniform FrameData
+{
+    mat4 view;
+    mat4 projection;
+    vec3 viewPos;
+    int numDirLights;
+    int nrPointLights;
+    int nrSpotLights;
+};
 
 layout(location = 10) in mat4 instanceMatrix;
 uniform bool isInstanced;
 
 const int MAX_BONES = 100;
 const int MAX_BONE_INFLUENCE = 4;
-uniform mat4 finalBonesMatrices[MAX_BONES];
+layout(std140) uniform SkinningData
+{
+    mat4 finalBonesMatrices[MAX_BONES];
+};
+
+// Baked crowd animation: one row per frame, four texels (matrix columns) per bone
+uniform sampler2D bakedBones;
+uniform bool useBakedBones;
+
+mat4 BakedBoneMatrix(int row, int bone)
+{
+    return mat4(texelFetch(bakedBones, ivec2(bone * 4 + 0, row), 0),
+                texelFetch(bakedBones, ivec2(bone * 4 + 1, row), 0),
+                texelFetch(bakedBones, ivec2(bone * 4 + 2, row), 0),
+                texelFetch(bakedBones, ivec2(bone * 4 + 3, row), 0));
+}
 
 void main()
 {
+    // Baked instances carry frame position, first row and frame count in the matrix's bottom row
+    mat4 instanceModel = instanceMatrix;
+    bool baked = isInstanced && useBakedBones;
+    int rowA = 0;
+    int rowB = 0;
+    float rowBlend = 0.0;
+    if (baked)
+    {
+        float framePos = instanceMatrix[0][3];
+        int frame = int(framePos);
+        int firstRow = int(instanceMatrix[1][3] + 0.5);
+        int frameCount = max(int(instanceMatrix[2][3] + 0.5), 1);
+        rowA = firstRow + frame;
+        rowB = firstRow + (frame + 1) % frameCount;
+        rowBlend = framePos - float(frame);
+        instanceModel[0][3] = 0.0;
+        instanceModel[1][3] = 0.0;
+        instanceModel[2][3] = 0.0;
+    }
+
     vec4 totalPosition = vec4(0.0f);
     vec3 totalNormal = vec3(0.0f);
     bool hasBones = false;
@@ -35,9 +78,11 @@ void main()
             totalNormal = aNormal;
             break;
         }
-        vec4 localPosition = finalBonesMatrices[aBoneIds[i]] * vec4(aPos,1.0f);
+        mat4 boneMatrix = baked ? BakedBoneMatrix(rowA, aBoneIds[i]) * (1.0 - rowBlend) + BakedBoneMatrix(rowB, aBoneIds[i]) * rowBlend
+                                : finalBonesMatrices[aBoneIds[i]];
+        vec4 localPosition = boneMatrix * vec4(aPos,1.0f);
         totalPosition += localPosition * aWeights[i];
-        vec3 localNormal = mat3(finalBonesMatrices[aBoneIds[i]]) * aNormal;
+        vec3 localNormal = mat3(boneMatrix) * aNormal;
         totalNormal += localNormal * aWeights[i];
         hasBones = true;
     }
@@ -47,7 +92,7 @@ void main()
         totalNormal = aNormal;
     }
 
-    mat4 modelMatrix = isInstanced ? instanceMatrix : model;
+    mat4 modelMatrix = isInstanced ? instanceModel : model;
 
     FragPos = vec3(modelMatrix * totalPosition);
     Normal = mat3(transpose(inverse(modelMatrix))) * totalNormal;  
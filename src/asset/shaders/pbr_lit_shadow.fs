@@ -7,19 +7,13 @@ in vec2 TexCoords;
 in vec4 FragPosLightSpace[2]; // Array for 2 directional light shadows
 in vec4 FragPosLightSpaceSpot[2]; // Array for 2 spot light shadows
 
-struct Material {
+struct MaterialMaps {
     sampler2D texture_diffuse1;
     sampler2D texture_metallic1;
     sampler2D texture_roughness1;
     sampler2D texture_ao1;
     sampler2D texture_normal1;
     sampler2D texture_emission1;
-
-    float roughness;
-    float metallic;
-    float ao;
-    vec3 emission;
-    float opacity;
 };
 
 struct DirLight {
@@ -68,21 +62,47 @@ layout(std430, binding = 2) buffer SpotLightBuffer {
 #define NR_SPOT_LIGHTS 4
 #define NR_SPOT_SHADOW_MAPS 2
 
-uniform int numDirLights;
-uniform int nrPointLights;
-uniform int nrSpotLights;
 
-uniform vec3 viewPos;
-uniform Material material;
-uniform vec4 tintColor;
-uniform bool u_ReceiveShadow;
-uniform bool debug_noTexture;
+layout(std140) uniform FrameData
+{
+    mat4 view;
+    mat4 projection;
+    vec3 viewPos;
+    int numDirLights;
+    int nrPointLights;
+    int nrSpotLights;
+};
+
+layout(std140) uniform ShadowData
+{
+    mat4 lightSpaceMatrix[2]; // Dir light space matrices
+    mat4 lightSpaceMatrixSpot[2]; // Spot light space matrices
+    float farPlanePoint;
+    float farPlaneSpot;
+    bool u_ReceiveShadow;
+};
+
+struct MaterialParams {
+    vec3 specular; float shininess;
+    vec3 ambient; float opacity;
+    vec3 emission; float roughness;
+    float metallic; float ao;
+};
+
+layout(std140) uniform MaterialData
+{
+    MaterialParams material;
+    vec4 tintColor;
+    vec2 uvScale;
+    vec2 uvOffset;
+    bool debug_noTexture;
+};
+
+uniform MaterialMaps materialMaps;
 
-uniform sampler2D shadowMapDir[NR_DIR_SHADOW_MAPS]; // Array of 2 dir shadow maps
-uniform samplerCube shadowMapPoint[NR_POINT_SHADOW_MAPS];
-uniform sampler2D shadowMapSpot[NR_SPOT_SHADOW_MAPS]; // Array of 2 spot shadow maps
-uniform float farPlanePoint;
-uniform float farPlaneSpot;
+layout(binding = 10) uniform sampler2D shadowMapDir[NR_DIR_SHADOW_MAPS]; // Array of 2 dir shadow maps
+layout(binding = 12) uniform samplerCube shadowMapPoint[NR_POINT_SHADOW_MAPS];
+layout(binding = 14) uniform sampler2D shadowMapSpot[NR_SPOT_SHADOW_MAPS]; // Array of 2 spot shadow maps
 
 const float PI = 3.14159265359;
 
@@ -109,10 +129,10 @@ void main()
     }
     else
     {
-        albedo = pow(texture(material.texture_diffuse1, TexCoords).rgb, vec3(2.2)) * tintColor.rgb;
-        metallic = texture(material.texture_metallic1, TexCoords).r * material.metallic;
-        roughness = texture(material.texture_roughness1, TexCoords).r * material.roughness;
-        ao = texture(material.texture_ao1, TexCoords).r * material.ao;
+        albedo = pow(texture(materialMaps.texture_diffuse1, TexCoords).rgb, vec3(2.2)) * tintColor.rgb;
+        metallic = texture(materialMaps.texture_metallic1, TexCoords).r * material.metallic;
+        roughness = texture(materialMaps.texture_roughness1, TexCoords).r * material.roughness;
+        ao = texture(materialMaps.texture_ao1, TexCoords).r * material.ao;
     }
 
     vec3 N = normalize(Normal);
@@ -229,7 +249,7 @@ void main()
 
     if (!debug_noTexture)
     {
-        vec3 emission = texture(material.texture_emission1, TexCoords).rgb * material.emission;
+        vec3 emission = texture(materialMaps.texture_emission1, TexCoords).rgb * material.emission;
         color += emission;
     }
 
@@ -1,11 +1,9 @@
 #version 430 core
 out vec4 FragColor;
 
-struct Material {
+struct MaterialMaps {
     sampler2D texture_diffuse1;
     sampler2D texture_specular1;
-    float shininess;
-    vec3 specular;
 };
 
 struct DirLight {
@@ -52,22 +50,42 @@ in vec3 FragPos;
 in vec3 Normal;
 in vec2 TexCoords;
 
-uniform vec3 viewPos;
 // uniform DirLight dirLight;
 // uniform DirLight dirLights[NR_DIR_LIGHTS];
 // uniform PointLight pointLights[NR_POINT_LIGHTS];
 // uniform SpotLight spotLights[NR_SPOT_LIGHTS];
-uniform Material material;
-uniform int numDirLights;
-uniform int nrPointLights;
-uniform int nrSpotLights;
-uniform vec4 tintColor;
+layout(std140) uniform FrameData
+{
+    mat4 view;
+    mat4 projection;
+    vec3 viewPos;
+    int numDirLights;
+    int nrPointLights;
+    int nrSpotLights;
+};
+
+struct MaterialParams {
+    vec3 specular; float shininess;
+    vec3 ambient; float opacity;
+    vec3 emission; float roughness;
+    float metallic; float ao;
+};
+
+layout(std140) uniform MaterialData
+{
+    MaterialParams material;
+    vec4 tintColor;
+    vec2 uvScale;
+    vec2 uvOffset;
+    bool debug_noTexture;
+};
+
+uniform MaterialMaps materialMaps;
 
 vec3 CalcDirLight(DirLight light, vec3 normal, vec3 viewDir);
 vec3 CalcPointLight(PointLight light, vec3 normal, vec3 fragPos, vec3 viewDir);
 vec3 CalcSpotLight(SpotLight light, vec3 normal, vec3 fragPos, vec3 viewDir);
 
-uniform bool debug_noTexture;
 
 void main()
 {
@@ -106,9 +124,9 @@ vec3 CalcDirLight(DirLight light, vec3 normal, vec3 viewDir)
          diffuse = light.diffuse * light.intensity * diff * vec3(1.0);
          specular = light.specular * light.intensity * spec * vec3(0.5) * material.specular;
     } else {
-         ambient = light.ambient * light.intensity * vec3(texture(material.texture_diffuse1, TexCoords));
-         diffuse = light.diffuse * light.intensity * diff * vec3(texture(material.texture_diffuse1, TexCoords));
-         specular = light.specular * light.intensity * spec * vec3(texture(material.texture_specular1, TexCoords)) * material.specular;
+         ambient = light.ambient * light.intensity * vec3(texture(materialMaps.texture_diffuse1, TexCoords));
+         diffuse = light.diffuse * light.intensity * diff * vec3(texture(materialMaps.texture_diffuse1, TexCoords));
+         specular = light.specular * light.intensity * spec * vec3(texture(materialMaps.texture_specular1, TexCoords)) * material.specular;
     }
     return (ambient + diffuse + specular);
 }
@@ -130,9 +148,9 @@ vec3 CalcPointLight(PointLight light, vec3 normal, vec3 fragPos, vec3 viewDir)
          diffuse = light.diffuse * light.intensity * diff * vec3(1.0);
          specular = light.specular * light.intensity * spec * vec3(0.5) * material.specular;
     } else {
-         ambient = light.ambient * light.intensity * vec3(texture(material.texture_diffuse1, TexCoords));
-         diffuse = light.diffuse * light.intensity * diff * vec3(texture(material.texture_diffuse1, TexCoords));
-         specular = light.specular * light.intensity * spec * vec3(texture(material.texture_specular1, TexCoords)) * material.specular;
+         ambient = light.ambient * light.intensity * vec3(texture(materialMaps.texture_diffuse1, TexCoords));
+         diffuse = light.diffuse * light.intensity * diff * vec3(texture(materialMaps.texture_diffuse1, TexCoords));
+         specular = light.specular * light.intensity * spec * vec3(texture(materialMaps.texture_specular1, TexCoords)) * material.specular;
     }
     ambient *= attenuation;
     diffuse *= attenuation;
@@ -161,9 +179,9 @@ vec3 CalcSpotLight(SpotLight light, vec3 normal, vec3 fragPos, vec3 viewDir)
          diffuse = light.diffuse * light.intensity * diff * vec3(1.0);
          specular = light.specular * light.intensity * spec * vec3(0.5) * material.specular;
     } else {
-         ambient = light.ambient * light.intensity * vec3(texture(material.texture_diffuse1, TexCoords));
-         diffuse = light.diffuse * light.intensity * diff * vec3(texture(material.texture_diffuse1, TexCoords));
-         specular = light.specular * light.intensity * spec * vec3(texture(material.texture_specular1, TexCoords)) * material.specular;
+         ambient = light.ambient * light.intensity * vec3(texture(materialMaps.texture_diffuse1, TexCoords));
+         diffuse = light.diffuse * light.intensity * diff * vec3(texture(materialMaps.texture_diffuse1, TexCoords));
+         specular = light.specular * light.intensity * spec * vec3(texture(materialMaps.texture_specular1, TexCoords)) * material.specular;
     }
     
     ambient *= attenuation * intensity;
@@ -1,14 +1,9 @@
 #version 430 core
 out vec4 FragColor;
 
-struct Material {
+struct MaterialMaps {
     sampler2D texture_diffuse1;
     sampler2D texture_specular1;
-    float shininess;
-    vec3 specular;
-    vec3 ambient;
-    vec3 emission;
-    float opacity;
 };
 
 struct DirLight {
@@ -63,20 +58,45 @@ in vec2 TexCoords;
 in vec4 FragPosLightSpace[2]; // Array for 2 directional light shadows
 in vec4 FragPosLightSpaceSpot[2]; // Array for 2 spot light shadows
 
-uniform vec3 viewPos;
-uniform Material material;
-uniform int numDirLights;
-uniform int nrPointLights;
-uniform int nrSpotLights;
-uniform vec4 tintColor;
-uniform bool u_ReceiveShadow;
-uniform sampler2D shadowMapDir[NR_DIR_SHADOW_MAPS]; // Array of 2 shadow maps
-uniform samplerCube shadowMapPoint[NR_POINT_SHADOW_MAPS];
-uniform sampler2D shadowMapSpot[NR_SPOT_SHADOW_MAPS]; // Array of 2 spot shadow maps
-uniform float farPlanePoint;
-uniform float farPlaneSpot;
-
-uniform bool debug_noTexture;
+layout(std140) uniform FrameData
+{
+    mat4 view;
+    mat4 projection;
+    vec3 viewPos;
+    int numDirLights;
+    int nrPointLights;
+    int nrSpotLights;
+};
+
+layout(std140) uniform ShadowData
+{
+    mat4 lightSpaceMatrix[2]; // Dir light space matrices
+    mat4 lightSpaceMatrixSpot[2]; // Spot light space matrices
+    float farPlanePoint;
+    float farPlaneSpot;
+    bool u_ReceiveShadow;
+};
+
+struct MaterialParams {
+    vec3 specular; float shininess;
+    vec3 ambient; float opacity;
+    vec3 emission; float roughness;
+    float metallic; float ao;
+};
+
+layout(std140) uniform MaterialData
+{
+    MaterialParams material;
+    vec4 tintColor;
+    vec2 uvScale;
+    vec2 uvOffset;
+    bool debug_noTexture;
+};
+
+uniform MaterialMaps materialMaps;
+layout(binding = 10) uniform sampler2D shadowMapDir[NR_DIR_SHADOW_MAPS]; // Array of 2 shadow maps
+layout(binding = 12) uniform samplerCube shadowMapPoint[NR_POINT_SHADOW_MAPS];
+layout(binding = 14) uniform sampler2D shadowMapSpot[NR_SPOT_SHADOW_MAPS]; // Array of 2 spot shadow maps
 
 vec3 CalcDirLight(DirLight light, vec3 normal, vec3 viewDir);
 vec3 CalcDirLightWithShadow(DirLight light, vec3 normal, vec3 viewDir, int lightIndex);
@@ -117,7 +137,7 @@ void main()
     if (debug_noTexture) {
         texColor = vec4(1.0);
     } else {
-        texColor = texture(material.texture_diffuse1, TexCoords);
+        texColor = texture(materialMaps.texture_diffuse1, TexCoords);
     }
     
     vec3 emission = material.emission;
@@ -140,9 +160,9 @@ vec3 CalcDirLightWithShadow(DirLight light, vec3 normal, vec3 viewDir, int light
          diffuse = light.diffuse * light.intensity * diff * vec3(1.0);
          specular = light.specular * light.intensity * spec * vec3(0.5) * material.specular;
     } else {
-         ambient = light.ambient * light.intensity * vec3(texture(material.texture_diffuse1, TexCoords)) * material.ambient;
-         diffuse = light.diffuse * light.intensity * diff * vec3(texture(material.texture_diffuse1, TexCoords));
-         specular = light.specular * light.intensity * spec * vec3(texture(material.texture_specular1, TexCoords)) * material.specular;
+         ambient = light.ambient * light.intensity * vec3(texture(materialMaps.texture_diffuse1, TexCoords)) * material.ambient;
+         diffuse = light.diffuse * light.intensity * diff * vec3(texture(materialMaps.texture_diffuse1, TexCoords));
+         specular = light.specular * light.intensity * spec * vec3(texture(materialMaps.texture_specular1, TexCoords)) * material.specular;
     }
 
     float shadow = u_ReceiveShadow ? ShadowCalculationDir(FragPosLightSpace[lightIndex], normal, lightDir, lightIndex) : 0.0;
@@ -190,9 +210,9 @@ vec3 CalcDirLight(DirLight light, vec3 normal, vec3 viewDir)
          diffuse = light.diffuse * light.intensity * diff * vec3(1.0);
          specular = light.specular * light.intensity * spec * vec3(0.5) * material.specular;
     } else {
-         ambient = light.ambient * light.intensity * vec3(texture(material.texture_diffuse1, TexCoords)) * material.ambient;
-         diffuse = light.diffuse * light.intensity * diff * vec3(texture(material.texture_diffuse1, TexCoords));
-         specular = light.specular * light.intensity * spec * vec3(texture(material.texture_specular1, TexCoords)) * material.specular;
+         ambient = light.ambient * light.intensity * vec3(texture(materialMaps.texture_diffuse1, TexCoords)) * material.ambient;
+         diffuse = light.diffuse * light.intensity * diff * vec3(texture(materialMaps.texture_diffuse1, TexCoords));
+         specular = light.specular * light.intensity * spec * vec3(texture(materialMaps.texture_specular1, TexCoords)) * material.specular;
     }
 
     return (ambient + diffuse + specular);
@@ -216,9 +236,9 @@ vec3 CalcPointLight(PointLight light, vec3 normal, vec3 fragPos, vec3 viewDir, i
          diffuse = light.diffuse * light.intensity * diff * vec3(1.0);
          specular = light.specular * light.intensity * spec * vec3(0.5) * material.specular;
     } else {
-         ambient = light.ambient * light.intensity * vec3(texture(material.texture_diffuse1, TexCoords)) * material.ambient;
-         diffuse = light.diffuse * light.intensity * diff * vec3(texture(material.texture_diffuse1, TexCoords));
-         specular = light.specular * light.intensity * spec * vec3(texture(material.texture_specular1, TexCoords)) * material.specular;
+         ambient = light.ambient * light.intensity * vec3(texture(materialMaps.texture_diffuse1, TexCoords)) * material.ambient;
+         diffuse = light.diffuse * light.intensity * diff * vec3(texture(materialMaps.texture_diffuse1, TexCoords));
+         specular = light.specular * light.intensity * spec * vec3(texture(materialMaps.texture_specular1, TexCoords)) * material.specular;
     }
 
     ambient *= attenuation;
@@ -263,9 +283,9 @@ vec3 CalcSpotLight(SpotLight light, vec3 normal, vec3 fragPos, vec3 viewDir)
          diffuse = light.diffuse * light.intensity * diff * vec3(1.0);
          specular = light.specular * light.intensity * spec * vec3(0.5) * material.specular;
     } else {
-         ambient = light.ambient * light.intensity * vec3(texture(material.texture_diffuse1, TexCoords)) * material.ambient;
-         diffuse = light.diffuse * light.intensity * diff * vec3(texture(material.texture_diffuse1, TexCoords));
-         specular = light.specular * light.intensity * spec * vec3(texture(material.texture_specular1, TexCoords)) * material.specular;
+         ambient = light.ambient * light.intensity * vec3(texture(materialMaps.texture_diffuse1, TexCoords)) * material.ambient;
+         diffuse = light.diffuse * light.intensity * diff * vec3(texture(materialMaps.texture_diffuse1, TexCoords));
+         specular = light.specular * light.intensity * spec * vec3(texture(materialMaps.texture_specular1, TexCoords)) * material.specular;
     }
 
     ambient *= attenuation * intensity;
@@ -330,9 +350,9 @@ vec3 CalcSpotLight(SpotLight light, vec3 normal, vec3 fragPos, vec3 viewDir, int
          diffuse = light.diffuse * light.intensity * diff * vec3(1.0);
          specular = light.specular * light.intensity * spec * vec3(0.5) * material.specular;
     } else {
-         ambient = light.ambient * light.intensity * vec3(texture(material.texture_diffuse1, TexCoords)) * material.ambient;
-         diffuse = light.diffuse * light.intensity * diff * vec3(texture(material.texture_diffuse1, TexCoords));
-         specular = light.specular * light.intensity * spec * vec3(texture(material.texture_specular1, TexCoords)) * material.specular;
+         ambient = light.ambient * light.intensity * vec3(texture(materialMaps.texture_diffuse1, TexCoords)) * material.ambient;
+         diffuse = light.diffuse * light.intensity * diff * vec3(texture(materialMaps.texture_diffuse1, TexCoords));
+         specular = light.specular * light.intensity * spec * vec3(texture(materialMaps.texture_specular1, TexCoords)) * material.specular;
     }
 
     ambient *= attenuation * intensity;
@@ -4,12 +4,22 @@ out vec4 FragColor;
 in vec2 TexCoords;
 
 uniform sampler2D texture_diffuse1;
-uniform vec4 tintColor;
 
-uniform vec2 uvScale = vec2(1.0, 1.0);
-uniform vec2 uvOffset = vec2(0.0, 0.0);
+struct MaterialParams {
+    vec3 specular; float shininess;
+    vec3 ambient; float opacity;
+    vec3 emission; float roughness;
+    float metallic; float ao;
+};
 
-uniform bool debug_noTexture;
+layout(std140) uniform MaterialData
+{
+    MaterialParams material;
+    vec4 tintColor;
+    vec2 uvScale;
+    vec2 uvOffset;
+    bool debug_noTexture;
+};
 
 void main()
 {    
@@ -7,15 +7,26 @@ layout (location = 6) in vec4 aWeights;
 out vec2 TexCoords;
 
 uniform mat4 model;
-uniform mat4 view;
-uniform mat4 projection;
+
+layout(std140) uniform FrameData
+{
+    mat4 view;
+    mat4 projection;
+    vec3 viewPos;
+    int numDirLights;
+    int nrPointLights;
+    int nrSpotLights;
+};
 
 layout(location = 10) in mat4 instanceMatrix;
 uniform bool isInstanced;
 
 const int MAX_BONES = 100;
 const int MAX_BONE_INFLUENCE = 4;
-uniform mat4 finalBonesMatrices[MAX_BONES];
+layout(std140) uniform SkinningData
+{
+    mat4 finalBonesMatrices[MAX_BONES];
+};
 
 void main()
 {
@@ -3,6 +3,7 @@
 #ifdef ENABLE_DEBUG_SYSTEM
 
 #include <app/application.h>
+#include <graphic/core/render_device.h>
 #include <iostream>
 #include <GLFW/glfw3.h>
 #include <sstream>
@@ -61,6 +62,13 @@ void OverlayDebugModule::Render(Scene &scene)
     {
         ss << "FPS: " << m_CurrentFps << " (" << m_CurrentFrameTime << " ms)\n";
         ss << "Entities: " << totalEntities << " | Rendered: " << renderedEntities << "\n";
+        const RenderDeviceStats &gpu = RenderDevice::GetFrameStats();
+        ss << "Draws: " << gpu.drawCalls << " | States: " << gpu.stateChanges
+           << " | Upload: " << (gpu.bytesUploaded / 1024.0) << " KB\n";
+        const AnimationStats &anim = m_App->GetAnimationSystem().GetStats();
+        ss << "Animators: " << anim.updated << " updated | " << anim.skipped << " skipped\n";
+        const PhysicsSyncStats &sync = m_App->GetPhysicsSystem().GetSyncStats();
+        ss << "Bodies: " << sync.bodies << " | Synced: " << sync.fromPhysics << " in, " << sync.toPhysics << " out\n";
         ss << "TimeScale: " << m_App->GetTimeScale() << "x | Paused: " << (m_App->IsPaused() ? "YES" : "NO") << "\n";
     };
 
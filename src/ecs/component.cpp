@@ -1,5 +1,6 @@
 #include <ecs/component.h>
 #include <graphic/core/video_decoder.h>
+#include <physic/physic_world.h>
 
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtx/matrix_decompose.hpp>
@@ -43,26 +44,30 @@ glm::mat4 TransformComponent::GetWorldModelMatrix(entt::registry& registry) cons
         {
             const auto& parentTrans = registry.get<TransformComponent>(parent);
             glm::mat4 parentWorld = parentTrans.GetWorldModelMatrix(registry); 
-            uint32_t parentVer = parentTrans.GetVersion(); 
+            uint32_t parentVer = parentTrans.GetWorldVersion(); 
 
             if (parentChanged || parentVer != m_LastParentVersion || m_Version != m_LastLocalVersion)
             {
                 m_WorldMatrix = parentWorld * m_LocalMatrix;
                 m_LastParentVersion = parentVer;
                 m_LastLocalVersion = m_Version;
+                m_WorldVersion++;
             }
         }
-        else
+        else if (parentChanged || m_Version != m_LastLocalVersion)
         {
              m_WorldMatrix = m_LocalMatrix;
+             m_LastLocalVersion = m_Version;
+             m_WorldVersion++;
         }
     }
     else
     {
-        if (m_Version != m_LastLocalVersion)
+        if (parentChanged || m_Version != m_LastLocalVersion)
         {
              m_WorldMatrix = m_LocalMatrix;
              m_LastLocalVersion = m_Version;
+             m_WorldVersion++;
         }
     }
     
@@ -169,4 +174,9 @@ void VideoPlayerComponent::Replay()
 void VideoPlayerComponent::Seek(double time)
 {
     if (decoder) decoder->Seek(time);
-}
\ No newline at end of file
+}
+
+bool RigidBodyComponent::IsDeferringWrites() const
+{
+    return world && world->IsStepping();
+}
@@ -1,20 +1,88 @@
 #include <ecs/system.h>
 #include <execution>
 #include <ecs/component.h>
+#include <utils/profiler.h>
+
+namespace
+{
+    // Frames between two updates at each LOD; Frozen never updates
+    constexpr uint32_t LOD_INTERVALS[] = {1, 2, 4, 0};
+}
+
+AnimationLod AnimationSystem::SelectLod(const AnimationComponent &anim, uint32_t visibilityFrame) const
+{
+    // Nothing has been culled yet (no camera, headless tools): keep everything at full rate
+    if (!m_Lod.enabled || visibilityFrame == 0)
+        return AnimationLod::Full;
+
+    if (anim.visibleFrame != visibilityFrame)
+        return m_Lod.freezeHidden ? AnimationLod::Frozen : AnimationLod::Quarter;
+
+    if (anim.screenSize >= m_Lod.fullScreenSize)
+        return AnimationLod::Full;
+    if (anim.screenSize >= m_Lod.halfScreenSize)
+        return AnimationLod::Half;
+    return AnimationLod::Quarter;
+}
 
 void AnimationSystem::Update(Scene &scene, float dt)
 {
     if (!m_Enabled) return;
+    AXIS_PROFILE_SCOPE("AnimationSystem::Update");
 
     auto view = scene.registry.view<AnimationComponent>();
 
-    m_Entities.assign(view.begin(), view.end());
+    m_Stats = {};
+    ++m_FrameIndex;
+    const uint32_t visibilityFrame = scene.GetVisibilityFrame();
+
+    // Pick a LOD per animator; reduced-rate animators are phased by entity id so their updates
+    // spread evenly over the interval instead of landing on the same frame
+    m_Entities.clear();
+    for (auto entity : view)
+    {
+        auto &anim = view.get<AnimationComponent>(entity);
+        if (!anim.animator)
+            continue;
 
-    std::for_each(std::execution::par, m_Entities.begin(), m_Entities.end(), [&scene, dt](entt::entity entity)
+        anim.lod = SelectLod(anim, visibilityFrame);
+        anim.pendingDt += dt;
+        ++m_Stats.lodCounts[static_cast<int>(anim.lod)];
+
+        uint32_t interval = LOD_INTERVALS[static_cast<int>(anim.lod)];
+        uint32_t phase = static_cast<uint32_t>(entt::to_entity(entity));
+        if (interval == 0 || (m_FrameIndex + phase) % interval != 0)
+        {
+            ++m_Stats.skipped;
+            continue;
+        }
+
+        m_Entities.push_back(entity);
+    }
+    m_Stats.updated = static_cast<int>(m_Entities.size());
+
+    // Clips are shared and read-only; each animator only writes its own cursors and palette
+
+    const int quarterMaxDepth = m_Lod.quarterMaxDepth;
+    std::for_each(std::execution::par, m_Entities.begin(), m_Entities.end(), [&scene, quarterMaxDepth](entt::entity entity)
                   {
+        AXIS_PROFILE_SCOPE("AnimationSystem::UpdateAnimator");
         auto &anim = scene.registry.get<AnimationComponent>(entity);
-        if (anim.animator)
-        {
-            anim.animator->UpdateAnimation(dt);
-        } });
+
+        bool reduced = anim.lod == AnimationLod::Quarter;
+        anim.animator->SetMaxSampledDepth(reduced ? quarterMaxDepth : -1);
+        anim.animator->SetRotationInterpolation(reduced ? RotationInterpolation::Nlerp : RotationInterpolation::Slerp);
+
+        // Skipped frames are caught up in one step, so playback time never drifts
+        anim.animator->UpdateAnimation(anim.pendingDt);
+        anim.pendingDt = 0.0f; });
+
+    // Baked crowds only advance a clock; skinning happens in the vertex shader
+    auto bakedView = scene.registry.view<BakedAnimationComponent>();
+    for (auto entity : bakedView)
+    {
+        auto &baked = bakedView.get<BakedAnimationComponent>(entity);
+        if (baked.baked)
+            baked.time = baked.baked->WrapTime(baked.clip, baked.time + dt * baked.speed);
+    }
 }
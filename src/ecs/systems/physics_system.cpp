@@ -27,6 +27,9 @@ void PhysicsSystem::WaitAsyncPhysics()
 
 void PhysicsSystem::Update(Scene &scene, PhysicsWorld &physicsWorld, float dt)
 {
+    if ((!m_Enabled || !m_Pipelined) && physicsWorld.IsStepping())
+        EndPipelinedStep(scene, physicsWorld);
+
     if (!m_Enabled)
         return;
 
@@ -37,9 +40,18 @@ void PhysicsSystem::Update(Scene &scene, PhysicsWorld &physicsWorld, float dt)
         m_transformSync->Init();
     }
 
+    if (m_Pipelined)
+    {
+        UpdatePipelined(scene, physicsWorld, dt);
+        return;
+    }
+
     m_transformSync->SyncToPhysics();
 
-    if (m_AsyncPhysics)
+    // The Mt world already spreads the step over the worker pool, and each std::async launch may be a new
+    // thread that would take another of Bullet's permanent thread indices
+    const bool async = m_AsyncPhysics && !physicsWorld.IsParallel();
+    if (async)
     {
         WaitAsyncPhysics();
 
@@ -51,13 +63,51 @@ void PhysicsSystem::Update(Scene &scene, PhysicsWorld &physicsWorld, float dt)
         physicsWorld.Update(dt);
     }
 
-    if (m_AsyncPhysics)
+    if (async)
     {
         WaitAsyncPhysics();
     }
 
     m_transformSync->SyncFromPhysics();
-    
+    m_SyncStats = m_transformSync->GetStats();
+    DispatchCollisions(scene, physicsWorld);
+}
+
+void PhysicsSystem::UpdatePipelined(Scene &scene, PhysicsWorld &physicsWorld, float dt)
+{
+    // Sync point: the step begun last call is done and nothing else runs on the world until BeginStep
+    physicsWorld.WaitForStep();
+
+    m_transformSync->CaptureSnapshot();
+    DispatchCollisions(scene, physicsWorld);
+    FlushPendingWrites(scene);
+    m_transformSync->SyncToPhysics();
+    m_SyncStats = m_transformSync->GetStats();
+
+    physicsWorld.BeginStep(dt);
+}
+
+void PhysicsSystem::EndPipelinedStep(Scene &scene, PhysicsWorld &physicsWorld)
+{
+    physicsWorld.WaitForStep();
+    FlushPendingWrites(scene);
+
+    // Snapshots go stale while not pipelined; start over if it is turned back on
+    if (m_transformSync)
+        m_transformSync->ResetSnapshots();
+}
+
+void PhysicsSystem::FlushPendingWrites(Scene &scene)
+{
+    for (auto [entity, rb] : scene.registry.view<RigidBodyComponent>().each())
+    {
+        if (rb.pending.mask)
+            rb.FlushPendingWrites();
+    }
+}
+
+void PhysicsSystem::DispatchCollisions(Scene &scene, PhysicsWorld &physicsWorld)
+{
     if (!m_collisionDispatcher)
     {
         LOGGER_INFO("PhysicsSystem") << "Initializing Physics Collision Dispatcher";
@@ -66,6 +116,20 @@ void PhysicsSystem::Update(Scene &scene, PhysicsWorld &physicsWorld, float dt)
     m_collisionDispatcher->DispatchEvents();
 }
 
+const std::vector<CollisionEvent> &PhysicsSystem::GetCollisionEvents() const
+{
+    static const std::vector<CollisionEvent> s_NoEvents;
+    return m_collisionDispatcher ? m_collisionDispatcher->GetEvents() : s_NoEvents;
+}
+
+void PhysicsSystem::Interpolate(float alpha)
+{
+    if (!m_Enabled || !m_Pipelined || !m_transformSync)
+        return;
+
+    m_transformSync->ApplySnapshot(alpha);
+}
+
 void PhysicsSystem::RenderDebug(Scene &scene, PhysicsWorld &physicsWorld, Shader &shader, int screenWidth, int screenHeight)
 {
     DebugDrawer *drawer = physicsWorld.GetDebugDrawer();
@@ -1,5 +1,7 @@
 #include <ecs/systems/render_system.h>
+#include <ecs/systems/transform_system.h>
 #include <graphic/renderer/frustum.h>
+#include <graphic/renderer/culling.h>
 #include <string>
 #include <algorithm>
 #include <vector>
@@ -9,6 +11,16 @@
 #include <glm/gtx/norm.hpp>
 #include <resource/resource_manager.h>
 
+// Height of the item's bounding sphere on screen, as a fraction of the viewport height
+static float ProjectedScreenSize(const RenderQueueItem &item, const glm::mat4 &projection, const glm::vec3 &cameraPos)
+{
+    glm::vec3 center = 0.5f * (item.worldMin + item.worldMax);
+    float radius = 0.5f * glm::length(item.worldMax - item.worldMin);
+    if (projection[3][3] != 0.0f)
+        return radius * projection[1][1];
+    return radius * projection[1][1] / (std::max)(glm::length(center - cameraPos), 1e-3f);
+}
+
 void RenderSystem::InitShadows(ResourceManager &res)
 {
     LOGGER_INFO("RenderSystem") << "Initializing shadow and light renderers";
@@ -29,12 +41,42 @@ void RenderSystem::InitShadows(ResourceManager &res)
 void RenderSystem::Shutdown()
 {
     LOGGER_INFO("RenderSystem") << "Shutting down RenderSystem";
+    m_RenderQueue.Detach();
     m_ShadowRenderer.Shutdown();
+    m_InstanceRing.Shutdown();
+    m_MeshArena.Shutdown();
+    m_UniformRing.Shutdown();
+    m_FrameUniforms.Shutdown();
+    m_ShadowUniforms.Shutdown();
 }
 
 void RenderSystem::RenderShadows(Scene &scene)
 {
-    m_ShadowRenderer.RenderShadows(scene);
+    PrepareQueue(scene);
+    m_ShadowRenderer.RenderShadows(scene, m_RenderQueue);
+}
+
+void RenderSystem::PrepareQueue(Scene &scene)
+{
+    if (m_QueuePrepared)
+        return;
+
+    glm::vec3 cameraPos(0.0f);
+    entt::entity camEntity = scene.GetActiveCamera();
+    if (camEntity != entt::null)
+        cameraPos = scene.registry.get<TransformComponent>(camEntity).position;
+
+    m_RenderQueue.Attach(scene.registry, &scene.GetSpatialTree());
+    if (m_TransformSystem && m_TransformSystem->IsEnabled())
+    {
+        m_RenderQueue.Update(cameraPos, &m_TransformSystem->GetMovedEntities());
+        m_TransformSystem->ClearMoved();
+    }
+    else
+    {
+        m_RenderQueue.Update(cameraPos);
+    }
+    m_QueuePrepared = true;
 }
 
 void RenderSystem::SetFaceCulling(bool enabled, int mode)
@@ -65,6 +107,10 @@ void RenderSystem::SetDepthTest(bool enabled, int func)
 
 void RenderSystem::Render(Scene &scene, int width, int height)
 {
+    // Render closes the frame: the next shadow pass must refresh the queue again
+    bool queuePrepared = m_QueuePrepared;
+    m_QueuePrepared = false;
+
     if (!m_Enabled)
         return;
 
@@ -127,184 +173,166 @@ void RenderSystem::Render(Scene &scene, int width, int height)
     if (cam)
         frustum.Update(m_CurrViewProj);
 
-    m_RenderQueue.clear();
+    if (!queuePrepared)
+        PrepareQueue(scene);
+    m_QueuePrepared = false;
 
-    auto view = scene.registry.view<TransformComponent, MeshRendererComponent>();
-    for (auto entity : view)
+    const BoundsSoA &bounds = m_RenderQueue.GetBounds();
+    if (m_FrustumCullingEnabled && m_HierarchicalCulling)
     {
-        auto [transform, renderer] = view.get<TransformComponent, MeshRendererComponent>(entity);
-
-        if (!renderer.model || !renderer.shader)
-            continue;
-
-        glm::mat4 modelMatrix = transform.GetWorldModelMatrix(scene.registry);
-        glm::vec3 min = renderer.model->AABBmin;
-        glm::vec3 max = renderer.model->AABBmax;
-
-        glm::vec3 center = (min + max) * 0.5f;
-        glm::vec3 extent = (max - min) * 0.5f;
-
-        glm::vec3 worldCenter = glm::vec3(modelMatrix * glm::vec4(center, 1.0f));
-
-        glm::mat3 rot = glm::mat3(modelMatrix);
-        glm::vec3 worldExtent = glm::vec3(
-            std::abs(rot[0][0]) * extent.x + std::abs(rot[1][0]) * extent.y + std::abs(rot[2][0]) * extent.z,
-            std::abs(rot[0][1]) * extent.x + std::abs(rot[1][1]) * extent.y + std::abs(rot[2][1]) * extent.z,
-            std::abs(rot[0][2]) * extent.x + std::abs(rot[1][2]) * extent.y + std::abs(rot[2][2]) * extent.z);
-
-        glm::vec3 worldMin = worldCenter - worldExtent;
-        glm::vec3 worldMax = worldCenter + worldExtent;
-
-        if (m_DistanceCullingSq > 0.0f && cam && camTrans)
-        {
-            glm::vec3 cameraPos = camTrans->position;
-            float dx = (std::max)(worldMin.x - cameraPos.x, (std::max)(0.0f, cameraPos.x - worldMax.x));
-            float dy = (std::max)(worldMin.y - cameraPos.y, (std::max)(0.0f, cameraPos.y - worldMax.y));
-            float dz = (std::max)(worldMin.z - cameraPos.z, (std::max)(0.0f, cameraPos.z - worldMax.z));
-            
-            float distSq = dx*dx + dy*dy + dz*dz;
-            
-            if (distSq > m_DistanceCullingSq)
-                continue;
-        }
+        Culling::HierarchicalCull(scene.GetSpatialTree(), frustum, camTrans->position, m_DistanceCullingSq, bounds.count, m_CameraVisibility);
+    }
+    else
+    {
+        Culling::SetAll(bounds.count, m_CameraVisibility);
 
-        if (cam && m_FrustumCullingEnabled)
-        {
-            if (!frustum.IsBoxVisible(worldMin, worldMax))
-                continue;
-        }
+        if (m_FrustumCullingEnabled)
+            Culling::FrustumCull(frustum, bounds, m_CameraVisibility);
 
-        m_RenderQueue.emplace_back(RenderItem{entity, &transform, &renderer});
+        if (m_DistanceCullingSq > 0.0f)
+            Culling::DistanceCull(camTrans->position, m_DistanceCullingSq, bounds, m_CameraVisibility);
     }
 
-    std::sort(m_RenderQueue.begin(), m_RenderQueue.end(), [](const RenderItem &lhs, const RenderItem &rhs)
-              {
-        if (lhs.renderer->shader != rhs.renderer->shader)
-            return lhs.renderer->shader < rhs.renderer->shader;
-        return lhs.renderer->model < rhs.renderer->model; });
+    scene.AdvanceVisibilityFrame();
 
-    static std::vector<std::string> bonesUniforms;
-    if (bonesUniforms.empty())
-    {
-        bonesUniforms.reserve(100);
-        for (int i = 0; i < 100; ++i)
-            bonesUniforms.push_back("finalBonesMatrices[" + std::to_string(i) + "]");
-    }
-    static std::vector<std::string> shadowPointUniforms;
-    if (shadowPointUniforms.empty())
-    {
-        shadowPointUniforms.reserve(Shadow::MAX_POINT_LIGHTS_SHADOW);
-        for (int i = 0; i < Shadow::MAX_POINT_LIGHTS_SHADOW; ++i)
-            shadowPointUniforms.push_back("shadowMapPoint[" + std::to_string(i) + "]");
-    }
-    static std::vector<std::string> shadowDirUniforms;
-    if (shadowDirUniforms.empty())
+    m_VisibleItems.clear();
+    const auto &queueItems = m_RenderQueue.GetItems();
+    Culling::ForEachVisible(m_CameraVisibility, [&](size_t index)
     {
-        shadowDirUniforms.reserve(Shadow::MAX_DIR_LIGHTS_SHADOW);
-        for (int i = 0; i < Shadow::MAX_DIR_LIGHTS_SHADOW; ++i)
-            shadowDirUniforms.push_back("shadowMapDir[" + std::to_string(i) + "]");
-    }
-    static std::vector<std::string> shadowSpotUniforms;
-    if (shadowSpotUniforms.empty())
-    {
-        shadowSpotUniforms.reserve(Shadow::MAX_SPOT_LIGHTS_SHADOW);
-        for (int i = 0; i < Shadow::MAX_SPOT_LIGHTS_SHADOW; ++i)
-           shadowSpotUniforms.push_back("shadowMapSpot[" + std::to_string(i) + "]");
-    }
-    static std::vector<std::string> lightSpaceMatrixUniforms;
-    if (lightSpaceMatrixUniforms.empty())
-    {
-         lightSpaceMatrixUniforms.reserve(Shadow::MAX_DIR_LIGHTS_SHADOW);
-         for (int i = 0; i < Shadow::MAX_DIR_LIGHTS_SHADOW; ++i)
-             lightSpaceMatrixUniforms.push_back("lightSpaceMatrix[" + std::to_string(i) + "]");
-    }
-    static std::vector<std::string> lightSpaceMatrixSpotUniforms;
-    if (lightSpaceMatrixSpotUniforms.empty())
+        const RenderQueueItem &item = queueItems[index];
+        if (item.model && item.shader)
+            m_VisibleItems.push_back(&item);
+    });
+
+    if (!m_FrameUniforms.IsInitialized())
     {
-         lightSpaceMatrixSpotUniforms.reserve(Shadow::MAX_SPOT_LIGHTS_SHADOW);
-         for (int i = 0; i < Shadow::MAX_SPOT_LIGHTS_SHADOW; ++i)
-             lightSpaceMatrixSpotUniforms.push_back("lightSpaceMatrixSpot[" + std::to_string(i) + "]");
+        m_FrameUniforms.Init(sizeof(GPUFrameData), UniformBlock::Frame);
+        m_ShadowUniforms.Init(sizeof(GPUShadowData), UniformBlock::Shadow);
     }
+    if (!m_UniformRing.IsInitialized())
+        m_UniformRing.Init(UNIFORM_RING_BYTES_PER_FRAME);
+    m_UniformRing.BeginFrame();
+
+    bool receiveShadows = m_ShadowRenderer.IsShadowsEnabled() && m_ShadowRenderer.GetShadowMode() > 0;
+    m_LightRenderer.Upload(scene);
+    UploadFrameUniforms(projectionMatrix, cam->viewMatrix, camTrans->position, receiveShadows);
 
     Shader *currentShader = nullptr;
     Model *currentModel = nullptr;
-    std::vector<glm::mat4> instanceBatch;
+    uint16_t currentMaterial = 0;
+    BakedAnimation *currentBaked = nullptr;
+    std::vector<glm::mat4> &instanceBatch = m_InstanceBatch;
+    instanceBatch.clear();
     m_RenderedCount = 0;
 
+    if (!m_InstanceRing.IsInitialized())
+        m_InstanceRing.Init(INSTANCE_RING_BYTES_PER_FRAME);
+    m_InstanceRing.BeginFrame();
+
+    // Each batch is written once; every sub-mesh of the model reads the same allocation
     auto flushBatch = [&](Shader *shader, Model *model)
     {
         if (!instanceBatch.empty() && shader && model)
         {
-            model->DrawInstanced(*shader, instanceBatch);
+            size_t offset = m_InstanceRing.Write(instanceBatch.data(), instanceBatch.size() * sizeof(glm::mat4), sizeof(glm::mat4));
+            if (offset == GpuRingBuffer::INVALID_OFFSET)
+            {
+                instanceBatch.clear();
+                return;
+            }
+            if (currentBaked)
+            {
+                // Instances skin themselves from the baked texture; see BakedAnimation::PackInstance
+                currentBaked->Bind(BAKED_BONES_UNIT);
+                shader->setInt("bakedBones"_uniform, BAKED_BONES_UNIT);
+                shader->setBool("useBakedBones"_uniform, true);
+            }
+            model->DrawInstanced(*shader, m_InstanceRing.GetBuffer(), m_InstanceRing.GetGeneration(), offset, instanceBatch.size());
+            if (currentBaked)
+                shader->setBool("useBakedBones"_uniform, false);
             m_RenderedCount += instanceBatch.size();
             instanceBatch.clear();
         }
     };
 
-    for (const auto &item : m_RenderQueue)
+    bool useIndirect = m_MultiDrawIndirect && m_InstanceBatchingEnabled && IsMultiDrawIndirectSupported();
+    if (useIndirect && !m_MeshArena.IsInitialized())
+        m_MeshArena.Init(MESH_ARENA_VERTICES, MESH_ARENA_INDICES);
+    m_IndirectBuilder.Reset();
+
+    // Submits everything gathered for the current shader: one glMultiDrawElementsIndirect per
+    // material/texture batch, all reading the shared arena and the instance ring
+    auto flushIndirect = [&](Shader *shader)
+    {
+        if (m_IndirectBuilder.Empty() || !shader)
+            return;
+
+        const auto &instances = m_IndirectBuilder.GetInstances();
+        size_t instanceBytes = instances.size() * sizeof(glm::mat4);
+        size_t commandBytes = m_IndirectBuilder.CountCommands() * sizeof(DrawElementsIndirectCommand);
+        m_InstanceRing.Reserve(instanceBytes + commandBytes + sizeof(glm::mat4));
+
+        size_t instanceOffset = m_InstanceRing.Write(instances.data(), instanceBytes, sizeof(glm::mat4));
+        if (instanceOffset == GpuRingBuffer::INVALID_OFFSET)
+        {
+            m_IndirectBuilder.Reset();
+            return;
+        }
+        m_IndirectBuilder.Finish(static_cast<uint32_t>(instanceOffset / sizeof(glm::mat4)));
+
+        const auto &commands = m_IndirectBuilder.GetCommands();
+        size_t commandOffset = m_InstanceRing.Write(commands.data(), commands.size() * sizeof(DrawElementsIndirectCommand), sizeof(uint32_t));
+        if (commandOffset == GpuRingBuffer::INVALID_OFFSET)
+        {
+            m_IndirectBuilder.Reset();
+            return;
+        }
+
+        m_MeshArena.Bind(m_InstanceRing.GetBuffer(), m_InstanceRing.GetGeneration());
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_InstanceRing.GetBuffer());
+        shader->setBool("isInstanced"_uniform, true);
+
+        uint64_t boundState = UINT64_MAX;
+        for (const IndirectBatch &batch : m_IndirectBuilder.GetBatches())
+        {
+            if (batch.stateKey != boundState)
+            {
+                entt::entity entity = m_VisibleItems[batch.userData]->entity;
+                SetupMaterialUniforms(shader, entity, scene, scene.registry.get<MeshRendererComponent>(entity).color);
+                boundState = batch.stateKey;
+            }
+
+            m_MeshArena.GetMesh(batch.meshId)->BindTextures(*shader);
+
+            const void *indirect = reinterpret_cast<const void *>(commandOffset + batch.firstCommand * sizeof(DrawElementsIndirectCommand));
+            glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, indirect, static_cast<GLsizei>(batch.commandCount), 0);
+        }
+
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+        glBindVertexArray(0);
+        shader->setBool("isInstanced"_uniform, false);
+        glActiveTexture(GL_TEXTURE0);
+
+        m_RenderedCount += instances.size();
+        m_IndirectBuilder.Reset();
+    };
+
+    for (size_t visibleIndex = 0; visibleIndex < m_VisibleItems.size(); ++visibleIndex)
     {
-        entt::entity entity = item.entity;
-        TransformComponent &transform = *item.transform;
-        MeshRendererComponent &renderer = *item.renderer;
+        const RenderQueueItem *item = m_VisibleItems[visibleIndex];
+        entt::entity entity = item->entity;
+        TransformComponent &transform = scene.registry.get<TransformComponent>(entity);
+        MeshRendererComponent &renderer = scene.registry.get<MeshRendererComponent>(entity);
 
-        if (currentShader != renderer.shader)
+        if (currentShader != item->shader)
         {
             flushBatch(currentShader, currentModel);
-            currentShader = renderer.shader;
+            flushIndirect(currentShader);
+            currentShader = item->shader;
             currentModel = nullptr;
             currentShader->use();
 
-            if (cam && camTrans)
-            {
-                currentShader->setMat4("projection", projectionMatrix);
-                currentShader->setMat4("view", cam->viewMatrix);
-                currentShader->setVec3("viewPos", camTrans->position);
-
-                // Pass shadow uniforms
-                if (m_ShadowRenderer.IsShadowsEnabled() && m_ShadowRenderer.GetShadowMode() > 0)
-                {
-                   currentShader->setBool("u_ReceiveShadow", true); // Or use individual flags if needed
-
-                   // Bind shadow maps
-                   for (int i = 0; i < Shadow::MAX_DIR_LIGHTS_SHADOW; ++i)
-                   {
-                       m_ShadowRenderer.GetShadow().BindTexture_Dir(i, 10 + i);
-                       currentShader->setInt(shadowDirUniforms[i], 10 + i);
-                   }
-
-                   for (int i = 0; i < Shadow::MAX_POINT_LIGHTS_SHADOW; ++i)
-                   {
-                       m_ShadowRenderer.GetShadow().BindTexture_Point(i, 12 + i);
-                       currentShader->setInt(shadowPointUniforms[i], 12 + i);
-                   }
-
-                   for (int i = 0; i < Shadow::MAX_SPOT_LIGHTS_SHADOW; ++i)
-                   {
-                       m_ShadowRenderer.GetShadow().BindTexture_Spot(i, 14 + i);
-                       currentShader->setInt(shadowSpotUniforms[i], 14 + i);
-                   }
-
-                   const glm::mat4* lightSpaceMatrices = m_ShadowRenderer.GetLightSpaceMatrices();
-                   for (int i = 0; i < Shadow::MAX_DIR_LIGHTS_SHADOW; ++i)
-                   {
-                        currentShader->setMat4(lightSpaceMatrixUniforms[i], lightSpaceMatrices[i]);
-                   }
-
-                   const glm::mat4* lightSpaceMatricesSpot = m_ShadowRenderer.GetLightSpaceMatricesSpot();
-                   for (int i = 0; i < Shadow::MAX_SPOT_LIGHTS_SHADOW; ++i)
-                   {
-                        currentShader->setMat4(lightSpaceMatrixSpotUniforms[i], lightSpaceMatricesSpot[i]);
-                   }
-                }
-                else
-                {
-                    currentShader->setBool("u_ReceiveShadow", false);
-                }
-                
-                currentShader->setFloat("farPlanePoint", m_ShadowRenderer.GetFarPlanePoint());
-                currentShader->setFloat("farPlaneSpot", m_ShadowRenderer.GetFarPlaneSpot());
-            }
-            m_LightRenderer.UploadLightData(scene, currentShader);
+            ApplyFrameUniforms(currentShader, projectionMatrix, cam->viewMatrix, camTrans->position, receiveShadows);
         }
 
         bool isAnimated = scene.registry.all_of<AnimationComponent>(entity) && scene.registry.get<AnimationComponent>(entity).animator;
@@ -314,98 +342,213 @@ void RenderSystem::Render(Scene &scene, int width, int height)
             flushBatch(currentShader, currentModel);
             currentModel = nullptr;
 
-            glm::mat4 modelMatrix = transform.GetWorldModelMatrix(scene.registry);
-            currentShader->setMat4("model", modelMatrix);
-            currentShader->setVec4("tintColor", renderer.color);
+            currentShader->setMat4("model"_uniform, transform.GetWorldMatrix());
 
-            auto &anim = scene.registry.get<AnimationComponent>(entity);
-            auto transforms = anim.animator->GetFinalBoneMatrices();
-            for (int j = 0; j < transforms.size() && j < 100; ++j)
-                currentShader->setMat4(bonesUniforms[j], transforms[j]);
+            // Both blocks come from the uniform ring; growing between the two writes would unbind the first
+            m_UniformRing.Reserve(sizeof(GPUMaterialData) + sizeof(GPUSkinningData) + 2 * UniformBuffer::GetOffsetAlignment());
+            SetupMaterialUniforms(currentShader, entity, scene, renderer.color);
 
-            SetupMaterialUniforms(currentShader, entity, scene);
+            auto &anim = scene.registry.get<AnimationComponent>(entity);
+            const std::vector<glm::mat4> &palette = anim.animator->GetFinalBoneMatrices();
+            UploadSkinningPalette(currentShader, palette.data(), static_cast<int>(palette.size()));
+            anim.visibleFrame = scene.GetVisibilityFrame();
+            anim.screenSize = ProjectedScreenSize(*item, cam->projectionMatrix, camTrans->position);
 
-            renderer.model->Draw(*currentShader);
+            item->model->Draw(*currentShader);
             m_RenderedCount++;
         }
         else
         {
-            if (m_DebugNoTexture)
-                currentShader->setBool("debug_noTexture", true);
-            else
-                currentShader->setBool("debug_noTexture", false);
+            const BakedAnimationComponent *bakedAnim = scene.registry.try_get<BakedAnimationComponent>(entity);
+            BakedAnimation *baked = bakedAnim ? bakedAnim->baked : nullptr;
 
             if (!m_InstanceBatchingEnabled)
             {
-                currentShader->setMat4("model", transform.GetWorldModelMatrix(scene.registry));
-                currentShader->setVec4("tintColor", renderer.color);
-
-                SetupMaterialUniforms(currentShader, entity, scene);
-
-                renderer.model->Draw(*currentShader);
+                currentShader->setMat4("model"_uniform, transform.GetWorldMatrix());
+                if (baked)
+                    m_UniformRing.Reserve(sizeof(GPUMaterialData) + sizeof(GPUSkinningData) + 2 * UniformBuffer::GetOffsetAlignment());
+                SetupMaterialUniforms(currentShader, entity, scene, renderer.color);
+                if (baked)
+                    UploadSkinningPalette(currentShader, baked->GetPalette(bakedAnim->clip, bakedAnim->time), baked->GetBoneCount());
+
+                item->model->Draw(*currentShader);
                 m_RenderedCount++;
             }
+            else if (const ArenaModel *arenaModel = (useIndirect && !baked) ? m_MeshArena.Acquire(*item->model) : nullptr)
+            {
+                // Shader | material bits of the key; the model id keeps instances of one model together
+                uint64_t stateKey = item->key >> RenderQueue::MATERIAL_SHIFT;
+                uint32_t modelId = static_cast<uint32_t>((item->key >> RenderQueue::MODEL_SHIFT) & 0xFFFF);
+                m_IndirectBuilder.Add(stateKey, modelId, arenaModel->meshes.data(), static_cast<uint32_t>(arenaModel->meshes.size()),
+                                      transform.GetWorldMatrix(), static_cast<uint32_t>(visibleIndex));
+            }
             else
             {
-                if (currentModel != renderer.model)
+                if (currentModel != item->model || currentMaterial != item->materialId || currentBaked != baked)
                 {
                     flushBatch(currentShader, currentModel);
-                    currentModel = renderer.model;
+                    currentModel = item->model;
+                    currentMaterial = item->materialId;
+                    currentBaked = baked;
 
-                    currentShader->setVec4("tintColor", renderer.color);
-
-                    SetupMaterialUniforms(currentShader, entity, scene);
+                    SetupMaterialUniforms(currentShader, entity, scene, renderer.color);
                 }
 
-                instanceBatch.push_back(transform.GetWorldModelMatrix(scene.registry));
+                if (baked)
+                    instanceBatch.push_back(baked->PackInstance(transform.GetWorldMatrix(), bakedAnim->clip, bakedAnim->time));
+                else
+                    instanceBatch.push_back(transform.GetWorldMatrix());
             }
         }
     }
     flushBatch(currentShader, currentModel);
+    flushIndirect(currentShader);
+    m_InstanceRing.EndFrame();
+    m_UniformRing.EndFrame();
 }
 
-void RenderSystem::SetupMaterialUniforms(Shader *shader, entt::entity entity, Scene &scene)
+void RenderSystem::UploadFrameUniforms(const glm::mat4 &projection, const glm::mat4 &view, const glm::vec3 &viewPos, bool receiveShadows)
 {
-    if (scene.registry.all_of<MaterialComponent>(entity))
+    static_assert(Shadow::MAX_DIR_LIGHTS_SHADOW == 2 && Shadow::MAX_SPOT_LIGHTS_SHADOW == 2, "Update GPUShadowData and the ShadowData blocks");
+
+    GPUFrameData frame = {};
+    frame.view = view;
+    frame.projection = projection;
+    frame.viewPos = viewPos;
+    frame.numDirLights = m_LightRenderer.GetDirLightCount();
+    frame.nrPointLights = m_LightRenderer.GetPointLightCount();
+    frame.nrSpotLights = m_LightRenderer.GetSpotLightCount();
+    m_FrameUniforms.Upload(frame);
+
+    GPUShadowData shadow = {};
+    const glm::mat4 *lightSpaceMatrices = m_ShadowRenderer.GetLightSpaceMatrices();
+    const glm::mat4 *lightSpaceMatricesSpot = m_ShadowRenderer.GetLightSpaceMatricesSpot();
+    std::copy_n(lightSpaceMatrices, Shadow::MAX_DIR_LIGHTS_SHADOW, shadow.lightSpaceMatrix);
+    std::copy_n(lightSpaceMatricesSpot, Shadow::MAX_SPOT_LIGHTS_SHADOW, shadow.lightSpaceMatrixSpot);
+    shadow.farPlanePoint = m_ShadowRenderer.GetFarPlanePoint();
+    shadow.farPlaneSpot = m_ShadowRenderer.GetFarPlaneSpot();
+    shadow.receiveShadow = receiveShadows ? 1 : 0;
+    m_ShadowUniforms.Upload(shadow);
+
+    // Units 10-15 are reserved for shadow maps; mesh textures start at 0
+    if (receiveShadows)
     {
-        auto &mat = scene.registry.get<MaterialComponent>(entity);
-        if (mat.type == MaterialType::PBR)
-        {
-            shader->setFloat("material.roughness", mat.roughness);
-            shader->setFloat("material.metallic", mat.metallic);
-            shader->setFloat("material.ao", mat.ao);
-            shader->setVec3("material.emission", mat.emission);
-        }
-        else
-        {
-            shader->setFloat("material.shininess", mat.shininess);
-            shader->setVec3("material.specular", mat.specular);
-            shader->setVec3("material.ambient", mat.ambient);
-            shader->setVec3("material.emission", mat.emission);
-        }
-        shader->setFloat("material.opacity", mat.opacity);
-        shader->setVec2("uvScale", mat.uvScale);
-        shader->setVec2("uvOffset", mat.uvOffset);
+        for (int i = 0; i < Shadow::MAX_DIR_LIGHTS_SHADOW; ++i)
+            m_ShadowRenderer.GetShadow().BindTexture_Dir(i, 10 + i);
+        for (int i = 0; i < Shadow::MAX_POINT_LIGHTS_SHADOW; ++i)
+            m_ShadowRenderer.GetShadow().BindTexture_Point(i, 12 + i);
+        for (int i = 0; i < Shadow::MAX_SPOT_LIGHTS_SHADOW; ++i)
+            m_ShadowRenderer.GetShadow().BindTexture_Spot(i, 14 + i);
+        glActiveTexture(GL_TEXTURE0);
+    }
+}
 
-        if (m_DebugNoTexture)
-        {
-            glActiveTexture(GL_TEXTURE0);
-            glBindTexture(GL_TEXTURE_2D, m_WhiteTextureID);
-        }
+void RenderSystem::ApplyFrameUniforms(Shader *shader, const glm::mat4 &projection, const glm::mat4 &view, const glm::vec3 &viewPos, bool receiveShadows)
+{
+    if (!shader->HasUniformBlock(UniformBlock::Frame))
+    {
+        shader->setMat4("projection"_uniform, projection);
+        shader->setMat4("view"_uniform, view);
+        shader->setVec3("viewPos"_uniform, viewPos);
+        m_LightRenderer.Apply(shader);
+    }
+
+    if (shader->HasUniformBlock(UniformBlock::Shadow))
+        return;
+
+    shader->setBool("u_ReceiveShadow"_uniform, receiveShadows);
+    if (receiveShadows)
+    {
+        static constexpr UniformHandle shadowMapDir[] = {"shadowMapDir[0]"_uniform, "shadowMapDir[1]"_uniform};
+        static constexpr UniformHandle shadowMapPoint[] = {"shadowMapPoint[0]"_uniform, "shadowMapPoint[1]"_uniform};
+        static constexpr UniformHandle shadowMapSpot[] = {"shadowMapSpot[0]"_uniform, "shadowMapSpot[1]"_uniform};
+        for (int i = 0; i < Shadow::MAX_DIR_LIGHTS_SHADOW; ++i)
+            shader->setInt(shadowMapDir[i], 10 + i);
+        for (int i = 0; i < Shadow::MAX_POINT_LIGHTS_SHADOW; ++i)
+            shader->setInt(shadowMapPoint[i], 12 + i);
+        for (int i = 0; i < Shadow::MAX_SPOT_LIGHTS_SHADOW; ++i)
+            shader->setInt(shadowMapSpot[i], 14 + i);
+
+        shader->setMat4Array("lightSpaceMatrix[0]"_uniform, m_ShadowRenderer.GetLightSpaceMatrices(), Shadow::MAX_DIR_LIGHTS_SHADOW);
+        shader->setMat4Array("lightSpaceMatrixSpot[0]"_uniform, m_ShadowRenderer.GetLightSpaceMatricesSpot(), Shadow::MAX_SPOT_LIGHTS_SHADOW);
+    }
+
+    shader->setFloat("farPlanePoint"_uniform, m_ShadowRenderer.GetFarPlanePoint());
+    shader->setFloat("farPlaneSpot"_uniform, m_ShadowRenderer.GetFarPlaneSpot());
+}
+
+void RenderSystem::UploadSkinningPalette(Shader *shader, const glm::mat4 *bones, int count)
+{
+    count = (std::min)(count, GPUSkinningData::MAX_BONES);
+    if (shader->HasUniformBlock(UniformBlock::Skinning))
+    {
+        // The block is bound whole; bones past count keep stale values the mesh never indexes
+        std::copy_n(bones, count, m_SkinningPalette.finalBonesMatrices);
+        BindUniformRange(UniformBlock::Skinning, &m_SkinningPalette, sizeof(GPUSkinningData));
     }
     else
     {
-        shader->setFloat("material.shininess", 32.0f);
-        shader->setVec3("material.specular", glm::vec3(0.5f));
-        shader->setVec3("material.ambient", glm::vec3(1.0f));
-        shader->setVec3("material.emission", glm::vec3(0.0f));
-        shader->setFloat("material.opacity", 1.0f);
-        shader->setVec2("uvScale", glm::vec2(1.0f));
-        shader->setVec2("uvOffset", glm::vec2(0.0f));
+        shader->setMat4Array("finalBonesMatrices[0]"_uniform, bones, count);
+    }
+}
+
+void RenderSystem::BindUniformRange(UniformBlock block, const void *data, size_t size)
+{
+    size_t offset = m_UniformRing.Write(data, size, UniformBuffer::GetOffsetAlignment());
+    if (offset == GpuRingBuffer::INVALID_OFFSET)
+        return;
+
+    glBindBufferRange(GL_UNIFORM_BUFFER, static_cast<GLuint>(block), m_UniformRing.GetBuffer(),
+                      static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size));
+}
+
+void RenderSystem::SetupMaterialUniforms(Shader *shader, entt::entity entity, Scene &scene, const glm::vec4 &tintColor)
+{
+    static const MaterialComponent defaultMaterial;
+    const MaterialComponent *found = scene.registry.try_get<MaterialComponent>(entity);
+    const MaterialComponent &mat = found ? *found : defaultMaterial;
+
+    if (found && m_DebugNoTexture)
+    {
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, m_WhiteTextureID);
     }
 
-    if (m_DebugNoTexture)
-        shader->setBool("debug_noTexture", true);
+    if (shader->HasUniformBlock(UniformBlock::Material))
+    {
+        GPUMaterialData data = {};
+        data.specular = mat.specular;
+        data.shininess = mat.shininess;
+        data.ambient = mat.ambient;
+        data.opacity = mat.opacity;
+        data.emission = mat.emission;
+        data.roughness = mat.roughness;
+        data.metallic = mat.metallic;
+        data.ao = mat.ao;
+        data.tintColor = tintColor;
+        data.uvScale = mat.uvScale;
+        data.uvOffset = mat.uvOffset;
+        data.debugNoTexture = m_DebugNoTexture ? 1 : 0;
+        BindUniformRange(UniformBlock::Material, &data, sizeof(data));
+        return;
+    }
+
+    shader->setVec4("tintColor"_uniform, tintColor);
+    if (mat.type == MaterialType::PBR)
+    {
+        shader->setFloat("material.roughness"_uniform, mat.roughness);
+        shader->setFloat("material.metallic"_uniform, mat.metallic);
+        shader->setFloat("material.ao"_uniform, mat.ao);
+    }
     else
-        shader->setBool("debug_noTexture", false);
+    {
+        shader->setFloat("material.shininess"_uniform, mat.shininess);
+        shader->setVec3("material.specular"_uniform, mat.specular);
+        shader->setVec3("material.ambient"_uniform, mat.ambient);
+    }
+    shader->setVec3("material.emission"_uniform, mat.emission);
+    shader->setFloat("material.opacity"_uniform, mat.opacity);
+    shader->setVec2("uvScale"_uniform, mat.uvScale);
+    shader->setVec2("uvOffset"_uniform, mat.uvOffset);
+    shader->setBool("debug_noTexture"_uniform, m_DebugNoTexture);
 }
@@ -0,0 +1,285 @@
+#include <ecs/systems/transform_system.h>
+#include <ecs/component.h>
+#include <scene/scene.h>
+#include <utils/profiler.h>
+#include <algorithm>
+#include <atomic>
+#include <execution>
+
+namespace
+{
+    constexpr uint32_t INVALID_SLOT = UINT32_MAX;
+}
+
+TransformSystem::~TransformSystem()
+{
+    Detach();
+}
+
+void TransformSystem::Attach(entt::registry &registry)
+{
+    Detach();
+    m_Registry = &registry;
+    registry.on_construct<TransformComponent>().connect<&TransformSystem::OnHierarchyChanged>(this);
+    registry.on_destroy<TransformComponent>().connect<&TransformSystem::OnHierarchyChanged>(this);
+    m_NeedsRebuild = true;
+}
+
+void TransformSystem::Detach()
+{
+    if (!m_Registry)
+        return;
+
+    m_Registry->on_construct<TransformComponent>().disconnect<&TransformSystem::OnHierarchyChanged>(this);
+    m_Registry->on_destroy<TransformComponent>().disconnect<&TransformSystem::OnHierarchyChanged>(this);
+    m_Registry = nullptr;
+
+    m_Entities.clear();
+    m_ParentEntities.clear();
+    m_ParentSlots.clear();
+    m_WorldMatrices.clear();
+    m_WorldVersions.clear();
+    m_Dirty.clear();
+    m_Forced.clear();
+    m_Slots.clear();
+    m_LevelOffsets.clear();
+    ClearMoved();
+    m_NeedsRebuild = true;
+}
+
+void TransformSystem::ClearMoved()
+{
+    for (entt::entity entity : m_Moved)
+        m_MovedPositions[entt::to_entity(entity)] = 0;
+    m_Moved.clear();
+}
+
+void TransformSystem::Rebuild()
+{
+    AXIS_PROFILE_SCOPE("TransformSystem::Rebuild");
+    auto &registry = *m_Registry;
+    auto view = registry.view<TransformComponent>();
+
+    // The previous order tells which slots are new or had their parent link change
+    std::vector<uint32_t> previousSlots = std::move(m_Slots);
+    std::vector<entt::entity> previousEntities = std::move(m_Entities);
+    std::vector<entt::entity> previousParents = std::move(m_ParentEntities);
+    std::vector<int32_t> previousParentSlots = std::move(m_ParentSlots);
+    std::vector<uint8_t> previousForced = std::move(m_Forced);
+
+    std::vector<entt::entity> unordered(view.begin(), view.end());
+    size_t count = unordered.size();
+
+    uint32_t maxIndex = 0;
+    for (entt::entity entity : unordered)
+        maxIndex = (std::max)(maxIndex, static_cast<uint32_t>(entt::to_entity(entity)));
+
+    m_Slots.assign(count ? maxIndex + 1 : 0, INVALID_SLOT);
+    for (size_t i = 0; i < count; ++i)
+        m_Slots[entt::to_entity(unordered[i])] = static_cast<uint32_t>(i);
+
+    auto parentIndex = [&](entt::entity entity) -> uint32_t
+    {
+        entt::entity parent = view.get<TransformComponent>(entity).parent;
+        if (parent == entt::null || !registry.valid(parent) || !registry.all_of<TransformComponent>(parent))
+            return INVALID_SLOT;
+        return m_Slots[entt::to_entity(parent)];
+    };
+
+    // Depth of each entity; chains longer than the entity count can only be cycles and are cut at the root
+    std::vector<uint32_t> depths(count, INVALID_SLOT);
+    std::vector<uint32_t> chain;
+    uint32_t maxDepth = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        chain.clear();
+        uint32_t current = static_cast<uint32_t>(i);
+        uint32_t base = 0;
+        while (depths[current] == INVALID_SLOT)
+        {
+            chain.push_back(current);
+            uint32_t parent = parentIndex(unordered[current]);
+            if (parent == INVALID_SLOT || chain.size() > count)
+            {
+                base = INVALID_SLOT;
+                break;
+            }
+            current = parent;
+        }
+
+        uint32_t depth = base == INVALID_SLOT ? 0 : depths[current] + 1;
+        for (auto it = chain.rbegin(); it != chain.rend(); ++it)
+        {
+            depths[*it] = depth++;
+        }
+        maxDepth = (std::max)(maxDepth, depth - 1);
+    }
+
+    // Counting sort by depth so each level is one contiguous range
+    m_LevelOffsets.assign(count ? maxDepth + 2 : 1, 0);
+    for (uint32_t depth : depths)
+        ++m_LevelOffsets[depth + 1];
+    for (size_t level = 1; level < m_LevelOffsets.size(); ++level)
+        m_LevelOffsets[level] += m_LevelOffsets[level - 1];
+
+    std::vector<size_t> cursor(m_LevelOffsets.begin(), m_LevelOffsets.end() - 1);
+    std::vector<uint32_t> slotDepths(count);
+    m_Entities.resize(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        size_t slot = cursor[depths[i]]++;
+        m_Entities[slot] = unordered[i];
+        slotDepths[slot] = depths[i];
+    }
+
+    for (size_t slot = 0; slot < count; ++slot)
+        m_Slots[entt::to_entity(m_Entities[slot])] = static_cast<uint32_t>(slot);
+
+    // A parent must sit on an earlier level; the link that closed a cycle does not and is dropped
+    m_ParentEntities.resize(count);
+    m_ParentSlots.resize(count);
+    for (size_t slot = 0; slot < count; ++slot)
+    {
+        entt::entity entity = m_Entities[slot];
+        m_ParentEntities[slot] = view.get<TransformComponent>(entity).parent;
+        uint32_t parent = parentIndex(entity);
+        bool linked = parent != INVALID_SLOT && slotDepths[parent] < slotDepths[slot];
+        m_ParentSlots[slot] = linked ? static_cast<int32_t>(parent) : -1;
+    }
+
+    // Cached results carry over, so only new or relinked slots (and through them their subtrees) recompute
+    m_WorldMatrices.resize(count);
+    m_WorldVersions.resize(count);
+    m_Dirty.assign(count, 0);
+    m_Forced.assign(count, 0);
+    for (size_t slot = 0; slot < count; ++slot)
+    {
+        entt::entity entity = m_Entities[slot];
+        const TransformComponent &transform = view.get<TransformComponent>(entity);
+        m_WorldMatrices[slot] = transform.m_WorldMatrix;
+        m_WorldVersions[slot] = transform.m_WorldVersion;
+
+        uint32_t index = entt::to_entity(entity);
+        uint32_t previous = index < previousSlots.size() ? previousSlots[index] : INVALID_SLOT;
+        bool known = previous < previousEntities.size() && previousEntities[previous] == entity;
+        bool relinked = !known || previousForced[previous] || previousParents[previous] != m_ParentEntities[slot] ||
+                        (previousParentSlots[previous] >= 0) != (m_ParentSlots[slot] >= 0);
+        m_Forced[slot] = relinked ? 1 : 0;
+    }
+    m_NeedsRebuild = false;
+}
+
+bool TransformSystem::ProcessSlot(uint32_t slot)
+{
+    const TransformComponent &transform = m_Registry->get<TransformComponent>(m_Entities[slot]);
+    transform.GetLocalModelMatrix();
+
+    int32_t parentSlot = m_ParentSlots[slot];
+    const TransformComponent *parent = parentSlot >= 0 ? &m_Registry->get<TransformComponent>(m_Entities[parentSlot]) : nullptr;
+
+    bool dirty = m_Forced[slot] || transform.m_Version != transform.m_LastLocalVersion || transform.m_LastParent != transform.parent;
+    if (parent)
+        dirty = dirty || m_Dirty[parentSlot] || transform.m_LastParentVersion != parent->m_WorldVersion;
+
+    if (dirty)
+    {
+        transform.m_WorldMatrix = parent ? m_WorldMatrices[parentSlot] * transform.m_LocalMatrix : transform.m_LocalMatrix;
+        transform.m_LastLocalVersion = transform.m_Version;
+        transform.m_LastParent = transform.parent;
+        transform.m_LastParentVersion = parent ? parent->m_WorldVersion : 0;
+        transform.m_WorldVersion++;
+    }
+
+    // Also picks up matrices resolved lazily through GetWorldModelMatrix since the last pass
+    if (dirty || m_WorldVersions[slot] != transform.m_WorldVersion)
+    {
+        m_WorldMatrices[slot] = transform.m_WorldMatrix;
+        m_WorldVersions[slot] = transform.m_WorldVersion;
+        dirty = true;
+    }
+
+    m_Dirty[slot] = dirty ? 1 : 0;
+    m_Forced[slot] = 0;
+    return dirty;
+}
+
+bool TransformSystem::RunPass()
+{
+    std::fill(m_Dirty.begin(), m_Dirty.end(), uint8_t(0));
+    std::atomic<bool> hierarchyChanged = false;
+    const entt::entity *base = m_Entities.data();
+
+    auto process = [&](const entt::entity &entity)
+    {
+        uint32_t slot = static_cast<uint32_t>(&entity - base);
+        if (m_Registry->get<TransformComponent>(entity).parent != m_ParentEntities[slot])
+        {
+            hierarchyChanged.store(true, std::memory_order_relaxed);
+            return;
+        }
+        ProcessSlot(slot);
+    };
+
+    for (size_t level = 0; level + 1 < m_LevelOffsets.size(); ++level)
+    {
+        auto first = m_Entities.begin() + m_LevelOffsets[level];
+        auto last = m_Entities.begin() + m_LevelOffsets[level + 1];
+
+        if (static_cast<size_t>(last - first) < m_ParallelThreshold)
+            std::for_each(first, last, process);
+        else
+            std::for_each(std::execution::par, first, last, process);
+
+        if (hierarchyChanged.load(std::memory_order_relaxed))
+            return true;
+    }
+    return false;
+}
+
+void TransformSystem::Update(Scene &scene)
+{
+    if (!m_Enabled)
+        return;
+    AXIS_PROFILE_SCOPE("TransformSystem::Update");
+
+    if (m_Registry != &scene.registry)
+        Attach(scene.registry);
+
+    if (m_NeedsRebuild)
+        Rebuild();
+
+    // Slots finished by an interrupted pass are recorded before the rebuild drops their dirty flags
+    m_LastDirtyCount = 0;
+    if (RunPass())
+    {
+        CollectMoved();
+        Rebuild();
+        RunPass();
+    }
+    CollectMoved();
+}
+
+void TransformSystem::CollectMoved()
+{
+    if (m_MovedPositions.size() < m_Slots.size())
+        m_MovedPositions.resize(m_Slots.size(), 0);
+    for (size_t slot = 0; slot < m_Dirty.size(); ++slot)
+    {
+        if (!m_Dirty[slot])
+            continue;
+        ++m_LastDirtyCount;
+
+        // A recycled index takes over the listing of the destroyed entity it replaced
+        entt::entity entity = m_Entities[slot];
+        uint32_t &position = m_MovedPositions[entt::to_entity(entity)];
+        if (position)
+        {
+            m_Moved[position - 1] = entity;
+        }
+        else
+        {
+            m_Moved.push_back(entity);
+            position = static_cast<uint32_t>(m_Moved.size());
+        }
+    }
+}
@@ -0,0 +1,187 @@
+#include <graphic/core/gpu_ring_buffer.h>
+#include <graphic/core/render_device.h>
+#include <utils/logger.h>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+namespace
+{
+    constexpr size_t REGION_ALIGNMENT = 256;
+    constexpr GLuint64 FENCE_TIMEOUT_NS = 1000000;
+
+    // 0 is never handed out, so it can stand for "not a ring" in users' caches
+    std::atomic<uint32_t> s_NextGeneration{1};
+
+    size_t AlignUp(size_t value, size_t alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    void WaitFence(GLsync &fence)
+    {
+        if (!fence)
+            return;
+
+        GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+        while (true)
+        {
+            GLenum result = glClientWaitSync(fence, flags, FENCE_TIMEOUT_NS);
+            if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED || result == GL_WAIT_FAILED)
+                break;
+            flags = 0;
+        }
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+}
+
+GpuRingBuffer::~GpuRingBuffer()
+{
+    Shutdown();
+}
+
+void GpuRingBuffer::Init(size_t bytesPerFrame)
+{
+    if (m_Buffer)
+        return;
+
+    Create(bytesPerFrame);
+    LOGGER_INFO("GpuRingBuffer") << "Created " << (m_Persistent ? "persistent mapped" : "orphaning") << " ring, "
+                                 << (m_Capacity >> 10) << " KB per frame";
+}
+
+void GpuRingBuffer::Shutdown()
+{
+    Destroy();
+    m_Capacity = 0;
+}
+
+void GpuRingBuffer::Create(size_t bytesPerFrame)
+{
+    m_Capacity = AlignUp((std::max)(bytesPerFrame, REGION_ALIGNMENT), REGION_ALIGNMENT);
+    m_Persistent = GLAD_GL_VERSION_4_4 && glBufferStorage && glMapBufferRange && glFenceSync;
+    m_Head = 0;
+    m_Region = 0;
+    m_Generation = s_NextGeneration.fetch_add(1, std::memory_order_relaxed);
+
+    glGenBuffers(1, &m_Buffer);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, m_Buffer);
+
+    if (m_Persistent)
+    {
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        GLsizeiptr size = static_cast<GLsizeiptr>(m_Capacity * FRAME_COUNT);
+        glBufferStorage(GL_COPY_WRITE_BUFFER, size, nullptr, flags);
+        m_Mapped = static_cast<unsigned char *>(glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, size, flags));
+        if (!m_Mapped)
+        {
+            LOGGER_WARN("GpuRingBuffer") << "Persistent mapping failed, falling back to orphaning";
+            glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+            glDeleteBuffers(1, &m_Buffer);
+            glGenBuffers(1, &m_Buffer);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, m_Buffer);
+            m_Persistent = false;
+        }
+    }
+
+    if (!m_Persistent)
+        glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(m_Capacity), nullptr, GL_STREAM_DRAW);
+
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+}
+
+void GpuRingBuffer::Destroy()
+{
+    for (GLsync &fence : m_Fences)
+    {
+        if (fence)
+        {
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+    }
+
+    if (m_Buffer)
+    {
+        if (m_Mapped)
+        {
+            glBindBuffer(GL_COPY_WRITE_BUFFER, m_Buffer);
+            glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        }
+        glDeleteBuffers(1, &m_Buffer);
+    }
+
+    m_Buffer = 0;
+    m_Mapped = nullptr;
+    m_Head = 0;
+}
+
+void GpuRingBuffer::BeginFrame()
+{
+    if (!m_Buffer)
+        return;
+
+    m_Head = 0;
+    if (m_Persistent)
+    {
+        m_Region = (m_Region + 1) % FRAME_COUNT;
+        WaitFence(m_Fences[m_Region]);
+    }
+    else
+    {
+        glBindBuffer(GL_COPY_WRITE_BUFFER, m_Buffer);
+        glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(m_Capacity), nullptr, GL_STREAM_DRAW);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    }
+}
+
+void GpuRingBuffer::EndFrame()
+{
+    if (m_Persistent && m_Head > 0)
+        m_Fences[m_Region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+// Draws already issued this frame keep the old buffer alive; GL defers the delete until they finish
+void GpuRingBuffer::Grow(size_t required)
+{
+    size_t capacity = (std::max)(m_Capacity * 2, required);
+    LOGGER_WARN("GpuRingBuffer") << "Frame data exceeded " << (m_Capacity >> 10) << " KB, growing to " << (AlignUp(capacity, REGION_ALIGNMENT) >> 10) << " KB";
+
+    Destroy();
+    Create(capacity);
+}
+
+void GpuRingBuffer::Reserve(size_t bytes)
+{
+    if (m_Buffer && m_Head + bytes > m_Capacity)
+        Grow(m_Head + bytes);
+}
+
+size_t GpuRingBuffer::Write(const void *data, size_t size, size_t alignment)
+{
+    if (!m_Buffer || size == 0)
+        return INVALID_OFFSET;
+
+    size_t offset = AlignUp(m_Head, alignment);
+    if (offset + size > m_Capacity)
+    {
+        Grow(offset + size);
+        offset = 0;
+    }
+    m_Head = offset + size;
+
+    if (m_Persistent)
+    {
+        size_t absolute = static_cast<size_t>(m_Region) * m_Capacity + offset;
+        std::memcpy(m_Mapped + absolute, data, size);
+        RenderDevice::RecordMappedWrite(size);
+        return absolute;
+    }
+
+    glBindBuffer(GL_COPY_WRITE_BUFFER, m_Buffer);
+    glBufferSubData(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), data);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    return offset;
+}
@@ -0,0 +1,1059 @@
+// Every entry point declared in includes/glad/glad.h, for the null backend's typed stubs
+// (RenderDevice::Init). Regenerate when glad is regenerated:
+//   grep 'GLAPI PFNGL' includes/glad/glad.h | sed 's/.*glad_\(gl[A-Za-z0-9_]*\);/AXIS_NULL_GL(\1)/'
+
+AXIS_NULL_GL(glCullFace)
+AXIS_NULL_GL(glFrontFace)
+AXIS_NULL_GL(glHint)
+AXIS_NULL_GL(glLineWidth)
+AXIS_NULL_GL(glPointSize)
+AXIS_NULL_GL(glPolygonMode)
+AXIS_NULL_GL(glScissor)
+AXIS_NULL_GL(glTexParameterf)
+AXIS_NULL_GL(glTexParameterfv)
+AXIS_NULL_GL(glTexParameteri)
+AXIS_NULL_GL(glTexParameteriv)
+AXIS_NULL_GL(glTexImage1D)
+AXIS_NULL_GL(glTexImage2D)
+AXIS_NULL_GL(glDrawBuffer)
+AXIS_NULL_GL(glClear)
+AXIS_NULL_GL(glClearColor)
+AXIS_NULL_GL(glClearStencil)
+AXIS_NULL_GL(glClearDepth)
+AXIS_NULL_GL(glStencilMask)
+AXIS_NULL_GL(glColorMask)
+AXIS_NULL_GL(glDepthMask)
+AXIS_NULL_GL(glDisable)
+AXIS_NULL_GL(glEnable)
+AXIS_NULL_GL(glFinish)
+AXIS_NULL_GL(glFlush)
+AXIS_NULL_GL(glBlendFunc)
+AXIS_NULL_GL(glLogicOp)
+AXIS_NULL_GL(glStencilFunc)
+AXIS_NULL_GL(glStencilOp)
+AXIS_NULL_GL(glDepthFunc)
+AXIS_NULL_GL(glPixelStoref)
+AXIS_NULL_GL(glPixelStorei)
+AXIS_NULL_GL(glReadBuffer)
+AXIS_NULL_GL(glReadPixels)
+AXIS_NULL_GL(glGetBooleanv)
+AXIS_NULL_GL(glGetDoublev)
+AXIS_NULL_GL(glGetError)
+AXIS_NULL_GL(glGetFloatv)
+AXIS_NULL_GL(glGetIntegerv)
+AXIS_NULL_GL(glGetString)
+AXIS_NULL_GL(glGetTexImage)
+AXIS_NULL_GL(glGetTexParameterfv)
+AXIS_NULL_GL(glGetTexParameteriv)
+AXIS_NULL_GL(glGetTexLevelParameterfv)
+AXIS_NULL_GL(glGetTexLevelParameteriv)
+AXIS_NULL_GL(glIsEnabled)
+AXIS_NULL_GL(glDepthRange)
+AXIS_NULL_GL(glViewport)
+AXIS_NULL_GL(glNewList)
+AXIS_NULL_GL(glEndList)
+AXIS_NULL_GL(glCallList)
+AXIS_NULL_GL(glCallLists)
+AXIS_NULL_GL(glDeleteLists)
+AXIS_NULL_GL(glGenLists)
+AXIS_NULL_GL(glListBase)
+AXIS_NULL_GL(glBegin)
+AXIS_NULL_GL(glBitmap)
+AXIS_NULL_GL(glColor3b)
+AXIS_NULL_GL(glColor3bv)
+AXIS_NULL_GL(glColor3d)
+AXIS_NULL_GL(glColor3dv)
+AXIS_NULL_GL(glColor3f)
+AXIS_NULL_GL(glColor3fv)
+AXIS_NULL_GL(glColor3i)
+AXIS_NULL_GL(glColor3iv)
+AXIS_NULL_GL(glColor3s)
+AXIS_NULL_GL(glColor3sv)
+AXIS_NULL_GL(glColor3ub)
+AXIS_NULL_GL(glColor3ubv)
+AXIS_NULL_GL(glColor3ui)
+AXIS_NULL_GL(glColor3uiv)
+AXIS_NULL_GL(glColor3us)
+AXIS_NULL_GL(glColor3usv)
+AXIS_NULL_GL(glColor4b)
+AXIS_NULL_GL(glColor4bv)
+AXIS_NULL_GL(glColor4d)
+AXIS_NULL_GL(glColor4dv)
+AXIS_NULL_GL(glColor4f)
+AXIS_NULL_GL(glColor4fv)
+AXIS_NULL_GL(glColor4i)
+AXIS_NULL_GL(glColor4iv)
+AXIS_NULL_GL(glColor4s)
+AXIS_NULL_GL(glColor4sv)
+AXIS_NULL_GL(glColor4ub)
+AXIS_NULL_GL(glColor4ubv)
+AXIS_NULL_GL(glColor4ui)
+AXIS_NULL_GL(glColor4uiv)
+AXIS_NULL_GL(glColor4us)
+AXIS_NULL_GL(glColor4usv)
+AXIS_NULL_GL(glEdgeFlag)
+AXIS_NULL_GL(glEdgeFlagv)
+AXIS_NULL_GL(glEnd)
+AXIS_NULL_GL(glIndexd)
+AXIS_NULL_GL(glIndexdv)
+AXIS_NULL_GL(glIndexf)
+AXIS_NULL_GL(glIndexfv)
+AXIS_NULL_GL(glIndexi)
+AXIS_NULL_GL(glIndexiv)
+AXIS_NULL_GL(glIndexs)
+AXIS_NULL_GL(glIndexsv)
+AXIS_NULL_GL(glNormal3b)
+AXIS_NULL_GL(glNormal3bv)
+AXIS_NULL_GL(glNormal3d)
+AXIS_NULL_GL(glNormal3dv)
+AXIS_NULL_GL(glNormal3f)
+AXIS_NULL_GL(glNormal3fv)
+AXIS_NULL_GL(glNormal3i)
+AXIS_NULL_GL(glNormal3iv)
+AXIS_NULL_GL(glNormal3s)
+AXIS_NULL_GL(glNormal3sv)
+AXIS_NULL_GL(glRasterPos2d)
+AXIS_NULL_GL(glRasterPos2dv)
+AXIS_NULL_GL(glRasterPos2f)
+AXIS_NULL_GL(glRasterPos2fv)
+AXIS_NULL_GL(glRasterPos2i)
+AXIS_NULL_GL(glRasterPos2iv)
+AXIS_NULL_GL(glRasterPos2s)
+AXIS_NULL_GL(glRasterPos2sv)
+AXIS_NULL_GL(glRasterPos3d)
+AXIS_NULL_GL(glRasterPos3dv)
+AXIS_NULL_GL(glRasterPos3f)
+AXIS_NULL_GL(glRasterPos3fv)
+AXIS_NULL_GL(glRasterPos3i)
+AXIS_NULL_GL(glRasterPos3iv)
+AXIS_NULL_GL(glRasterPos3s)
+AXIS_NULL_GL(glRasterPos3sv)
+AXIS_NULL_GL(glRasterPos4d)
+AXIS_NULL_GL(glRasterPos4dv)
+AXIS_NULL_GL(glRasterPos4f)
+AXIS_NULL_GL(glRasterPos4fv)
+AXIS_NULL_GL(glRasterPos4i)
+AXIS_NULL_GL(glRasterPos4iv)
+AXIS_NULL_GL(glRasterPos4s)
+AXIS_NULL_GL(glRasterPos4sv)
+AXIS_NULL_GL(glRectd)
+AXIS_NULL_GL(glRectdv)
+AXIS_NULL_GL(glRectf)
+AXIS_NULL_GL(glRectfv)
+AXIS_NULL_GL(glRecti)
+AXIS_NULL_GL(glRectiv)
+AXIS_NULL_GL(glRects)
+AXIS_NULL_GL(glRectsv)
+AXIS_NULL_GL(glTexCoord1d)
+AXIS_NULL_GL(glTexCoord1dv)
+AXIS_NULL_GL(glTexCoord1f)
+AXIS_NULL_GL(glTexCoord1fv)
+AXIS_NULL_GL(glTexCoord1i)
+AXIS_NULL_GL(glTexCoord1iv)
+AXIS_NULL_GL(glTexCoord1s)
+AXIS_NULL_GL(glTexCoord1sv)
+AXIS_NULL_GL(glTexCoord2d)
+AXIS_NULL_GL(glTexCoord2dv)
+AXIS_NULL_GL(glTexCoord2f)
+AXIS_NULL_GL(glTexCoord2fv)
+AXIS_NULL_GL(glTexCoord2i)
+AXIS_NULL_GL(glTexCoord2iv)
+AXIS_NULL_GL(glTexCoord2s)
+AXIS_NULL_GL(glTexCoord2sv)
+AXIS_NULL_GL(glTexCoord3d)
+AXIS_NULL_GL(glTexCoord3dv)
+AXIS_NULL_GL(glTexCoord3f)
+AXIS_NULL_GL(glTexCoord3fv)
+AXIS_NULL_GL(glTexCoord3i)
+AXIS_NULL_GL(glTexCoord3iv)
+AXIS_NULL_GL(glTexCoord3s)
+AXIS_NULL_GL(glTexCoord3sv)
+AXIS_NULL_GL(glTexCoord4d)
+AXIS_NULL_GL(glTexCoord4dv)
+AXIS_NULL_GL(glTexCoord4f)
+AXIS_NULL_GL(glTexCoord4fv)
+AXIS_NULL_GL(glTexCoord4i)
+AXIS_NULL_GL(glTexCoord4iv)
+AXIS_NULL_GL(glTexCoord4s)
+AXIS_NULL_GL(glTexCoord4sv)
+AXIS_NULL_GL(glVertex2d)
+AXIS_NULL_GL(glVertex2dv)
+AXIS_NULL_GL(glVertex2f)
+AXIS_NULL_GL(glVertex2fv)
+AXIS_NULL_GL(glVertex2i)
+AXIS_NULL_GL(glVertex2iv)
+AXIS_NULL_GL(glVertex2s)
+AXIS_NULL_GL(glVertex2sv)
+AXIS_NULL_GL(glVertex3d)
+AXIS_NULL_GL(glVertex3dv)
+AXIS_NULL_GL(glVertex3f)
+AXIS_NULL_GL(glVertex3fv)
+AXIS_NULL_GL(glVertex3i)
+AXIS_NULL_GL(glVertex3iv)
+AXIS_NULL_GL(glVertex3s)
+AXIS_NULL_GL(glVertex3sv)
+AXIS_NULL_GL(glVertex4d)
+AXIS_NULL_GL(glVertex4dv)
+AXIS_NULL_GL(glVertex4f)
+AXIS_NULL_GL(glVertex4fv)
+AXIS_NULL_GL(glVertex4i)
+AXIS_NULL_GL(glVertex4iv)
+AXIS_NULL_GL(glVertex4s)
+AXIS_NULL_GL(glVertex4sv)
+AXIS_NULL_GL(glClipPlane)
+AXIS_NULL_GL(glColorMaterial)
+AXIS_NULL_GL(glFogf)
+AXIS_NULL_GL(glFogfv)
+AXIS_NULL_GL(glFogi)
+AXIS_NULL_GL(glFogiv)
+AXIS_NULL_GL(glLightf)
+AXIS_NULL_GL(glLightfv)
+AXIS_NULL_GL(glLighti)
+AXIS_NULL_GL(glLightiv)
+AXIS_NULL_GL(glLightModelf)
+AXIS_NULL_GL(glLightModelfv)
+AXIS_NULL_GL(glLightModeli)
+AXIS_NULL_GL(glLightModeliv)
+AXIS_NULL_GL(glLineStipple)
+AXIS_NULL_GL(glMaterialf)
+AXIS_NULL_GL(glMaterialfv)
+AXIS_NULL_GL(glMateriali)
+AXIS_NULL_GL(glMaterialiv)
+AXIS_NULL_GL(glPolygonStipple)
+AXIS_NULL_GL(glShadeModel)
+AXIS_NULL_GL(glTexEnvf)
+AXIS_NULL_GL(glTexEnvfv)
+AXIS_NULL_GL(glTexEnvi)
+AXIS_NULL_GL(glTexEnviv)
+AXIS_NULL_GL(glTexGend)
+AXIS_NULL_GL(glTexGendv)
+AXIS_NULL_GL(glTexGenf)
+AXIS_NULL_GL(glTexGenfv)
+AXIS_NULL_GL(glTexGeni)
+AXIS_NULL_GL(glTexGeniv)
+AXIS_NULL_GL(glFeedbackBuffer)
+AXIS_NULL_GL(glSelectBuffer)
+AXIS_NULL_GL(glRenderMode)
+AXIS_NULL_GL(glInitNames)
+AXIS_NULL_GL(glLoadName)
+AXIS_NULL_GL(glPassThrough)
+AXIS_NULL_GL(glPopName)
+AXIS_NULL_GL(glPushName)
+AXIS_NULL_GL(glClearAccum)
+AXIS_NULL_GL(glClearIndex)
+AXIS_NULL_GL(glIndexMask)
+AXIS_NULL_GL(glAccum)
+AXIS_NULL_GL(glPopAttrib)
+AXIS_NULL_GL(glPushAttrib)
+AXIS_NULL_GL(glMap1d)
+AXIS_NULL_GL(glMap1f)
+AXIS_NULL_GL(glMap2d)
+AXIS_NULL_GL(glMap2f)
+AXIS_NULL_GL(glMapGrid1d)
+AXIS_NULL_GL(glMapGrid1f)
+AXIS_NULL_GL(glMapGrid2d)
+AXIS_NULL_GL(glMapGrid2f)
+AXIS_NULL_GL(glEvalCoord1d)
+AXIS_NULL_GL(glEvalCoord1dv)
+AXIS_NULL_GL(glEvalCoord1f)
+AXIS_NULL_GL(glEvalCoord1fv)
+AXIS_NULL_GL(glEvalCoord2d)
+AXIS_NULL_GL(glEvalCoord2dv)
+AXIS_NULL_GL(glEvalCoord2f)
+AXIS_NULL_GL(glEvalCoord2fv)
+AXIS_NULL_GL(glEvalMesh1)
+AXIS_NULL_GL(glEvalPoint1)
+AXIS_NULL_GL(glEvalMesh2)
+AXIS_NULL_GL(glEvalPoint2)
+AXIS_NULL_GL(glAlphaFunc)
+AXIS_NULL_GL(glPixelZoom)
+AXIS_NULL_GL(glPixelTransferf)
+AXIS_NULL_GL(glPixelTransferi)
+AXIS_NULL_GL(glPixelMapfv)
+AXIS_NULL_GL(glPixelMapuiv)
+AXIS_NULL_GL(glPixelMapusv)
+AXIS_NULL_GL(glCopyPixels)
+AXIS_NULL_GL(glDrawPixels)
+AXIS_NULL_GL(glGetClipPlane)
+AXIS_NULL_GL(glGetLightfv)
+AXIS_NULL_GL(glGetLightiv)
+AXIS_NULL_GL(glGetMapdv)
+AXIS_NULL_GL(glGetMapfv)
+AXIS_NULL_GL(glGetMapiv)
+AXIS_NULL_GL(glGetMaterialfv)
+AXIS_NULL_GL(glGetMaterialiv)
+AXIS_NULL_GL(glGetPixelMapfv)
+AXIS_NULL_GL(glGetPixelMapuiv)
+AXIS_NULL_GL(glGetPixelMapusv)
+AXIS_NULL_GL(glGetPolygonStipple)
+AXIS_NULL_GL(glGetTexEnvfv)
+AXIS_NULL_GL(glGetTexEnviv)
+AXIS_NULL_GL(glGetTexGendv)
+AXIS_NULL_GL(glGetTexGenfv)
+AXIS_NULL_GL(glGetTexGeniv)
+AXIS_NULL_GL(glIsList)
+AXIS_NULL_GL(glFrustum)
+AXIS_NULL_GL(glLoadIdentity)
+AXIS_NULL_GL(glLoadMatrixf)
+AXIS_NULL_GL(glLoadMatrixd)
+AXIS_NULL_GL(glMatrixMode)
+AXIS_NULL_GL(glMultMatrixf)
+AXIS_NULL_GL(glMultMatrixd)
+AXIS_NULL_GL(glOrtho)
+AXIS_NULL_GL(glPopMatrix)
+AXIS_NULL_GL(glPushMatrix)
+AXIS_NULL_GL(glRotated)
+AXIS_NULL_GL(glRotatef)
+AXIS_NULL_GL(glScaled)
+AXIS_NULL_GL(glScalef)
+AXIS_NULL_GL(glTranslated)
+AXIS_NULL_GL(glTranslatef)
+AXIS_NULL_GL(glDrawArrays)
+AXIS_NULL_GL(glDrawElements)
+AXIS_NULL_GL(glGetPointerv)
+AXIS_NULL_GL(glPolygonOffset)
+AXIS_NULL_GL(glCopyTexImage1D)
+AXIS_NULL_GL(glCopyTexImage2D)
+AXIS_NULL_GL(glCopyTexSubImage1D)
+AXIS_NULL_GL(glCopyTexSubImage2D)
+AXIS_NULL_GL(glTexSubImage1D)
+AXIS_NULL_GL(glTexSubImage2D)
+AXIS_NULL_GL(glBindTexture)
+AXIS_NULL_GL(glDeleteTextures)
+AXIS_NULL_GL(glGenTextures)
+AXIS_NULL_GL(glIsTexture)
+AXIS_NULL_GL(glArrayElement)
+AXIS_NULL_GL(glColorPointer)
+AXIS_NULL_GL(glDisableClientState)
+AXIS_NULL_GL(glEdgeFlagPointer)
+AXIS_NULL_GL(glEnableClientState)
+AXIS_NULL_GL(glIndexPointer)
+AXIS_NULL_GL(glInterleavedArrays)
+AXIS_NULL_GL(glNormalPointer)
+AXIS_NULL_GL(glTexCoordPointer)
+AXIS_NULL_GL(glVertexPointer)
+AXIS_NULL_GL(glAreTexturesResident)
+AXIS_NULL_GL(glPrioritizeTextures)
+AXIS_NULL_GL(glIndexub)
+AXIS_NULL_GL(glIndexubv)
+AXIS_NULL_GL(glPopClientAttrib)
+AXIS_NULL_GL(glPushClientAttrib)
+AXIS_NULL_GL(glDrawRangeElements)
+AXIS_NULL_GL(glTexImage3D)
+AXIS_NULL_GL(glTexSubImage3D)
+AXIS_NULL_GL(glCopyTexSubImage3D)
+AXIS_NULL_GL(glActiveTexture)
+AXIS_NULL_GL(glSampleCoverage)
+AXIS_NULL_GL(glCompressedTexImage3D)
+AXIS_NULL_GL(glCompressedTexImage2D)
+AXIS_NULL_GL(glCompressedTexImage1D)
+AXIS_NULL_GL(glCompressedTexSubImage3D)
+AXIS_NULL_GL(glCompressedTexSubImage2D)
+AXIS_NULL_GL(glCompressedTexSubImage1D)
+AXIS_NULL_GL(glGetCompressedTexImage)
+AXIS_NULL_GL(glClientActiveTexture)
+AXIS_NULL_GL(glMultiTexCoord1d)
+AXIS_NULL_GL(glMultiTexCoord1dv)
+AXIS_NULL_GL(glMultiTexCoord1f)
+AXIS_NULL_GL(glMultiTexCoord1fv)
+AXIS_NULL_GL(glMultiTexCoord1i)
+AXIS_NULL_GL(glMultiTexCoord1iv)
+AXIS_NULL_GL(glMultiTexCoord1s)
+AXIS_NULL_GL(glMultiTexCoord1sv)
+AXIS_NULL_GL(glMultiTexCoord2d)
+AXIS_NULL_GL(glMultiTexCoord2dv)
+AXIS_NULL_GL(glMultiTexCoord2f)
+AXIS_NULL_GL(glMultiTexCoord2fv)
+AXIS_NULL_GL(glMultiTexCoord2i)
+AXIS_NULL_GL(glMultiTexCoord2iv)
+AXIS_NULL_GL(glMultiTexCoord2s)
+AXIS_NULL_GL(glMultiTexCoord2sv)
+AXIS_NULL_GL(glMultiTexCoord3d)
+AXIS_NULL_GL(glMultiTexCoord3dv)
+AXIS_NULL_GL(glMultiTexCoord3f)
+AXIS_NULL_GL(glMultiTexCoord3fv)
+AXIS_NULL_GL(glMultiTexCoord3i)
+AXIS_NULL_GL(glMultiTexCoord3iv)
+AXIS_NULL_GL(glMultiTexCoord3s)
+AXIS_NULL_GL(glMultiTexCoord3sv)
+AXIS_NULL_GL(glMultiTexCoord4d)
+AXIS_NULL_GL(glMultiTexCoord4dv)
+AXIS_NULL_GL(glMultiTexCoord4f)
+AXIS_NULL_GL(glMultiTexCoord4fv)
+AXIS_NULL_GL(glMultiTexCoord4i)
+AXIS_NULL_GL(glMultiTexCoord4iv)
+AXIS_NULL_GL(glMultiTexCoord4s)
+AXIS_NULL_GL(glMultiTexCoord4sv)
+AXIS_NULL_GL(glLoadTransposeMatrixf)
+AXIS_NULL_GL(glLoadTransposeMatrixd)
+AXIS_NULL_GL(glMultTransposeMatrixf)
+AXIS_NULL_GL(glMultTransposeMatrixd)
+AXIS_NULL_GL(glBlendFuncSeparate)
+AXIS_NULL_GL(glMultiDrawArrays)
+AXIS_NULL_GL(glMultiDrawElements)
+AXIS_NULL_GL(glPointParameterf)
+AXIS_NULL_GL(glPointParameterfv)
+AXIS_NULL_GL(glPointParameteri)
+AXIS_NULL_GL(glPointParameteriv)
+AXIS_NULL_GL(glFogCoordf)
+AXIS_NULL_GL(glFogCoordfv)
+AXIS_NULL_GL(glFogCoordd)
+AXIS_NULL_GL(glFogCoorddv)
+AXIS_NULL_GL(glFogCoordPointer)
+AXIS_NULL_GL(glSecondaryColor3b)
+AXIS_NULL_GL(glSecondaryColor3bv)
+AXIS_NULL_GL(glSecondaryColor3d)
+AXIS_NULL_GL(glSecondaryColor3dv)
+AXIS_NULL_GL(glSecondaryColor3f)
+AXIS_NULL_GL(glSecondaryColor3fv)
+AXIS_NULL_GL(glSecondaryColor3i)
+AXIS_NULL_GL(glSecondaryColor3iv)
+AXIS_NULL_GL(glSecondaryColor3s)
+AXIS_NULL_GL(glSecondaryColor3sv)
+AXIS_NULL_GL(glSecondaryColor3ub)
+AXIS_NULL_GL(glSecondaryColor3ubv)
+AXIS_NULL_GL(glSecondaryColor3ui)
+AXIS_NULL_GL(glSecondaryColor3uiv)
+AXIS_NULL_GL(glSecondaryColor3us)
+AXIS_NULL_GL(glSecondaryColor3usv)
+AXIS_NULL_GL(glSecondaryColorPointer)
+AXIS_NULL_GL(glWindowPos2d)
+AXIS_NULL_GL(glWindowPos2dv)
+AXIS_NULL_GL(glWindowPos2f)
+AXIS_NULL_GL(glWindowPos2fv)
+AXIS_NULL_GL(glWindowPos2i)
+AXIS_NULL_GL(glWindowPos2iv)
+AXIS_NULL_GL(glWindowPos2s)
+AXIS_NULL_GL(glWindowPos2sv)
+AXIS_NULL_GL(glWindowPos3d)
+AXIS_NULL_GL(glWindowPos3dv)
+AXIS_NULL_GL(glWindowPos3f)
+AXIS_NULL_GL(glWindowPos3fv)
+AXIS_NULL_GL(glWindowPos3i)
+AXIS_NULL_GL(glWindowPos3iv)
+AXIS_NULL_GL(glWindowPos3s)
+AXIS_NULL_GL(glWindowPos3sv)
+AXIS_NULL_GL(glBlendColor)
+AXIS_NULL_GL(glBlendEquation)
+AXIS_NULL_GL(glGenQueries)
+AXIS_NULL_GL(glDeleteQueries)
+AXIS_NULL_GL(glIsQuery)
+AXIS_NULL_GL(glBeginQuery)
+AXIS_NULL_GL(glEndQuery)
+AXIS_NULL_GL(glGetQueryiv)
+AXIS_NULL_GL(glGetQueryObjectiv)
+AXIS_NULL_GL(glGetQueryObjectuiv)
+AXIS_NULL_GL(glBindBuffer)
+AXIS_NULL_GL(glDeleteBuffers)
+AXIS_NULL_GL(glGenBuffers)
+AXIS_NULL_GL(glIsBuffer)
+AXIS_NULL_GL(glBufferData)
+AXIS_NULL_GL(glBufferSubData)
+AXIS_NULL_GL(glGetBufferSubData)
+AXIS_NULL_GL(glMapBuffer)
+AXIS_NULL_GL(glUnmapBuffer)
+AXIS_NULL_GL(glGetBufferParameteriv)
+AXIS_NULL_GL(glGetBufferPointerv)
+AXIS_NULL_GL(glBlendEquationSeparate)
+AXIS_NULL_GL(glDrawBuffers)
+AXIS_NULL_GL(glStencilOpSeparate)
+AXIS_NULL_GL(glStencilFuncSeparate)
+AXIS_NULL_GL(glStencilMaskSeparate)
+AXIS_NULL_GL(glAttachShader)
+AXIS_NULL_GL(glBindAttribLocation)
+AXIS_NULL_GL(glCompileShader)
+AXIS_NULL_GL(glCreateProgram)
+AXIS_NULL_GL(glCreateShader)
+AXIS_NULL_GL(glDeleteProgram)
+AXIS_NULL_GL(glDeleteShader)
+AXIS_NULL_GL(glDetachShader)
+AXIS_NULL_GL(glDisableVertexAttribArray)
+AXIS_NULL_GL(glEnableVertexAttribArray)
+AXIS_NULL_GL(glGetActiveAttrib)
+AXIS_NULL_GL(glGetActiveUniform)
+AXIS_NULL_GL(glGetAttachedShaders)
+AXIS_NULL_GL(glGetAttribLocation)
+AXIS_NULL_GL(glGetProgramiv)
+AXIS_NULL_GL(glGetProgramInfoLog)
+AXIS_NULL_GL(glGetShaderiv)
+AXIS_NULL_GL(glGetShaderInfoLog)
+AXIS_NULL_GL(glGetShaderSource)
+AXIS_NULL_GL(glGetUniformLocation)
+AXIS_NULL_GL(glGetUniformfv)
+AXIS_NULL_GL(glGetUniformiv)
+AXIS_NULL_GL(glGetVertexAttribdv)
+AXIS_NULL_GL(glGetVertexAttribfv)
+AXIS_NULL_GL(glGetVertexAttribiv)
+AXIS_NULL_GL(glGetVertexAttribPointerv)
+AXIS_NULL_GL(glIsProgram)
+AXIS_NULL_GL(glIsShader)
+AXIS_NULL_GL(glLinkProgram)
+AXIS_NULL_GL(glShaderSource)
+AXIS_NULL_GL(glUseProgram)
+AXIS_NULL_GL(glUniform1f)
+AXIS_NULL_GL(glUniform2f)
+AXIS_NULL_GL(glUniform3f)
+AXIS_NULL_GL(glUniform4f)
+AXIS_NULL_GL(glUniform1i)
+AXIS_NULL_GL(glUniform2i)
+AXIS_NULL_GL(glUniform3i)
+AXIS_NULL_GL(glUniform4i)
+AXIS_NULL_GL(glUniform1fv)
+AXIS_NULL_GL(glUniform2fv)
+AXIS_NULL_GL(glUniform3fv)
+AXIS_NULL_GL(glUniform4fv)
+AXIS_NULL_GL(glUniform1iv)
+AXIS_NULL_GL(glUniform2iv)
+AXIS_NULL_GL(glUniform3iv)
+AXIS_NULL_GL(glUniform4iv)
+AXIS_NULL_GL(glUniformMatrix2fv)
+AXIS_NULL_GL(glUniformMatrix3fv)
+AXIS_NULL_GL(glUniformMatrix4fv)
+AXIS_NULL_GL(glValidateProgram)
+AXIS_NULL_GL(glVertexAttrib1d)
+AXIS_NULL_GL(glVertexAttrib1dv)
+AXIS_NULL_GL(glVertexAttrib1f)
+AXIS_NULL_GL(glVertexAttrib1fv)
+AXIS_NULL_GL(glVertexAttrib1s)
+AXIS_NULL_GL(glVertexAttrib1sv)
+AXIS_NULL_GL(glVertexAttrib2d)
+AXIS_NULL_GL(glVertexAttrib2dv)
+AXIS_NULL_GL(glVertexAttrib2f)
+AXIS_NULL_GL(glVertexAttrib2fv)
+AXIS_NULL_GL(glVertexAttrib2s)
+AXIS_NULL_GL(glVertexAttrib2sv)
+AXIS_NULL_GL(glVertexAttrib3d)
+AXIS_NULL_GL(glVertexAttrib3dv)
+AXIS_NULL_GL(glVertexAttrib3f)
+AXIS_NULL_GL(glVertexAttrib3fv)
+AXIS_NULL_GL(glVertexAttrib3s)
+AXIS_NULL_GL(glVertexAttrib3sv)
+AXIS_NULL_GL(glVertexAttrib4Nbv)
+AXIS_NULL_GL(glVertexAttrib4Niv)
+AXIS_NULL_GL(glVertexAttrib4Nsv)
+AXIS_NULL_GL(glVertexAttrib4Nub)
+AXIS_NULL_GL(glVertexAttrib4Nubv)
+AXIS_NULL_GL(glVertexAttrib4Nuiv)
+AXIS_NULL_GL(glVertexAttrib4Nusv)
+AXIS_NULL_GL(glVertexAttrib4bv)
+AXIS_NULL_GL(glVertexAttrib4d)
+AXIS_NULL_GL(glVertexAttrib4dv)
+AXIS_NULL_GL(glVertexAttrib4f)
+AXIS_NULL_GL(glVertexAttrib4fv)
+AXIS_NULL_GL(glVertexAttrib4iv)
+AXIS_NULL_GL(glVertexAttrib4s)
+AXIS_NULL_GL(glVertexAttrib4sv)
+AXIS_NULL_GL(glVertexAttrib4ubv)
+AXIS_NULL_GL(glVertexAttrib4uiv)
+AXIS_NULL_GL(glVertexAttrib4usv)
+AXIS_NULL_GL(glVertexAttribPointer)
+AXIS_NULL_GL(glUniformMatrix2x3fv)
+AXIS_NULL_GL(glUniformMatrix3x2fv)
+AXIS_NULL_GL(glUniformMatrix2x4fv)
+AXIS_NULL_GL(glUniformMatrix4x2fv)
+AXIS_NULL_GL(glUniformMatrix3x4fv)
+AXIS_NULL_GL(glUniformMatrix4x3fv)
+AXIS_NULL_GL(glColorMaski)
+AXIS_NULL_GL(glGetBooleani_v)
+AXIS_NULL_GL(glGetIntegeri_v)
+AXIS_NULL_GL(glEnablei)
+AXIS_NULL_GL(glDisablei)
+AXIS_NULL_GL(glIsEnabledi)
+AXIS_NULL_GL(glBeginTransformFeedback)
+AXIS_NULL_GL(glEndTransformFeedback)
+AXIS_NULL_GL(glBindBufferRange)
+AXIS_NULL_GL(glBindBufferBase)
+AXIS_NULL_GL(glTransformFeedbackVaryings)
+AXIS_NULL_GL(glGetTransformFeedbackVarying)
+AXIS_NULL_GL(glClampColor)
+AXIS_NULL_GL(glBeginConditionalRender)
+AXIS_NULL_GL(glEndConditionalRender)
+AXIS_NULL_GL(glVertexAttribIPointer)
+AXIS_NULL_GL(glGetVertexAttribIiv)
+AXIS_NULL_GL(glGetVertexAttribIuiv)
+AXIS_NULL_GL(glVertexAttribI1i)
+AXIS_NULL_GL(glVertexAttribI2i)
+AXIS_NULL_GL(glVertexAttribI3i)
+AXIS_NULL_GL(glVertexAttribI4i)
+AXIS_NULL_GL(glVertexAttribI1ui)
+AXIS_NULL_GL(glVertexAttribI2ui)
+AXIS_NULL_GL(glVertexAttribI3ui)
+AXIS_NULL_GL(glVertexAttribI4ui)
+AXIS_NULL_GL(glVertexAttribI1iv)
+AXIS_NULL_GL(glVertexAttribI2iv)
+AXIS_NULL_GL(glVertexAttribI3iv)
+AXIS_NULL_GL(glVertexAttribI4iv)
+AXIS_NULL_GL(glVertexAttribI1uiv)
+AXIS_NULL_GL(glVertexAttribI2uiv)
+AXIS_NULL_GL(glVertexAttribI3uiv)
+AXIS_NULL_GL(glVertexAttribI4uiv)
+AXIS_NULL_GL(glVertexAttribI4bv)
+AXIS_NULL_GL(glVertexAttribI4sv)
+AXIS_NULL_GL(glVertexAttribI4ubv)
+AXIS_NULL_GL(glVertexAttribI4usv)
+AXIS_NULL_GL(glGetUniformuiv)
+AXIS_NULL_GL(glBindFragDataLocation)
+AXIS_NULL_GL(glGetFragDataLocation)
+AXIS_NULL_GL(glUniform1ui)
+AXIS_NULL_GL(glUniform2ui)
+AXIS_NULL_GL(glUniform3ui)
+AXIS_NULL_GL(glUniform4ui)
+AXIS_NULL_GL(glUniform1uiv)
+AXIS_NULL_GL(glUniform2uiv)
+AXIS_NULL_GL(glUniform3uiv)
+AXIS_NULL_GL(glUniform4uiv)
+AXIS_NULL_GL(glTexParameterIiv)
+AXIS_NULL_GL(glTexParameterIuiv)
+AXIS_NULL_GL(glGetTexParameterIiv)
+AXIS_NULL_GL(glGetTexParameterIuiv)
+AXIS_NULL_GL(glClearBufferiv)
+AXIS_NULL_GL(glClearBufferuiv)
+AXIS_NULL_GL(glClearBufferfv)
+AXIS_NULL_GL(glClearBufferfi)
+AXIS_NULL_GL(glGetStringi)
+AXIS_NULL_GL(glIsRenderbuffer)
+AXIS_NULL_GL(glBindRenderbuffer)
+AXIS_NULL_GL(glDeleteRenderbuffers)
+AXIS_NULL_GL(glGenRenderbuffers)
+AXIS_NULL_GL(glRenderbufferStorage)
+AXIS_NULL_GL(glGetRenderbufferParameteriv)
+AXIS_NULL_GL(glIsFramebuffer)
+AXIS_NULL_GL(glBindFramebuffer)
+AXIS_NULL_GL(glDeleteFramebuffers)
+AXIS_NULL_GL(glGenFramebuffers)
+AXIS_NULL_GL(glCheckFramebufferStatus)
+AXIS_NULL_GL(glFramebufferTexture1D)
+AXIS_NULL_GL(glFramebufferTexture2D)
+AXIS_NULL_GL(glFramebufferTexture3D)
+AXIS_NULL_GL(glFramebufferRenderbuffer)
+AXIS_NULL_GL(glGetFramebufferAttachmentParameteriv)
+AXIS_NULL_GL(glGenerateMipmap)
+AXIS_NULL_GL(glBlitFramebuffer)
+AXIS_NULL_GL(glRenderbufferStorageMultisample)
+AXIS_NULL_GL(glFramebufferTextureLayer)
+AXIS_NULL_GL(glMapBufferRange)
+AXIS_NULL_GL(glFlushMappedBufferRange)
+AXIS_NULL_GL(glBindVertexArray)
+AXIS_NULL_GL(glDeleteVertexArrays)
+AXIS_NULL_GL(glGenVertexArrays)
+AXIS_NULL_GL(glIsVertexArray)
+AXIS_NULL_GL(glDrawArraysInstanced)
+AXIS_NULL_GL(glDrawElementsInstanced)
+AXIS_NULL_GL(glTexBuffer)
+AXIS_NULL_GL(glPrimitiveRestartIndex)
+AXIS_NULL_GL(glCopyBufferSubData)
+AXIS_NULL_GL(glGetUniformIndices)
+AXIS_NULL_GL(glGetActiveUniformsiv)
+AXIS_NULL_GL(glGetActiveUniformName)
+AXIS_NULL_GL(glGetUniformBlockIndex)
+AXIS_NULL_GL(glGetActiveUniformBlockiv)
+AXIS_NULL_GL(glGetActiveUniformBlockName)
+AXIS_NULL_GL(glUniformBlockBinding)
+AXIS_NULL_GL(glDrawElementsBaseVertex)
+AXIS_NULL_GL(glDrawRangeElementsBaseVertex)
+AXIS_NULL_GL(glDrawElementsInstancedBaseVertex)
+AXIS_NULL_GL(glMultiDrawElementsBaseVertex)
+AXIS_NULL_GL(glProvokingVertex)
+AXIS_NULL_GL(glFenceSync)
+AXIS_NULL_GL(glIsSync)
+AXIS_NULL_GL(glDeleteSync)
+AXIS_NULL_GL(glClientWaitSync)
+AXIS_NULL_GL(glWaitSync)
+AXIS_NULL_GL(glGetInteger64v)
+AXIS_NULL_GL(glGetSynciv)
+AXIS_NULL_GL(glGetInteger64i_v)
+AXIS_NULL_GL(glGetBufferParameteri64v)
+AXIS_NULL_GL(glFramebufferTexture)
+AXIS_NULL_GL(glTexImage2DMultisample)
+AXIS_NULL_GL(glTexImage3DMultisample)
+AXIS_NULL_GL(glGetMultisamplefv)
+AXIS_NULL_GL(glSampleMaski)
+AXIS_NULL_GL(glBindFragDataLocationIndexed)
+AXIS_NULL_GL(glGetFragDataIndex)
+AXIS_NULL_GL(glGenSamplers)
+AXIS_NULL_GL(glDeleteSamplers)
+AXIS_NULL_GL(glIsSampler)
+AXIS_NULL_GL(glBindSampler)
+AXIS_NULL_GL(glSamplerParameteri)
+AXIS_NULL_GL(glSamplerParameteriv)
+AXIS_NULL_GL(glSamplerParameterf)
+AXIS_NULL_GL(glSamplerParameterfv)
+AXIS_NULL_GL(glSamplerParameterIiv)
+AXIS_NULL_GL(glSamplerParameterIuiv)
+AXIS_NULL_GL(glGetSamplerParameteriv)
+AXIS_NULL_GL(glGetSamplerParameterIiv)
+AXIS_NULL_GL(glGetSamplerParameterfv)
+AXIS_NULL_GL(glGetSamplerParameterIuiv)
+AXIS_NULL_GL(glQueryCounter)
+AXIS_NULL_GL(glGetQueryObjecti64v)
+AXIS_NULL_GL(glGetQueryObjectui64v)
+AXIS_NULL_GL(glVertexAttribDivisor)
+AXIS_NULL_GL(glVertexAttribP1ui)
+AXIS_NULL_GL(glVertexAttribP1uiv)
+AXIS_NULL_GL(glVertexAttribP2ui)
+AXIS_NULL_GL(glVertexAttribP2uiv)
+AXIS_NULL_GL(glVertexAttribP3ui)
+AXIS_NULL_GL(glVertexAttribP3uiv)
+AXIS_NULL_GL(glVertexAttribP4ui)
+AXIS_NULL_GL(glVertexAttribP4uiv)
+AXIS_NULL_GL(glVertexP2ui)
+AXIS_NULL_GL(glVertexP2uiv)
+AXIS_NULL_GL(glVertexP3ui)
+AXIS_NULL_GL(glVertexP3uiv)
+AXIS_NULL_GL(glVertexP4ui)
+AXIS_NULL_GL(glVertexP4uiv)
+AXIS_NULL_GL(glTexCoordP1ui)
+AXIS_NULL_GL(glTexCoordP1uiv)
+AXIS_NULL_GL(glTexCoordP2ui)
+AXIS_NULL_GL(glTexCoordP2uiv)
+AXIS_NULL_GL(glTexCoordP3ui)
+AXIS_NULL_GL(glTexCoordP3uiv)
+AXIS_NULL_GL(glTexCoordP4ui)
+AXIS_NULL_GL(glTexCoordP4uiv)
+AXIS_NULL_GL(glMultiTexCoordP1ui)
+AXIS_NULL_GL(glMultiTexCoordP1uiv)
+AXIS_NULL_GL(glMultiTexCoordP2ui)
+AXIS_NULL_GL(glMultiTexCoordP2uiv)
+AXIS_NULL_GL(glMultiTexCoordP3ui)
+AXIS_NULL_GL(glMultiTexCoordP3uiv)
+AXIS_NULL_GL(glMultiTexCoordP4ui)
+AXIS_NULL_GL(glMultiTexCoordP4uiv)
+AXIS_NULL_GL(glNormalP3ui)
+AXIS_NULL_GL(glNormalP3uiv)
+AXIS_NULL_GL(glColorP3ui)
+AXIS_NULL_GL(glColorP3uiv)
+AXIS_NULL_GL(glColorP4ui)
+AXIS_NULL_GL(glColorP4uiv)
+AXIS_NULL_GL(glSecondaryColorP3ui)
+AXIS_NULL_GL(glSecondaryColorP3uiv)
+AXIS_NULL_GL(glMinSampleShading)
+AXIS_NULL_GL(glBlendEquationi)
+AXIS_NULL_GL(glBlendEquationSeparatei)
+AXIS_NULL_GL(glBlendFunci)
+AXIS_NULL_GL(glBlendFuncSeparatei)
+AXIS_NULL_GL(glDrawArraysIndirect)
+AXIS_NULL_GL(glDrawElementsIndirect)
+AXIS_NULL_GL(glUniform1d)
+AXIS_NULL_GL(glUniform2d)
+AXIS_NULL_GL(glUniform3d)
+AXIS_NULL_GL(glUniform4d)
+AXIS_NULL_GL(glUniform1dv)
+AXIS_NULL_GL(glUniform2dv)
+AXIS_NULL_GL(glUniform3dv)
+AXIS_NULL_GL(glUniform4dv)
+AXIS_NULL_GL(glUniformMatrix2dv)
+AXIS_NULL_GL(glUniformMatrix3dv)
+AXIS_NULL_GL(glUniformMatrix4dv)
+AXIS_NULL_GL(glUniformMatrix2x3dv)
+AXIS_NULL_GL(glUniformMatrix2x4dv)
+AXIS_NULL_GL(glUniformMatrix3x2dv)
+AXIS_NULL_GL(glUniformMatrix3x4dv)
+AXIS_NULL_GL(glUniformMatrix4x2dv)
+AXIS_NULL_GL(glUniformMatrix4x3dv)
+AXIS_NULL_GL(glGetUniformdv)
+AXIS_NULL_GL(glGetSubroutineUniformLocation)
+AXIS_NULL_GL(glGetSubroutineIndex)
+AXIS_NULL_GL(glGetActiveSubroutineUniformiv)
+AXIS_NULL_GL(glGetActiveSubroutineUniformName)
+AXIS_NULL_GL(glGetActiveSubroutineName)
+AXIS_NULL_GL(glUniformSubroutinesuiv)
+AXIS_NULL_GL(glGetUniformSubroutineuiv)
+AXIS_NULL_GL(glGetProgramStageiv)
+AXIS_NULL_GL(glPatchParameteri)
+AXIS_NULL_GL(glPatchParameterfv)
+AXIS_NULL_GL(glBindTransformFeedback)
+AXIS_NULL_GL(glDeleteTransformFeedbacks)
+AXIS_NULL_GL(glGenTransformFeedbacks)
+AXIS_NULL_GL(glIsTransformFeedback)
+AXIS_NULL_GL(glPauseTransformFeedback)
+AXIS_NULL_GL(glResumeTransformFeedback)
+AXIS_NULL_GL(glDrawTransformFeedback)
+AXIS_NULL_GL(glDrawTransformFeedbackStream)
+AXIS_NULL_GL(glBeginQueryIndexed)
+AXIS_NULL_GL(glEndQueryIndexed)
+AXIS_NULL_GL(glGetQueryIndexediv)
+AXIS_NULL_GL(glReleaseShaderCompiler)
+AXIS_NULL_GL(glShaderBinary)
+AXIS_NULL_GL(glGetShaderPrecisionFormat)
+AXIS_NULL_GL(glDepthRangef)
+AXIS_NULL_GL(glClearDepthf)
+AXIS_NULL_GL(glGetProgramBinary)
+AXIS_NULL_GL(glProgramBinary)
+AXIS_NULL_GL(glProgramParameteri)
+AXIS_NULL_GL(glUseProgramStages)
+AXIS_NULL_GL(glActiveShaderProgram)
+AXIS_NULL_GL(glCreateShaderProgramv)
+AXIS_NULL_GL(glBindProgramPipeline)
+AXIS_NULL_GL(glDeleteProgramPipelines)
+AXIS_NULL_GL(glGenProgramPipelines)
+AXIS_NULL_GL(glIsProgramPipeline)
+AXIS_NULL_GL(glGetProgramPipelineiv)
+AXIS_NULL_GL(glProgramUniform1i)
+AXIS_NULL_GL(glProgramUniform1iv)
+AXIS_NULL_GL(glProgramUniform1f)
+AXIS_NULL_GL(glProgramUniform1fv)
+AXIS_NULL_GL(glProgramUniform1d)
+AXIS_NULL_GL(glProgramUniform1dv)
+AXIS_NULL_GL(glProgramUniform1ui)
+AXIS_NULL_GL(glProgramUniform1uiv)
+AXIS_NULL_GL(glProgramUniform2i)
+AXIS_NULL_GL(glProgramUniform2iv)
+AXIS_NULL_GL(glProgramUniform2f)
+AXIS_NULL_GL(glProgramUniform2fv)
+AXIS_NULL_GL(glProgramUniform2d)
+AXIS_NULL_GL(glProgramUniform2dv)
+AXIS_NULL_GL(glProgramUniform2ui)
+AXIS_NULL_GL(glProgramUniform2uiv)
+AXIS_NULL_GL(glProgramUniform3i)
+AXIS_NULL_GL(glProgramUniform3iv)
+AXIS_NULL_GL(glProgramUniform3f)
+AXIS_NULL_GL(glProgramUniform3fv)
+AXIS_NULL_GL(glProgramUniform3d)
+AXIS_NULL_GL(glProgramUniform3dv)
+AXIS_NULL_GL(glProgramUniform3ui)
+AXIS_NULL_GL(glProgramUniform3uiv)
+AXIS_NULL_GL(glProgramUniform4i)
+AXIS_NULL_GL(glProgramUniform4iv)
+AXIS_NULL_GL(glProgramUniform4f)
+AXIS_NULL_GL(glProgramUniform4fv)
+AXIS_NULL_GL(glProgramUniform4d)
+AXIS_NULL_GL(glProgramUniform4dv)
+AXIS_NULL_GL(glProgramUniform4ui)
+AXIS_NULL_GL(glProgramUniform4uiv)
+AXIS_NULL_GL(glProgramUniformMatrix2fv)
+AXIS_NULL_GL(glProgramUniformMatrix3fv)
+AXIS_NULL_GL(glProgramUniformMatrix4fv)
+AXIS_NULL_GL(glProgramUniformMatrix2dv)
+AXIS_NULL_GL(glProgramUniformMatrix3dv)
+AXIS_NULL_GL(glProgramUniformMatrix4dv)
+AXIS_NULL_GL(glProgramUniformMatrix2x3fv)
+AXIS_NULL_GL(glProgramUniformMatrix3x2fv)
+AXIS_NULL_GL(glProgramUniformMatrix2x4fv)
+AXIS_NULL_GL(glProgramUniformMatrix4x2fv)
+AXIS_NULL_GL(glProgramUniformMatrix3x4fv)
+AXIS_NULL_GL(glProgramUniformMatrix4x3fv)
+AXIS_NULL_GL(glProgramUniformMatrix2x3dv)
+AXIS_NULL_GL(glProgramUniformMatrix3x2dv)
+AXIS_NULL_GL(glProgramUniformMatrix2x4dv)
+AXIS_NULL_GL(glProgramUniformMatrix4x2dv)
+AXIS_NULL_GL(glProgramUniformMatrix3x4dv)
+AXIS_NULL_GL(glProgramUniformMatrix4x3dv)
+AXIS_NULL_GL(glValidateProgramPipeline)
+AXIS_NULL_GL(glGetProgramPipelineInfoLog)
+AXIS_NULL_GL(glVertexAttribL1d)
+AXIS_NULL_GL(glVertexAttribL2d)
+AXIS_NULL_GL(glVertexAttribL3d)
+AXIS_NULL_GL(glVertexAttribL4d)
+AXIS_NULL_GL(glVertexAttribL1dv)
+AXIS_NULL_GL(glVertexAttribL2dv)
+AXIS_NULL_GL(glVertexAttribL3dv)
+AXIS_NULL_GL(glVertexAttribL4dv)
+AXIS_NULL_GL(glVertexAttribLPointer)
+AXIS_NULL_GL(glGetVertexAttribLdv)
+AXIS_NULL_GL(glViewportArrayv)
+AXIS_NULL_GL(glViewportIndexedf)
+AXIS_NULL_GL(glViewportIndexedfv)
+AXIS_NULL_GL(glScissorArrayv)
+AXIS_NULL_GL(glScissorIndexed)
+AXIS_NULL_GL(glScissorIndexedv)
+AXIS_NULL_GL(glDepthRangeArrayv)
+AXIS_NULL_GL(glDepthRangeIndexed)
+AXIS_NULL_GL(glGetFloati_v)
+AXIS_NULL_GL(glGetDoublei_v)
+AXIS_NULL_GL(glDrawArraysInstancedBaseInstance)
+AXIS_NULL_GL(glDrawElementsInstancedBaseInstance)
+AXIS_NULL_GL(glDrawElementsInstancedBaseVertexBaseInstance)
+AXIS_NULL_GL(glGetInternalformativ)
+AXIS_NULL_GL(glGetActiveAtomicCounterBufferiv)
+AXIS_NULL_GL(glBindImageTexture)
+AXIS_NULL_GL(glMemoryBarrier)
+AXIS_NULL_GL(glTexStorage1D)
+AXIS_NULL_GL(glTexStorage2D)
+AXIS_NULL_GL(glTexStorage3D)
+AXIS_NULL_GL(glDrawTransformFeedbackInstanced)
+AXIS_NULL_GL(glDrawTransformFeedbackStreamInstanced)
+AXIS_NULL_GL(glClearBufferData)
+AXIS_NULL_GL(glClearBufferSubData)
+AXIS_NULL_GL(glDispatchCompute)
+AXIS_NULL_GL(glDispatchComputeIndirect)
+AXIS_NULL_GL(glCopyImageSubData)
+AXIS_NULL_GL(glFramebufferParameteri)
+AXIS_NULL_GL(glGetFramebufferParameteriv)
+AXIS_NULL_GL(glGetInternalformati64v)
+AXIS_NULL_GL(glInvalidateTexSubImage)
+AXIS_NULL_GL(glInvalidateTexImage)
+AXIS_NULL_GL(glInvalidateBufferSubData)
+AXIS_NULL_GL(glInvalidateBufferData)
+AXIS_NULL_GL(glInvalidateFramebuffer)
+AXIS_NULL_GL(glInvalidateSubFramebuffer)
+AXIS_NULL_GL(glMultiDrawArraysIndirect)
+AXIS_NULL_GL(glMultiDrawElementsIndirect)
+AXIS_NULL_GL(glGetProgramInterfaceiv)
+AXIS_NULL_GL(glGetProgramResourceIndex)
+AXIS_NULL_GL(glGetProgramResourceName)
+AXIS_NULL_GL(glGetProgramResourceiv)
+AXIS_NULL_GL(glGetProgramResourceLocation)
+AXIS_NULL_GL(glGetProgramResourceLocationIndex)
+AXIS_NULL_GL(glShaderStorageBlockBinding)
+AXIS_NULL_GL(glTexBufferRange)
+AXIS_NULL_GL(glTexStorage2DMultisample)
+AXIS_NULL_GL(glTexStorage3DMultisample)
+AXIS_NULL_GL(glTextureView)
+AXIS_NULL_GL(glBindVertexBuffer)
+AXIS_NULL_GL(glVertexAttribFormat)
+AXIS_NULL_GL(glVertexAttribIFormat)
+AXIS_NULL_GL(glVertexAttribLFormat)
+AXIS_NULL_GL(glVertexAttribBinding)
+AXIS_NULL_GL(glVertexBindingDivisor)
+AXIS_NULL_GL(glDebugMessageControl)
+AXIS_NULL_GL(glDebugMessageInsert)
+AXIS_NULL_GL(glDebugMessageCallback)
+AXIS_NULL_GL(glGetDebugMessageLog)
+AXIS_NULL_GL(glPushDebugGroup)
+AXIS_NULL_GL(glPopDebugGroup)
+AXIS_NULL_GL(glObjectLabel)
+AXIS_NULL_GL(glGetObjectLabel)
+AXIS_NULL_GL(glObjectPtrLabel)
+AXIS_NULL_GL(glGetObjectPtrLabel)
+AXIS_NULL_GL(glBufferStorage)
+AXIS_NULL_GL(glClearTexImage)
+AXIS_NULL_GL(glClearTexSubImage)
+AXIS_NULL_GL(glBindBuffersBase)
+AXIS_NULL_GL(glBindBuffersRange)
+AXIS_NULL_GL(glBindTextures)
+AXIS_NULL_GL(glBindSamplers)
+AXIS_NULL_GL(glBindImageTextures)
+AXIS_NULL_GL(glBindVertexBuffers)
+AXIS_NULL_GL(glClipControl)
+AXIS_NULL_GL(glCreateTransformFeedbacks)
+AXIS_NULL_GL(glTransformFeedbackBufferBase)
+AXIS_NULL_GL(glTransformFeedbackBufferRange)
+AXIS_NULL_GL(glGetTransformFeedbackiv)
+AXIS_NULL_GL(glGetTransformFeedbacki_v)
+AXIS_NULL_GL(glGetTransformFeedbacki64_v)
+AXIS_NULL_GL(glCreateBuffers)
+AXIS_NULL_GL(glNamedBufferStorage)
+AXIS_NULL_GL(glNamedBufferData)
+AXIS_NULL_GL(glNamedBufferSubData)
+AXIS_NULL_GL(glCopyNamedBufferSubData)
+AXIS_NULL_GL(glClearNamedBufferData)
+AXIS_NULL_GL(glClearNamedBufferSubData)
+AXIS_NULL_GL(glMapNamedBuffer)
+AXIS_NULL_GL(glMapNamedBufferRange)
+AXIS_NULL_GL(glUnmapNamedBuffer)
+AXIS_NULL_GL(glFlushMappedNamedBufferRange)
+AXIS_NULL_GL(glGetNamedBufferParameteriv)
+AXIS_NULL_GL(glGetNamedBufferParameteri64v)
+AXIS_NULL_GL(glGetNamedBufferPointerv)
+AXIS_NULL_GL(glGetNamedBufferSubData)
+AXIS_NULL_GL(glCreateFramebuffers)
+AXIS_NULL_GL(glNamedFramebufferRenderbuffer)
+AXIS_NULL_GL(glNamedFramebufferParameteri)
+AXIS_NULL_GL(glNamedFramebufferTexture)
+AXIS_NULL_GL(glNamedFramebufferTextureLayer)
+AXIS_NULL_GL(glNamedFramebufferDrawBuffer)
+AXIS_NULL_GL(glNamedFramebufferDrawBuffers)
+AXIS_NULL_GL(glNamedFramebufferReadBuffer)
+AXIS_NULL_GL(glInvalidateNamedFramebufferData)
+AXIS_NULL_GL(glInvalidateNamedFramebufferSubData)
+AXIS_NULL_GL(glClearNamedFramebufferiv)
+AXIS_NULL_GL(glClearNamedFramebufferuiv)
+AXIS_NULL_GL(glClearNamedFramebufferfv)
+AXIS_NULL_GL(glClearNamedFramebufferfi)
+AXIS_NULL_GL(glBlitNamedFramebuffer)
+AXIS_NULL_GL(glCheckNamedFramebufferStatus)
+AXIS_NULL_GL(glGetNamedFramebufferParameteriv)
+AXIS_NULL_GL(glGetNamedFramebufferAttachmentParameteriv)
+AXIS_NULL_GL(glCreateRenderbuffers)
+AXIS_NULL_GL(glNamedRenderbufferStorage)
+AXIS_NULL_GL(glNamedRenderbufferStorageMultisample)
+AXIS_NULL_GL(glGetNamedRenderbufferParameteriv)
+AXIS_NULL_GL(glCreateTextures)
+AXIS_NULL_GL(glTextureBuffer)
+AXIS_NULL_GL(glTextureBufferRange)
+AXIS_NULL_GL(glTextureStorage1D)
+AXIS_NULL_GL(glTextureStorage2D)
+AXIS_NULL_GL(glTextureStorage3D)
+AXIS_NULL_GL(glTextureStorage2DMultisample)
+AXIS_NULL_GL(glTextureStorage3DMultisample)
+AXIS_NULL_GL(glTextureSubImage1D)
+AXIS_NULL_GL(glTextureSubImage2D)
+AXIS_NULL_GL(glTextureSubImage3D)
+AXIS_NULL_GL(glCompressedTextureSubImage1D)
+AXIS_NULL_GL(glCompressedTextureSubImage2D)
+AXIS_NULL_GL(glCompressedTextureSubImage3D)
+AXIS_NULL_GL(glCopyTextureSubImage1D)
+AXIS_NULL_GL(glCopyTextureSubImage2D)
+AXIS_NULL_GL(glCopyTextureSubImage3D)
+AXIS_NULL_GL(glTextureParameterf)
+AXIS_NULL_GL(glTextureParameterfv)
+AXIS_NULL_GL(glTextureParameteri)
+AXIS_NULL_GL(glTextureParameterIiv)
+AXIS_NULL_GL(glTextureParameterIuiv)
+AXIS_NULL_GL(glTextureParameteriv)
+AXIS_NULL_GL(glGenerateTextureMipmap)
+AXIS_NULL_GL(glBindTextureUnit)
+AXIS_NULL_GL(glGetTextureImage)
+AXIS_NULL_GL(glGetCompressedTextureImage)
+AXIS_NULL_GL(glGetTextureLevelParameterfv)
+AXIS_NULL_GL(glGetTextureLevelParameteriv)
+AXIS_NULL_GL(glGetTextureParameterfv)
+AXIS_NULL_GL(glGetTextureParameterIiv)
+AXIS_NULL_GL(glGetTextureParameterIuiv)
+AXIS_NULL_GL(glGetTextureParameteriv)
+AXIS_NULL_GL(glCreateVertexArrays)
+AXIS_NULL_GL(glDisableVertexArrayAttrib)
+AXIS_NULL_GL(glEnableVertexArrayAttrib)
+AXIS_NULL_GL(glVertexArrayElementBuffer)
+AXIS_NULL_GL(glVertexArrayVertexBuffer)
+AXIS_NULL_GL(glVertexArrayVertexBuffers)
+AXIS_NULL_GL(glVertexArrayAttribBinding)
+AXIS_NULL_GL(glVertexArrayAttribFormat)
+AXIS_NULL_GL(glVertexArrayAttribIFormat)
+AXIS_NULL_GL(glVertexArrayAttribLFormat)
+AXIS_NULL_GL(glVertexArrayBindingDivisor)
+AXIS_NULL_GL(glGetVertexArrayiv)
+AXIS_NULL_GL(glGetVertexArrayIndexediv)
+AXIS_NULL_GL(glGetVertexArrayIndexed64iv)
+AXIS_NULL_GL(glCreateSamplers)
+AXIS_NULL_GL(glCreateProgramPipelines)
+AXIS_NULL_GL(glCreateQueries)
+AXIS_NULL_GL(glGetQueryBufferObjecti64v)
+AXIS_NULL_GL(glGetQueryBufferObjectiv)
+AXIS_NULL_GL(glGetQueryBufferObjectui64v)
+AXIS_NULL_GL(glGetQueryBufferObjectuiv)
+AXIS_NULL_GL(glMemoryBarrierByRegion)
+AXIS_NULL_GL(glGetTextureSubImage)
+AXIS_NULL_GL(glGetCompressedTextureSubImage)
+AXIS_NULL_GL(glGetGraphicsResetStatus)
+AXIS_NULL_GL(glGetnCompressedTexImage)
+AXIS_NULL_GL(glGetnTexImage)
+AXIS_NULL_GL(glGetnUniformdv)
+AXIS_NULL_GL(glGetnUniformfv)
+AXIS_NULL_GL(glGetnUniformiv)
+AXIS_NULL_GL(glGetnUniformuiv)
+AXIS_NULL_GL(glReadnPixels)
+AXIS_NULL_GL(glGetnMapdv)
+AXIS_NULL_GL(glGetnMapfv)
+AXIS_NULL_GL(glGetnMapiv)
+AXIS_NULL_GL(glGetnPixelMapfv)
+AXIS_NULL_GL(glGetnPixelMapuiv)
+AXIS_NULL_GL(glGetnPixelMapusv)
+AXIS_NULL_GL(glGetnPolygonStipple)
+AXIS_NULL_GL(glGetnColorTable)
+AXIS_NULL_GL(glGetnConvolutionFilter)
+AXIS_NULL_GL(glGetnSeparableFilter)
+AXIS_NULL_GL(glGetnHistogram)
+AXIS_NULL_GL(glGetnMinmax)
+AXIS_NULL_GL(glTextureBarrier)
+AXIS_NULL_GL(glDebugMessageControlKHR)
+AXIS_NULL_GL(glDebugMessageInsertKHR)
+AXIS_NULL_GL(glDebugMessageCallbackKHR)
+AXIS_NULL_GL(glGetDebugMessageLogKHR)
+AXIS_NULL_GL(glPushDebugGroupKHR)
+AXIS_NULL_GL(glPopDebugGroupKHR)
+AXIS_NULL_GL(glObjectLabelKHR)
+AXIS_NULL_GL(glGetObjectLabelKHR)
+AXIS_NULL_GL(glObjectPtrLabelKHR)
+AXIS_NULL_GL(glGetObjectPtrLabelKHR)
+AXIS_NULL_GL(glGetPointervKHR)
@@ -0,0 +1,751 @@
+#include <glad/glad.h>
+#include <graphic/core/render_device.h>
+#include <utils/logger.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    RenderBackend s_Backend = RenderBackend::OpenGL;
+    bool s_Initialized = false;
+    RenderDeviceStats s_Current;
+    RenderDeviceStats s_LastFrame;
+    RenderDeviceStats s_Total;
+    uint64_t s_FrameCount = 0;
+
+    uint64_t BytesPerPixel(GLenum format, GLenum type)
+    {
+        uint64_t channels = 4;
+        switch (format)
+        {
+        case GL_RED:
+        case GL_DEPTH_COMPONENT:
+            channels = 1;
+            break;
+        case GL_RG:
+            channels = 2;
+            break;
+        case GL_RGB:
+            channels = 3;
+            break;
+        default:
+            break;
+        }
+
+        uint64_t size = 1;
+        switch (type)
+        {
+        case GL_FLOAT:
+        case GL_INT:
+        case GL_UNSIGNED_INT:
+            size = 4;
+            break;
+        case GL_HALF_FLOAT:
+        case GL_SHORT:
+        case GL_UNSIGNED_SHORT:
+            size = 2;
+            break;
+        default:
+            break;
+        }
+        return channels * size;
+    }
+
+    // ---------------------------------------------------------------------
+    // Null backend: host-side stand-ins for the entry points the engine uses.
+    // ---------------------------------------------------------------------
+    namespace NullGL
+    {
+        // Allocated once per glBufferData/glBufferStorage and never resized, so a persistent
+        // mapping (GpuRingBuffer) stays valid until the buffer is respecified or deleted
+        struct BufferStore
+        {
+            std::unique_ptr<unsigned char[]> data;
+            size_t size = 0;
+        };
+
+        GLuint s_NextName = 1;
+        std::unordered_map<GLenum, GLuint> s_BoundBuffers;
+        std::unordered_map<GLuint, BufferStore> s_BufferStore;
+        GLint s_Viewport[4] = {0, 0, 0, 0};
+
+        void GenNames(GLsizei n, GLuint *names)
+        {
+            for (GLsizei i = 0; i < n; ++i)
+                names[i] = s_NextName++;
+        }
+
+        const GLubyte *APIENTRY GetString(GLenum name)
+        {
+            switch (name)
+            {
+            case GL_VERSION:
+                return reinterpret_cast<const GLubyte *>("4.5.0 AxisEngine Null");
+            case GL_VENDOR:
+                return reinterpret_cast<const GLubyte *>("AxisEngine");
+            case GL_RENDERER:
+                return reinterpret_cast<const GLubyte *>("Null Device");
+            case GL_SHADING_LANGUAGE_VERSION:
+                return reinterpret_cast<const GLubyte *>("4.50");
+            default:
+                return reinterpret_cast<const GLubyte *>("");
+            }
+        }
+
+        // glad refuses to load with an empty extension list, so report a single harmless one.
+        const GLubyte *APIENTRY GetStringi(GLenum name, GLuint index)
+        {
+            if (name == GL_EXTENSIONS && index == 0)
+                return reinterpret_cast<const GLubyte *>("GL_KHR_debug");
+            return nullptr;
+        }
+
+        GLenum APIENTRY GetError() { return GL_NO_ERROR; }
+
+        void APIENTRY GetIntegerv(GLenum pname, GLint *data)
+        {
+            if (!data)
+                return;
+
+            switch (pname)
+            {
+            case GL_POLYGON_MODE:
+                data[0] = GL_FILL;
+                data[1] = GL_FILL;
+                break;
+            case GL_VIEWPORT:
+                std::memcpy(data, s_Viewport, sizeof(s_Viewport));
+                break;
+            case GL_NUM_EXTENSIONS:
+                data[0] = 1;
+                break;
+            case GL_MAX_TEXTURE_SIZE:
+                data[0] = 16384;
+                break;
+            case GL_MAX_UNIFORM_BLOCK_SIZE:
+                data[0] = 65536;
+                break;
+            case GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT:
+            case GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT:
+                data[0] = 256;
+                break;
+            default:
+                data[0] = 0;
+                break;
+            }
+        }
+
+        void APIENTRY Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
+        {
+            s_Viewport[0] = x;
+            s_Viewport[1] = y;
+            s_Viewport[2] = width;
+            s_Viewport[3] = height;
+        }
+
+        void APIENTRY GenBuffers(GLsizei n, GLuint *names) { GenNames(n, names); }
+        void APIENTRY GenTextures(GLsizei n, GLuint *names) { GenNames(n, names); }
+        void APIENTRY GenVertexArrays(GLsizei n, GLuint *names) { GenNames(n, names); }
+        void APIENTRY GenFramebuffers(GLsizei n, GLuint *names) { GenNames(n, names); }
+        void APIENTRY GenRenderbuffers(GLsizei n, GLuint *names) { GenNames(n, names); }
+        GLuint APIENTRY CreateShader(GLenum) { return s_NextName++; }
+        GLuint APIENTRY CreateProgram() { return s_NextName++; }
+
+        void APIENTRY DeleteBuffers(GLsizei n, const GLuint *names)
+        {
+            for (GLsizei i = 0; i < n; ++i)
+                s_BufferStore.erase(names[i]);
+        }
+
+        void APIENTRY BindBuffer(GLenum target, GLuint buffer) { s_BoundBuffers[target] = buffer; }
+
+        void APIENTRY BufferData(GLenum target, GLsizeiptr size, const void *data, GLenum)
+        {
+            auto &store = s_BufferStore[s_BoundBuffers[target]];
+            store.size = size > 0 ? static_cast<size_t>(size) : 0;
+            store.data = std::make_unique<unsigned char[]>(store.size);
+            if (data && store.size > 0)
+                std::memcpy(store.data.get(), data, store.size);
+        }
+
+        void APIENTRY BufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield)
+        {
+            BufferData(target, size, data, 0);
+        }
+
+        void APIENTRY BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
+        {
+            auto &store = s_BufferStore[s_BoundBuffers[target]];
+            if (data && offset >= 0 && size >= 0 && static_cast<size_t>(offset + size) <= store.size)
+                std::memcpy(store.data.get() + offset, data, static_cast<size_t>(size));
+        }
+
+        // Out of range is GL_INVALID_VALUE on a real driver; the mapping fails the same way here
+        void *APIENTRY MapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield)
+        {
+            auto &store = s_BufferStore[s_BoundBuffers[target]];
+            if (!store.data || offset < 0 || length <= 0 || static_cast<size_t>(offset + length) > store.size)
+                return nullptr;
+            return store.data.get() + offset;
+        }
+
+        void *APIENTRY MapBuffer(GLenum target, GLenum)
+        {
+            auto &store = s_BufferStore[s_BoundBuffers[target]];
+            return store.size == 0 ? nullptr : store.data.get();
+        }
+
+        GLboolean APIENTRY UnmapBuffer(GLenum) { return GL_TRUE; }
+
+        void APIENTRY GetShaderiv(GLuint, GLenum pname, GLint *params)
+        {
+            *params = (pname == GL_COMPILE_STATUS) ? GL_TRUE : 0;
+        }
+
+        void APIENTRY GetProgramiv(GLuint, GLenum pname, GLint *params)
+        {
+            *params = (pname == GL_LINK_STATUS || pname == GL_VALIDATE_STATUS) ? GL_TRUE : 0;
+        }
+
+        void APIENTRY GetInfoLog(GLuint, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+        {
+            if (length)
+                *length = 0;
+            if (infoLog && bufSize > 0)
+                infoLog[0] = '\0';
+        }
+
+        GLint APIENTRY GetUniformLocation(GLuint, const GLchar *) { return 0; }
+        GLint APIENTRY GetAttribLocation(GLuint, const GLchar *) { return 0; }
+        GLuint APIENTRY GetUniformBlockIndex(GLuint, const GLchar *) { return 0; }
+        GLenum APIENTRY CheckFramebufferStatus(GLenum) { return GL_FRAMEBUFFER_COMPLETE; }
+
+        GLsync APIENTRY FenceSync(GLenum, GLbitfield) { return reinterpret_cast<GLsync>(static_cast<uintptr_t>(s_NextName++)); }
+        GLenum APIENTRY ClientWaitSync(GLsync, GLbitfield, GLuint64) { return GL_ALREADY_SIGNALED; }
+        void APIENTRY DeleteSync(GLsync) {}
+
+        // Every other entry point gets a stub of its own exact type, which ignores its arguments
+        // and returns a value-initialised result (0, GL_FALSE, nullptr)
+        template <typename Fn>
+        struct Stub;
+
+        template <typename R, typename... Args>
+        struct Stub<R(APIENTRYP)(Args...)>
+        {
+            static R APIENTRY Call(Args...) { return R(); }
+        };
+
+        struct Entry
+        {
+            const char *name;
+            void *proc;
+        };
+
+        const Entry s_Entries[] = {
+            {"glGetString", (void *)&GetString},
+            {"glGetStringi", (void *)&GetStringi},
+            {"glGetError", (void *)&GetError},
+            {"glGetIntegerv", (void *)&GetIntegerv},
+            {"glViewport", (void *)&Viewport},
+            {"glGenBuffers", (void *)&GenBuffers},
+            {"glGenTextures", (void *)&GenTextures},
+            {"glGenVertexArrays", (void *)&GenVertexArrays},
+            {"glGenFramebuffers", (void *)&GenFramebuffers},
+            {"glGenRenderbuffers", (void *)&GenRenderbuffers},
+            {"glCreateShader", (void *)&CreateShader},
+            {"glCreateProgram", (void *)&CreateProgram},
+            {"glDeleteBuffers", (void *)&DeleteBuffers},
+            {"glBindBuffer", (void *)&BindBuffer},
+            {"glBufferData", (void *)&BufferData},
+            {"glBufferStorage", (void *)&BufferStorage},
+            {"glBufferSubData", (void *)&BufferSubData},
+            {"glMapBufferRange", (void *)&MapBufferRange},
+            {"glMapBuffer", (void *)&MapBuffer},
+            {"glUnmapBuffer", (void *)&UnmapBuffer},
+            {"glGetShaderiv", (void *)&GetShaderiv},
+            {"glGetProgramiv", (void *)&GetProgramiv},
+            {"glGetShaderInfoLog", (void *)&GetInfoLog},
+            {"glGetProgramInfoLog", (void *)&GetInfoLog},
+            {"glGetUniformLocation", (void *)&GetUniformLocation},
+            {"glGetAttribLocation", (void *)&GetAttribLocation},
+            {"glGetUniformBlockIndex", (void *)&GetUniformBlockIndex},
+            {"glCheckFramebufferStatus", (void *)&CheckFramebufferStatus},
+            {"glFenceSync", (void *)&FenceSync},
+            {"glClientWaitSync", (void *)&ClientWaitSync},
+            {"glDeleteSync", (void *)&DeleteSync},
+        };
+
+        void *Load(const char *name)
+        {
+            for (const Entry &entry : s_Entries)
+            {
+                if (std::strcmp(entry.name, name) == 0)
+                    return entry.proc;
+            }
+            return nullptr;
+        }
+
+        // After glad has loaded: whatever Load did not provide, including entry points of versions
+        // and extensions glad skipped, gets its typed stub
+        void FillStubs()
+        {
+#define AXIS_NULL_GL(fn)   \
+    if (!glad_##fn)        \
+        glad_##fn = &Stub<decltype(glad_##fn)>::Call;
+#include "null_gl_entry_points.inl"
+#undef AXIS_NULL_GL
+        }
+    }
+
+    // ---------------------------------------------------------------------
+    // Recording wrappers: count, then forward to the loaded entry point.
+    // ---------------------------------------------------------------------
+    namespace Record
+    {
+        PFNGLDRAWARRAYSPROC s_DrawArrays = nullptr;
+        PFNGLDRAWELEMENTSPROC s_DrawElements = nullptr;
+        PFNGLDRAWARRAYSINSTANCEDPROC s_DrawArraysInstanced = nullptr;
+        PFNGLDRAWELEMENTSINSTANCEDPROC s_DrawElementsInstanced = nullptr;
+        PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC s_DrawElementsInstancedBaseInstance = nullptr;
+        PFNGLMULTIDRAWELEMENTSINDIRECTPROC s_MultiDrawElementsIndirect = nullptr;
+
+        PFNGLENABLEPROC s_Enable = nullptr;
+        PFNGLDISABLEPROC s_Disable = nullptr;
+        PFNGLBLENDFUNCPROC s_BlendFunc = nullptr;
+        PFNGLDEPTHFUNCPROC s_DepthFunc = nullptr;
+        PFNGLDEPTHMASKPROC s_DepthMask = nullptr;
+        PFNGLCULLFACEPROC s_CullFace = nullptr;
+        PFNGLPOLYGONMODEPROC s_PolygonMode = nullptr;
+        PFNGLVIEWPORTPROC s_Viewport = nullptr;
+        PFNGLBINDVERTEXARRAYPROC s_BindVertexArray = nullptr;
+        PFNGLBINDBUFFERPROC s_BindBuffer = nullptr;
+        PFNGLBINDBUFFERBASEPROC s_BindBufferBase = nullptr;
+        PFNGLBINDBUFFERRANGEPROC s_BindBufferRange = nullptr;
+        PFNGLACTIVETEXTUREPROC s_ActiveTexture = nullptr;
+        PFNGLBINDTEXTUREPROC s_BindTexture = nullptr;
+        PFNGLUSEPROGRAMPROC s_UseProgram = nullptr;
+        PFNGLBINDFRAMEBUFFERPROC s_BindFramebuffer = nullptr;
+
+        PFNGLBUFFERDATAPROC s_BufferData = nullptr;
+        PFNGLBUFFERSUBDATAPROC s_BufferSubData = nullptr;
+        PFNGLTEXIMAGE2DPROC s_TexImage2D = nullptr;
+        PFNGLTEXSUBIMAGE2DPROC s_TexSubImage2D = nullptr;
+
+        PFNGLUNIFORM1IPROC s_Uniform1i = nullptr;
+        PFNGLUNIFORM1FPROC s_Uniform1f = nullptr;
+        PFNGLUNIFORM2FPROC s_Uniform2f = nullptr;
+        PFNGLUNIFORM3FPROC s_Uniform3f = nullptr;
+        PFNGLUNIFORM4FPROC s_Uniform4f = nullptr;
+        PFNGLUNIFORM2FVPROC s_Uniform2fv = nullptr;
+        PFNGLUNIFORM3FVPROC s_Uniform3fv = nullptr;
+        PFNGLUNIFORM4FVPROC s_Uniform4fv = nullptr;
+        PFNGLUNIFORMMATRIX2FVPROC s_UniformMatrix2fv = nullptr;
+        PFNGLUNIFORMMATRIX3FVPROC s_UniformMatrix3fv = nullptr;
+        PFNGLUNIFORMMATRIX4FVPROC s_UniformMatrix4fv = nullptr;
+
+        void APIENTRY DrawArrays(GLenum mode, GLint first, GLsizei count)
+        {
+            ++s_Current.drawCalls;
+            ++s_Current.instancesDrawn;
+            s_DrawArrays(mode, first, count);
+        }
+
+        void APIENTRY DrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices)
+        {
+            ++s_Current.drawCalls;
+            ++s_Current.instancesDrawn;
+            s_DrawElements(mode, count, type, indices);
+        }
+
+        void APIENTRY DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+        {
+            ++s_Current.drawCalls;
+            s_Current.instancesDrawn += instancecount;
+            s_DrawArraysInstanced(mode, first, count, instancecount);
+        }
+
+        void APIENTRY DrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount)
+        {
+            ++s_Current.drawCalls;
+            s_Current.instancesDrawn += instancecount;
+            s_DrawElementsInstanced(mode, count, type, indices, instancecount);
+        }
+
+        void APIENTRY DrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance)
+        {
+            ++s_Current.drawCalls;
+            s_Current.instancesDrawn += instancecount;
+            s_DrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+        }
+
+        void APIENTRY MultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride)
+        {
+            ++s_Current.drawCalls;
+            s_Current.indirectCommands += drawcount;
+            s_MultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+        }
+
+        void APIENTRY Enable(GLenum cap)
+        {
+            ++s_Current.stateChanges;
+            s_Enable(cap);
+        }
+
+        void APIENTRY Disable(GLenum cap)
+        {
+            ++s_Current.stateChanges;
+            s_Disable(cap);
+        }
+
+        void APIENTRY BlendFunc(GLenum sfactor, GLenum dfactor)
+        {
+            ++s_Current.stateChanges;
+            s_BlendFunc(sfactor, dfactor);
+        }
+
+        void APIENTRY DepthFunc(GLenum func)
+        {
+            ++s_Current.stateChanges;
+            s_DepthFunc(func);
+        }
+
+        void APIENTRY DepthMask(GLboolean flag)
+        {
+            ++s_Current.stateChanges;
+            s_DepthMask(flag);
+        }
+
+        void APIENTRY CullFace(GLenum mode)
+        {
+            ++s_Current.stateChanges;
+            s_CullFace(mode);
+        }
+
+        void APIENTRY PolygonMode(GLenum face, GLenum mode)
+        {
+            ++s_Current.stateChanges;
+            s_PolygonMode(face, mode);
+        }
+
+        void APIENTRY Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
+        {
+            ++s_Current.stateChanges;
+            s_Viewport(x, y, width, height);
+        }
+
+        void APIENTRY BindVertexArray(GLuint array)
+        {
+            ++s_Current.stateChanges;
+            s_BindVertexArray(array);
+        }
+
+        void APIENTRY BindBuffer(GLenum target, GLuint buffer)
+        {
+            ++s_Current.stateChanges;
+            s_BindBuffer(target, buffer);
+        }
+
+        void APIENTRY BindBufferBase(GLenum target, GLuint index, GLuint buffer)
+        {
+            ++s_Current.stateChanges;
+            s_BindBufferBase(target, index, buffer);
+        }
+
+        void APIENTRY BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+        {
+            ++s_Current.stateChanges;
+            s_BindBufferRange(target, index, buffer, offset, size);
+        }
+
+        void APIENTRY ActiveTexture(GLenum texture)
+        {
+            ++s_Current.stateChanges;
+            s_ActiveTexture(texture);
+        }
+
+        void APIENTRY BindTexture(GLenum target, GLuint texture)
+        {
+            ++s_Current.stateChanges;
+            ++s_Current.textureBinds;
+            s_BindTexture(target, texture);
+        }
+
+        void APIENTRY UseProgram(GLuint program)
+        {
+            ++s_Current.stateChanges;
+            ++s_Current.shaderBinds;
+            s_UseProgram(program);
+        }
+
+        void APIENTRY BindFramebuffer(GLenum target, GLuint framebuffer)
+        {
+            ++s_Current.stateChanges;
+            ++s_Current.framebufferBinds;
+            s_BindFramebuffer(target, framebuffer);
+        }
+
+        void APIENTRY BufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage)
+        {
+            ++s_Current.bufferUploads;
+            if (data)
+                s_Current.bytesUploaded += static_cast<uint64_t>(size);
+            s_BufferData(target, size, data, usage);
+        }
+
+        void APIENTRY BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
+        {
+            ++s_Current.bufferUploads;
+            s_Current.bytesUploaded += static_cast<uint64_t>(size);
+            s_BufferSubData(target, offset, size, data);
+        }
+
+        void APIENTRY TexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels)
+        {
+            ++s_Current.textureUploads;
+            if (pixels)
+                s_Current.bytesUploaded += static_cast<uint64_t>(width) * height * BytesPerPixel(format, type);
+            s_TexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+        }
+
+        void APIENTRY TexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+        {
+            ++s_Current.textureUploads;
+            s_Current.bytesUploaded += static_cast<uint64_t>(width) * height * BytesPerPixel(format, type);
+            s_TexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+        }
+
+        void APIENTRY Uniform1i(GLint location, GLint v0)
+        {
+            ++s_Current.uniformUploads;
+            s_Uniform1i(location, v0);
+        }
+
+        void APIENTRY Uniform1f(GLint location, GLfloat v0)
+        {
+            ++s_Current.uniformUploads;
+            s_Uniform1f(location, v0);
+        }
+
+        void APIENTRY Uniform2f(GLint location, GLfloat v0, GLfloat v1)
+        {
+            ++s_Current.uniformUploads;
+            s_Uniform2f(location, v0, v1);
+        }
+
+        void APIENTRY Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+        {
+            ++s_Current.uniformUploads;
+            s_Uniform3f(location, v0, v1, v2);
+        }
+
+        void APIENTRY Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+        {
+            ++s_Current.uniformUploads;
+            s_Uniform4f(location, v0, v1, v2, v3);
+        }
+
+        void APIENTRY Uniform2fv(GLint location, GLsizei count, const GLfloat *value)
+        {
+            ++s_Current.uniformUploads;
+            s_Uniform2fv(location, count, value);
+        }
+
+        void APIENTRY Uniform3fv(GLint location, GLsizei count, const GLfloat *value)
+        {
+            ++s_Current.uniformUploads;
+            s_Uniform3fv(location, count, value);
+        }
+
+        void APIENTRY Uniform4fv(GLint location, GLsizei count, const GLfloat *value)
+        {
+            ++s_Current.uniformUploads;
+            s_Uniform4fv(location, count, value);
+        }
+
+        void APIENTRY UniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+        {
+            ++s_Current.uniformUploads;
+            s_UniformMatrix2fv(location, count, transpose, value);
+        }
+
+        void APIENTRY UniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+        {
+            ++s_Current.uniformUploads;
+            s_UniformMatrix3fv(location, count, transpose, value);
+        }
+
+        void APIENTRY UniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+        {
+            ++s_Current.uniformUploads;
+            s_UniformMatrix4fv(location, count, transpose, value);
+        }
+    }
+}
+
+#define AXIS_RECORD_GL(fn, wrapper)          \
+    if (glad_##fn && glad_##fn != &wrapper) \
+    {                                        \
+        Record::s_##wrapper = glad_##fn;     \
+        glad_##fn = &Record::wrapper;        \
+    }
+
+void RenderDeviceStats::Accumulate(const RenderDeviceStats &other)
+{
+    drawCalls += other.drawCalls;
+    instancesDrawn += other.instancesDrawn;
+    indirectCommands += other.indirectCommands;
+    stateChanges += other.stateChanges;
+    shaderBinds += other.shaderBinds;
+    textureBinds += other.textureBinds;
+    framebufferBinds += other.framebufferBinds;
+    uniformUploads += other.uniformUploads;
+    bufferUploads += other.bufferUploads;
+    textureUploads += other.textureUploads;
+    bytesUploaded += other.bytesUploaded;
+}
+
+bool RenderDevice::Init(RenderBackend backend, LoadProc loader)
+{
+    if (s_Initialized)
+    {
+        LOGGER_WARN("RenderDevice") << "Render device already initialized";
+        return true;
+    }
+
+    s_Backend = backend;
+
+    if (backend == RenderBackend::Null)
+        loader = &NullGL::Load;
+
+    if (!loader || !gladLoadGLLoader((GLADloadproc)loader))
+    {
+        LOGGER_ERROR("RenderDevice") << "Failed to load OpenGL entry points";
+        return false;
+    }
+
+    if (backend == RenderBackend::Null)
+        NullGL::FillStubs();
+
+    InstallRecorders();
+
+    s_Initialized = true;
+    ResetStats();
+
+    LOGGER_INFO("RenderDevice") << "Render device initialized (" << (backend == RenderBackend::Null ? "Null" : "OpenGL")
+                                << ", GL " << GLVersion.major << "." << GLVersion.minor << ")";
+    return true;
+}
+
+void RenderDevice::Shutdown()
+{
+    s_Initialized = false;
+    NullGL::s_BufferStore.clear();
+    NullGL::s_BoundBuffers.clear();
+}
+
+void RenderDevice::InstallRecorders()
+{
+    using namespace Record;
+
+    AXIS_RECORD_GL(glDrawArrays, DrawArrays);
+    AXIS_RECORD_GL(glDrawElements, DrawElements);
+    AXIS_RECORD_GL(glDrawArraysInstanced, DrawArraysInstanced);
+    AXIS_RECORD_GL(glDrawElementsInstanced, DrawElementsInstanced);
+    AXIS_RECORD_GL(glDrawElementsInstancedBaseInstance, DrawElementsInstancedBaseInstance);
+    AXIS_RECORD_GL(glMultiDrawElementsIndirect, MultiDrawElementsIndirect);
+
+    AXIS_RECORD_GL(glEnable, Enable);
+    AXIS_RECORD_GL(glDisable, Disable);
+    AXIS_RECORD_GL(glBlendFunc, BlendFunc);
+    AXIS_RECORD_GL(glDepthFunc, DepthFunc);
+    AXIS_RECORD_GL(glDepthMask, DepthMask);
+    AXIS_RECORD_GL(glCullFace, CullFace);
+    AXIS_RECORD_GL(glPolygonMode, PolygonMode);
+    AXIS_RECORD_GL(glViewport, Viewport);
+    AXIS_RECORD_GL(glBindVertexArray, BindVertexArray);
+    AXIS_RECORD_GL(glBindBuffer, BindBuffer);
+    AXIS_RECORD_GL(glBindBufferBase, BindBufferBase);
+    AXIS_RECORD_GL(glBindBufferRange, BindBufferRange);
+    AXIS_RECORD_GL(glActiveTexture, ActiveTexture);
+    AXIS_RECORD_GL(glBindTexture, BindTexture);
+    AXIS_RECORD_GL(glUseProgram, UseProgram);
+    AXIS_RECORD_GL(glBindFramebuffer, BindFramebuffer);
+
+    AXIS_RECORD_GL(glBufferData, BufferData);
+    AXIS_RECORD_GL(glBufferSubData, BufferSubData);
+    AXIS_RECORD_GL(glTexImage2D, TexImage2D);
+    AXIS_RECORD_GL(glTexSubImage2D, TexSubImage2D);
+
+    AXIS_RECORD_GL(glUniform1i, Uniform1i);
+    AXIS_RECORD_GL(glUniform1f, Uniform1f);
+    AXIS_RECORD_GL(glUniform2f, Uniform2f);
+    AXIS_RECORD_GL(glUniform3f, Uniform3f);
+    AXIS_RECORD_GL(glUniform4f, Uniform4f);
+    AXIS_RECORD_GL(glUniform2fv, Uniform2fv);
+    AXIS_RECORD_GL(glUniform3fv, Uniform3fv);
+    AXIS_RECORD_GL(glUniform4fv, Uniform4fv);
+    AXIS_RECORD_GL(glUniformMatrix2fv, UniformMatrix2fv);
+    AXIS_RECORD_GL(glUniformMatrix3fv, UniformMatrix3fv);
+    AXIS_RECORD_GL(glUniformMatrix4fv, UniformMatrix4fv);
+}
+
+RenderBackend RenderDevice::GetBackend()
+{
+    return s_Backend;
+}
+
+bool RenderDevice::IsHeadless()
+{
+    return s_Backend == RenderBackend::Null;
+}
+
+bool RenderDevice::IsInitialized()
+{
+    return s_Initialized;
+}
+
+void RenderDevice::RecordMappedWrite(uint64_t bytes)
+{
+    ++s_Current.bufferUploads;
+    s_Current.bytesUploaded += bytes;
+}
+
+void RenderDevice::EndFrame()
+{
+    s_LastFrame = s_Current;
+    s_Total.Accumulate(s_Current);
+    s_Current.Reset();
+    ++s_FrameCount;
+}
+
+const RenderDeviceStats &RenderDevice::GetCurrentStats()
+{
+    return s_Current;
+}
+
+const RenderDeviceStats &RenderDevice::GetFrameStats()
+{
+    return s_LastFrame;
+}
+
+const RenderDeviceStats &RenderDevice::GetTotalStats()
+{
+    return s_Total;
+}
+
+uint64_t RenderDevice::GetFrameCount()
+{
+    return s_FrameCount;
+}
+
+void RenderDevice::ResetStats()
+{
+    s_Current.Reset();
+    s_LastFrame.Reset();
+    s_Total.Reset();
+    s_FrameCount = 0;
+}
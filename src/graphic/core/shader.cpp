@@ -89,6 +89,7 @@ void Shader::load(const char* vertexPath, const char* fragmentPath, const char*
         
     glLinkProgram(ID);
     checkCompileErrors(ID, "PROGRAM");
+    bindUniformBlocks();
 
     glDeleteShader(vertex);
     glDeleteShader(fragment);
@@ -173,6 +174,72 @@ int Shader::GetUniformLocation(const std::string &name) const
     return location;
 }
 
+void Shader::setBool(UniformHandle handle, bool value) const
+{
+    glUniform1i(GetUniformLocation(handle), (int)value);
+}
+
+void Shader::setInt(UniformHandle handle, int value) const
+{
+    glUniform1i(GetUniformLocation(handle), value);
+}
+
+void Shader::setFloat(UniformHandle handle, float value) const
+{
+    glUniform1f(GetUniformLocation(handle), value);
+}
+
+void Shader::setVec2(UniformHandle handle, const glm::vec2 &value) const
+{
+    glUniform2fv(GetUniformLocation(handle), 1, &value[0]);
+}
+
+void Shader::setVec3(UniformHandle handle, const glm::vec3 &value) const
+{
+    glUniform3fv(GetUniformLocation(handle), 1, &value[0]);
+}
+
+void Shader::setVec4(UniformHandle handle, const glm::vec4 &value) const
+{
+    glUniform4fv(GetUniformLocation(handle), 1, &value[0]);
+}
+
+void Shader::setMat4(UniformHandle handle, const glm::mat4 &mat) const
+{
+    glUniformMatrix4fv(GetUniformLocation(handle), 1, GL_FALSE, &mat[0][0]);
+}
+
+void Shader::setMat4Array(UniformHandle handle, const glm::mat4 *mats, int count) const
+{
+    if (count > 0)
+        glUniformMatrix4fv(GetUniformLocation(handle), count, GL_FALSE, &mats[0][0][0]);
+}
+
+int Shader::GetUniformLocation(UniformHandle handle) const
+{
+    auto it = handleLocations.find(handle.GetHash());
+    if (it != handleLocations.end())
+        return it->second;
+
+    int location = glGetUniformLocation(ID, handle.GetName());
+    handleLocations.emplace(handle.GetHash(), location);
+    return location;
+}
+
+void Shader::bindUniformBlocks()
+{
+    uniformBlocks = 0;
+    for (uint32_t block = 0; block < static_cast<uint32_t>(UniformBlock::Count); ++block)
+    {
+        GLuint index = glGetUniformBlockIndex(ID, UNIFORM_BLOCK_NAMES[block]);
+        if (index == GL_INVALID_INDEX)
+            continue;
+
+        glUniformBlockBinding(ID, index, block);
+        uniformBlocks |= 1u << block;
+    }
+}
+
 void Shader::checkCompileErrors(GLuint shader, std::string type)
 {
     GLint success;
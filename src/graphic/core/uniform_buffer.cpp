@@ -0,0 +1,54 @@
+#include <graphic/core/uniform_buffer.h>
+#include <algorithm>
+
+UniformBuffer::~UniformBuffer()
+{
+    Shutdown();
+}
+
+void UniformBuffer::Init(size_t size, UniformBlock binding)
+{
+    if (m_Buffer)
+        return;
+
+    m_Size = size;
+    m_Binding = binding;
+
+    glGenBuffers(1, &m_Buffer);
+    glBindBuffer(GL_UNIFORM_BUFFER, m_Buffer);
+    glBufferData(GL_UNIFORM_BUFFER, static_cast<GLsizeiptr>(m_Size), nullptr, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    glBindBufferBase(GL_UNIFORM_BUFFER, static_cast<GLuint>(m_Binding), m_Buffer);
+}
+
+void UniformBuffer::Shutdown()
+{
+    if (m_Buffer)
+        glDeleteBuffers(1, &m_Buffer);
+    m_Buffer = 0;
+    m_Size = 0;
+}
+
+void UniformBuffer::Upload(const void *data, size_t size)
+{
+    if (!m_Buffer)
+        return;
+
+    glBindBuffer(GL_UNIFORM_BUFFER, m_Buffer);
+    glBufferData(GL_UNIFORM_BUFFER, static_cast<GLsizeiptr>(m_Size), nullptr, GL_DYNAMIC_DRAW);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, static_cast<GLsizeiptr>((std::min)(size, m_Size)), data);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    glBindBufferBase(GL_UNIFORM_BUFFER, static_cast<GLuint>(m_Binding), m_Buffer);
+}
+
+size_t UniformBuffer::GetOffsetAlignment()
+{
+    static GLint alignment = 0;
+    if (alignment <= 0)
+    {
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+        if (alignment <= 0)
+            alignment = 256;
+    }
+    return static_cast<size_t>(alignment);
+}
@@ -11,37 +11,79 @@ Animation::Animation(const std::string &animationPath, Model *model)
 {
     Assimp::Importer importer;
     const aiScene *scene = importer.ReadFile(animationPath, aiProcess_Triangulate);
+    Load(scene, model->GetBoneInfoMap(), model->GetBoneCount());
+}
+
+Animation::Animation(const aiScene *scene, std::unordered_map<std::string, BoneInfo> &boneInfoMap, int &boneCount)
+{
+    Load(scene, boneInfoMap, boneCount);
+}
+
+void Animation::Load(const aiScene *scene, std::unordered_map<std::string, BoneInfo> &boneInfoMap, int &boneCount)
+{
     assert(scene && scene->mRootNode);
     auto animation = scene->mAnimations[0];
     m_Duration = animation->mDuration;
     m_TicksPerSecond = animation->mTicksPerSecond;
-    aiMatrix4x4 globalTransformation = scene->mRootNode->mTransformation;
-    globalTransformation = globalTransformation.Inverse();
 
     ReadHierarchyData(m_RootNode, scene->mRootNode);
-    ReadMissingBones(animation, *model);
+    ReadMissingBones(animation, boneInfoMap, boneCount);
 
     BindNodesToBones(m_RootNode);
+
+    m_Skeleton.clear();
+    m_NodeNames.clear();
+    FlattenHierarchy(m_RootNode, -1, 0);
 }
 
 Animation::~Animation()
 {
 }
 
-Bone *Animation::FindBone(const std::string &name)
+const Bone *Animation::FindBone(const std::string &name) const
 {
-    if (m_BoneMap.find(name) != m_BoneMap.end()) {
-        return m_BoneMap[name];
-    }
-    return nullptr;
+    int channel = FindChannel(name);
+    return channel >= 0 ? &m_Bones[channel] : nullptr;
 }
 
-void Animation::ReadMissingBones(const aiAnimation *animation, Model &model)
+int Animation::FindChannel(const std::string &name) const
 {
-    int size = animation->mNumChannels;
+    auto iter = m_BoneMap.find(name);
+    return iter != m_BoneMap.end() ? iter->second : -1;
+}
+
+void Animation::BuildChannelRemap(const Animation &target, std::vector<int> &remap) const
+{
+    remap.resize(m_Skeleton.size());
+    for (size_t i = 0; i < m_Skeleton.size(); ++i)
+        remap[i] = target.FindChannel(m_NodeNames[i]);
+}
 
-    std::unordered_map<std::string, BoneInfo> &boneInfoMap = model.GetBoneInfoMap(); 
-    int &boneCount = model.GetBoneCount();      
+void Animation::Compress(const ClipCompressionSettings &settings)
+{
+    if (m_Compressed)
+        return;
+
+    // Key times become 16-bit fractions of the clip
+    float timeScale = m_Duration > 0.0f ? ClipCompression::TIME_STEPS / m_Duration : 0.0f;
+
+    m_CompressionReport = ClipCompressionReport();
+    for (Bone &bone : m_Bones)
+        bone.Compress(settings, timeScale, m_CompressionReport);
+    m_Compressed = true;
+}
+
+size_t Animation::GetMemoryBytes() const
+{
+    size_t bytes = 0;
+    for (const Bone &bone : m_Bones)
+        bytes += bone.GetMemoryBytes();
+    return bytes;
+}
+
+void Animation::ReadMissingBones(const aiAnimation *animation, std::unordered_map<std::string, BoneInfo> &boneInfoMap, int &boneCount)
+{
+    int size = animation->mNumChannels;
 
     m_Bones.reserve(size); 
 
@@ -63,8 +105,8 @@ void Animation::ReadMissingBones(const aiAnimation *animation, Model &model)
     m_BoneInfoMap = boneInfoMap;
 
     m_BoneMap.clear();
-    for (auto& bone : m_Bones) {
-        m_BoneMap[bone.GetBoneName()] = &bone;
+    for (int i = 0; i < static_cast<int>(m_Bones.size()); ++i) {
+        m_BoneMap[m_Bones[i].GetBoneName()] = i;
     }
 }
 
@@ -86,12 +128,34 @@ void Animation::ReadHierarchyData(AssimpNodeData &dest, const aiNode *src)
 
 void Animation::BindNodesToBones(AssimpNodeData& node)
 {
-    auto iter = m_BoneMap.find(node.name);
-    if (iter != m_BoneMap.end()) {
-        node.cachedBone = iter->second;
-    }
+    node.channel = FindChannel(node.name);
 
     for (auto& child : node.children) {
         BindNodesToBones(child);
     }
 }
+
+void Animation::FlattenHierarchy(const AssimpNodeData &node, int parent, int depth)
+{
+    int index = static_cast<int>(m_Skeleton.size());
+
+    SkeletonNode flat;
+    flat.transformation = node.transformation;
+    flat.offset = glm::mat4(1.0f);
+    flat.parent = parent;
+    flat.channel = node.channel;
+    flat.depth = depth;
+
+    auto it = m_BoneInfoMap.find(node.name);
+    if (it != m_BoneInfoMap.end())
+    {
+        flat.boneId = it->second.id;
+        flat.offset = it->second.offset;
+    }
+
+    m_Skeleton.push_back(flat);
+    m_NodeNames.push_back(node.name);
+
+    for (const auto &child : node.children)
+        FlattenHierarchy(child, index, depth + 1);
+}
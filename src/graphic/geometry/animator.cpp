@@ -6,7 +6,7 @@
 
 #include <graphic/geometry/bone.h>
 
-Animator::Animator(Animation *animation)
+Animator::Animator(const Animation *animation)
 {
     m_CurrentTime = 0.0;
     m_CurrentAnimation = animation;
@@ -53,6 +53,7 @@ void Animator::UpdateAnimation(float dt)
             {
                 m_CurrentAnimation = m_NextAnimation;
                 m_CurrentTime = m_NextTime;
+                std::swap(m_Cursors, m_NextCursors);
 
                 m_NextAnimation = nullptr;
                 m_BlendFactor = 0.0f;
@@ -69,11 +70,17 @@ void Animator::UpdateAnimation(float dt)
             m_TimeSinceLastUpdate = fmod(m_TimeSinceLastUpdate, timePerFrame);
         }
 
-        CalculateBoneTransform(&m_CurrentAnimation->GetRootNode(), glm::mat4(1.0f));
+        // Cursors are only search hints, so resizing after a clip switch is enough
+        if (m_Cursors.size() < m_CurrentAnimation->GetBoneCount())
+            m_Cursors.resize(m_CurrentAnimation->GetBoneCount());
+        if (m_NextAnimation && m_NextCursors.size() < m_NextAnimation->GetBoneCount())
+            m_NextCursors.resize(m_NextAnimation->GetBoneCount());
+
+        EvaluatePose();
     }
 }
 
-void Animator::AddAnimation(const std::string &name, Animation *animation)
+void Animator::AddAnimation(const std::string &name, const Animation *animation)
 {
     if (animation)
     {
@@ -81,7 +88,7 @@ void Animator::AddAnimation(const std::string &name, Animation *animation)
     }
 }
 
-void Animator::PlayAnimation(Animation *pAnimation)
+void Animator::PlayAnimation(const Animation *pAnimation)
 {
     m_CurrentAnimation = pAnimation;
     m_CurrentTime = 0.0f;
@@ -91,7 +98,7 @@ void Animator::PlayAnimation(const std::string &name)
 {
     if (m_AnimationsMap.find(name) != m_AnimationsMap.end())
     {
-        Animation *targetAnim = m_AnimationsMap[name];
+        const Animation *targetAnim = m_AnimationsMap[name];
 
         if (m_CurrentAnimation != targetAnim)
         {
@@ -113,7 +120,7 @@ void Animator::CrossFade(const std::string &name, float transitionDuration)
         return;
     }
 
-    Animation *target = m_AnimationsMap[name];
+    const Animation *target = m_AnimationsMap[name];
     if (target == m_CurrentAnimation && !m_IsCrossFading)
         return;
     if (target == m_NextAnimation && m_IsCrossFading)
@@ -141,30 +148,40 @@ void Animator::PlayBlend(const std::string &nameA, const std::string &nameB, flo
     }
 }
 
-void Animator::CalculateBoneTransform(const AssimpNodeData *node, glm::mat4 parentTransform)
+void Animator::EvaluatePose()
 {
-    std::string nodeName = node->name;
-    glm::mat4 nodeTransform = node->transformation;
+    const std::vector<SkeletonNode> &skeleton = m_CurrentAnimation->GetSkeleton();
+    const size_t nodeCount = skeleton.size();
 
-    Bone *boneA = node->cachedBone;
+    const bool blending = m_NextAnimation && (m_BlendFactor > 0.001f);
+    if (blending && (m_RemapFrom != m_CurrentAnimation || m_RemapTo != m_NextAnimation))
+    {
+        m_CurrentAnimation->BuildChannelRemap(*m_NextAnimation, m_NextRemap);
+        m_RemapFrom = m_CurrentAnimation;
+        m_RemapTo = m_NextAnimation;
+    }
 
-    if (boneA)
+    if (m_GlobalTransforms.size() < nodeCount)
+        m_GlobalTransforms.resize(nodeCount);
+
+    const size_t paletteSize = m_FinalBoneMatrices.size();
+    for (size_t i = 0; i < nodeCount; ++i)
     {
-        boneA->Update(m_CurrentTime);
+        const SkeletonNode &node = skeleton[i];
+        glm::mat4 nodeTransform = node.transformation;
 
-        if (m_NextAnimation && (m_BlendFactor > 0.001f))
+        if (node.channel >= 0 && (m_MaxSampledDepth < 0 || node.depth <= m_MaxSampledDepth))
         {
-            Bone *boneB = m_NextAnimation->FindBone(nodeName);
+            const Bone &boneA = m_CurrentAnimation->GetBone(node.channel);
+            BoneCursor &cursorA = m_Cursors[node.channel];
 
-            if (boneB)
+            int channelB = blending ? m_NextRemap[i] : -1;
+            if (channelB >= 0)
             {
-                glm::vec3 posA = boneA->GetPosition(m_CurrentTime);
-                glm::quat rotA = boneA->GetRotation(m_CurrentTime);
-                glm::vec3 scaleA = boneA->GetScale(m_CurrentTime);
-
-                glm::vec3 posB = boneB->GetPosition(m_NextTime);
-                glm::quat rotB = boneB->GetRotation(m_NextTime);
-                glm::vec3 scaleB = boneB->GetScale(m_NextTime);
+                glm::vec3 posA, posB, scaleA, scaleB;
+                glm::quat rotA, rotB;
+                boneA.Sample(m_CurrentTime, cursorA, posA, rotA, scaleA, m_RotationInterpolation);
+                m_NextAnimation->GetBone(channelB).Sample(m_NextTime, m_NextCursors[channelB], posB, rotB, scaleB, m_RotationInterpolation);
 
                 glm::vec3 pos = glm::mix(posA, posB, m_BlendFactor);
                 glm::quat rot = glm::slerp(rotA, rotB, m_BlendFactor);
@@ -174,36 +191,15 @@ void Animator::CalculateBoneTransform(const AssimpNodeData *node, glm::mat4 pare
             }
             else
             {
-                nodeTransform = boneA->GetLocalTransform();
+                nodeTransform = boneA.SampleLocalTransform(m_CurrentTime, cursorA, m_RotationInterpolation);
             }
         }
-        else
-        {
-            nodeTransform = boneA->GetLocalTransform();
-        }
-    }
-
-    glm::mat4 globalTransformation = parentTransform * nodeTransform;
 
-    const auto &boneInfoMap = m_CurrentAnimation->GetBoneIDMap();
-    auto it = boneInfoMap.find(nodeName);
+        // Parents precede their children, so the parent's global transform is already final
+        glm::mat4 &global = m_GlobalTransforms[i];
+        global = node.parent >= 0 ? m_GlobalTransforms[node.parent] * nodeTransform : nodeTransform;
 
-    if (it != boneInfoMap.end())
-    {
-        int index = it->second.id;
-        glm::mat4 offset = it->second.offset;
-
-        if (index < m_FinalBoneMatrices.size())
-        {
-            m_FinalBoneMatrices[index] = globalTransformation * offset;
-        }
+        if (node.boneId >= 0 && static_cast<size_t>(node.boneId) < paletteSize)
+            m_FinalBoneMatrices[node.boneId] = global * node.offset;
     }
-
-    for (int i = 0; i < node->childrenCount; i++)
-        CalculateBoneTransform(&node->children[i], globalTransformation);
-}
-
-std::vector<glm::mat4> Animator::GetFinalBoneMatrices()
-{
-    return m_FinalBoneMatrices;
 }
@@ -0,0 +1,128 @@
+#include <graphic/geometry/baked_animation.h>
+#include <graphic/geometry/animation.h>
+#include <graphic/geometry/animator.h>
+#include <utils/logger.h>
+
+#include <algorithm>
+#include <cmath>
+
+BakedAnimation::BakedAnimation(int boneCount)
+    : m_BoneCount((std::max)(boneCount, 1))
+{
+}
+
+BakedAnimation::~BakedAnimation()
+{
+    Shutdown();
+}
+
+int BakedAnimation::AddClip(const std::string &name, const Animation &clip, float framesPerSecond)
+{
+    float ticksPerSecond = clip.GetTicksPerSecond() > 0.0f ? clip.GetTicksPerSecond() : 25.0f;
+    framesPerSecond = (std::max)(framesPerSecond, 1.0f);
+
+    BakedClip baked;
+    baked.name = name;
+    baked.firstFrame = m_FrameCount;
+    baked.duration = (std::max)(clip.GetDuration() / ticksPerSecond, 0.0f);
+    baked.framesPerSecond = framesPerSecond;
+    baked.frameCount = (std::max)(1u, static_cast<uint32_t>(std::ceil(baked.duration * framesPerSecond)));
+
+    // The Animator does the sampling, so baked poses match the CPU path exactly
+    Animator animator(&clip);
+    m_Matrices.resize(static_cast<size_t>(m_FrameCount + baked.frameCount) * m_BoneCount, glm::mat4(1.0f));
+    for (uint32_t frame = 0; frame < baked.frameCount; ++frame)
+    {
+        animator.SetTime(frame / framesPerSecond * ticksPerSecond);
+        animator.UpdateAnimation(0.0f);
+
+        const std::vector<glm::mat4> &palette = animator.GetFinalBoneMatrices();
+        size_t count = (std::min)(palette.size(), static_cast<size_t>(m_BoneCount));
+        std::copy_n(palette.begin(), count, m_Matrices.begin() + static_cast<size_t>(baked.firstFrame + frame) * m_BoneCount);
+    }
+
+    m_FrameCount += baked.frameCount;
+    m_Clips.push_back(baked);
+    m_Dirty = true;
+
+    LOGGER_INFO("BakedAnimation") << "Baked " << name << ": " << baked.frameCount << " frames x " << m_BoneCount
+                                  << " bones (" << (baked.frameCount * m_BoneCount * sizeof(glm::mat4)) / 1024 << " KB)";
+    return static_cast<int>(m_Clips.size()) - 1;
+}
+
+int BakedAnimation::FindClip(const std::string &name) const
+{
+    for (size_t i = 0; i < m_Clips.size(); ++i)
+    {
+        if (m_Clips[i].name == name)
+            return static_cast<int>(i);
+    }
+    return -1;
+}
+
+float BakedAnimation::WrapTime(int clip, float time) const
+{
+    float duration = m_Clips[clip].duration;
+    if (duration <= 0.0f)
+        return 0.0f;
+    time = std::fmod(time, duration);
+    return time < 0.0f ? time + duration : time;
+}
+
+float BakedAnimation::FramePosition(int clip, float time) const
+{
+    const BakedClip &baked = m_Clips[clip];
+    float position = WrapTime(clip, time) * baked.framesPerSecond;
+    return (std::min)(position, static_cast<float>(baked.frameCount) - 0.001f);
+}
+
+glm::mat4 BakedAnimation::PackInstance(const glm::mat4 &world, int clip, float time) const
+{
+    // Affine world matrices always end in (0, 0, 0, 1); the shader restores the zeros
+    const BakedClip &baked = m_Clips[clip];
+    glm::mat4 packed = world;
+    packed[0][3] = FramePosition(clip, time);
+    packed[1][3] = static_cast<float>(baked.firstFrame);
+    packed[2][3] = static_cast<float>(baked.frameCount);
+    return packed;
+}
+
+const glm::mat4 *BakedAnimation::GetPalette(int clip, float time) const
+{
+    const BakedClip &baked = m_Clips[clip];
+    uint32_t frame = static_cast<uint32_t>(FramePosition(clip, time) + 0.5f) % baked.frameCount;
+    return m_Matrices.data() + static_cast<size_t>(baked.firstFrame + frame) * m_BoneCount;
+}
+
+void BakedAnimation::Bind(int unit)
+{
+    if (m_Dirty)
+    {
+        GLint maxSize = 0;
+        glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxSize);
+        if (maxSize > 0 && (m_FrameCount > static_cast<uint32_t>(maxSize) || m_BoneCount * 4 > maxSize))
+            LOGGER_WARN("BakedAnimation") << m_FrameCount << " frames exceed GL_MAX_TEXTURE_SIZE " << maxSize << "; lower the bake rate";
+
+        if (!m_Texture)
+            glGenTextures(1, &m_Texture);
+        glBindTexture(GL_TEXTURE_2D, m_Texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA32F, m_BoneCount * 4, static_cast<GLsizei>(m_FrameCount), 0, GL_RGBA, GL_FLOAT, m_Matrices.data());
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        m_Dirty = false;
+    }
+
+    glActiveTexture(GL_TEXTURE0 + unit);
+    glBindTexture(GL_TEXTURE_2D, m_Texture);
+    glActiveTexture(GL_TEXTURE0);
+}
+
+void BakedAnimation::Shutdown()
+{
+    if (m_Texture)
+        glDeleteTextures(1, &m_Texture);
+    m_Texture = 0;
+    m_Dirty = !m_Matrices.empty();
+}
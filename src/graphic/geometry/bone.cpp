@@ -1,162 +1,211 @@
 #include <graphic/geometry/bone.h>
 
-#include <list>
+#include <algorithm>
 
 #include <utils/assimp_glm_helpers.h>
 
+namespace
+{
+    using ClipCompression::FindSegment;
+    using ClipCompression::SegmentFactor;
+
+    glm::vec3 SamplePacked(const CompressedVec3Track &track, float time, uint32_t &cursor, const glm::vec3 &fallback)
+    {
+        if (track.times.empty())
+            return fallback;
+        if (track.times.size() == 1)
+            return track.offset + glm::vec3(track.values[0], track.values[1], track.values[2]) * track.step;
+
+        uint32_t index = FindSegment(track.times, time, cursor);
+        return ClipCompression::SampleVec3(track, index, SegmentFactor(track.times, index, time));
+    }
+
+    template <typename T>
+    void ReleaseKeys(std::vector<T> &keys)
+    {
+        std::vector<T>().swap(keys);
+    }
+}
+
 Bone::Bone(const std::string &name, int ID, const aiNodeAnim *channel)
     : m_Name(name),
-      m_ID(ID),
-      m_LocalTransform(1.0f)
+      m_ID(ID)
 {
-    m_NumPositions = channel->mNumPositionKeys;
-
-    for (int positionIndex = 0; positionIndex < m_NumPositions; ++positionIndex)
+    m_PositionTimes.reserve(channel->mNumPositionKeys);
+    m_Positions.reserve(channel->mNumPositionKeys);
+    for (unsigned int i = 0; i < channel->mNumPositionKeys; ++i)
     {
-        aiVector3D aiPosition = channel->mPositionKeys[positionIndex].mValue;
-        float timeStamp = channel->mPositionKeys[positionIndex].mTime;
-        KeyPosition data;
-        data.position = AssimpGLMHelpers::GetGLMVec(aiPosition);
-        data.timeStamp = timeStamp;
-        m_Positions.push_back(data);
+        m_PositionTimes.push_back(static_cast<float>(channel->mPositionKeys[i].mTime));
+        m_Positions.push_back(AssimpGLMHelpers::GetGLMVec(channel->mPositionKeys[i].mValue));
     }
 
-    m_NumRotations = channel->mNumRotationKeys;
-    for (int rotationIndex = 0; rotationIndex < m_NumRotations; ++rotationIndex)
+    m_RotationTimes.reserve(channel->mNumRotationKeys);
+    m_Rotations.reserve(channel->mNumRotationKeys);
+    for (unsigned int i = 0; i < channel->mNumRotationKeys; ++i)
     {
-        aiQuaternion aiOrientation = channel->mRotationKeys[rotationIndex].mValue;
-        float timeStamp = channel->mRotationKeys[rotationIndex].mTime;
-        KeyRotation data;
-        data.orientation = AssimpGLMHelpers::GetGLMQuat(aiOrientation);
-        data.timeStamp = timeStamp;
-        m_Rotations.push_back(data);
+        m_RotationTimes.push_back(static_cast<float>(channel->mRotationKeys[i].mTime));
+        m_Rotations.push_back(AssimpGLMHelpers::GetGLMQuat(channel->mRotationKeys[i].mValue));
     }
 
-    m_NumScalings = channel->mNumScalingKeys;
-    for (int keyIndex = 0; keyIndex < m_NumScalings; ++keyIndex)
+    m_ScaleTimes.reserve(channel->mNumScalingKeys);
+    m_Scales.reserve(channel->mNumScalingKeys);
+    for (unsigned int i = 0; i < channel->mNumScalingKeys; ++i)
     {
-        aiVector3D scale = channel->mScalingKeys[keyIndex].mValue;
-        float timeStamp = channel->mScalingKeys[keyIndex].mTime;
-        KeyScale data;
-        data.scale = AssimpGLMHelpers::GetGLMVec(scale);
-        data.timeStamp = timeStamp;
-        m_Scales.push_back(data);
+        m_ScaleTimes.push_back(static_cast<float>(channel->mScalingKeys[i].mTime));
+        m_Scales.push_back(AssimpGLMHelpers::GetGLMVec(channel->mScalingKeys[i].mValue));
     }
 }
 
-glm::vec3 Bone::GetPosition(float animationTime) { return InterpolatePosition(animationTime); }
-glm::quat Bone::GetRotation(float animationTime) { return InterpolateRotation(animationTime); }
-glm::vec3 Bone::GetScale(float animationTime) { return InterpolateScaling(animationTime); }
-
-void Bone::Update(float animationTime)
+void Bone::Sample(float animationTime, BoneCursor &cursor, glm::vec3 &position, glm::quat &rotation, glm::vec3 &scale,
+                  RotationInterpolation rotationMode) const
 {
-    glm::mat4 translation = glm::translate(glm::mat4(1.0f), InterpolatePosition(animationTime));
-    glm::mat4 rotation = glm::toMat4(glm::normalize(InterpolateRotation(animationTime)));
-    glm::mat4 scale = glm::scale(glm::mat4(1.0f), InterpolateScaling(animationTime));
-    m_LocalTransform = translation * rotation * scale;
+    position = InterpolatePosition(animationTime, cursor.position);
+    rotation = InterpolateRotation(animationTime, cursor.rotation, rotationMode);
+    scale = InterpolateScaling(animationTime, cursor.scale);
 }
 
-glm::mat4 Bone::GetLocalTransform() { return m_LocalTransform; }
-std::string Bone::GetBoneName() const { return m_Name; }
-int Bone::GetBoneID() { return m_ID; }
+glm::mat4 Bone::SampleLocalTransform(float animationTime, BoneCursor &cursor, RotationInterpolation rotationMode) const
+{
+    glm::mat4 translation = glm::translate(glm::mat4(1.0f), InterpolatePosition(animationTime, cursor.position));
+    glm::mat4 rotation = glm::toMat4(InterpolateRotation(animationTime, cursor.rotation, rotationMode));
+    glm::mat4 scale = glm::scale(glm::mat4(1.0f), InterpolateScaling(animationTime, cursor.scale));
+    return translation * rotation * scale;
+}
 
-int Bone::GetPositionIndex(float animationTime)
+glm::vec3 Bone::GetPosition(float animationTime) const
 {
-    if (m_LastPositionIndex >= m_NumPositions - 1 || animationTime < m_Positions[m_LastPositionIndex].timeStamp)
-    {
-        m_LastPositionIndex = 0;
-    }
+    uint32_t cursor = 0;
+    return InterpolatePosition(animationTime, cursor);
+}
 
-    for (int index = m_LastPositionIndex; index < m_NumPositions - 1; ++index)
-    {
-        if (animationTime < m_Positions[index + 1].timeStamp)
-        {
-            m_LastPositionIndex = index;
-            return index;
-        }
-    }
-    return 0;
+glm::quat Bone::GetRotation(float animationTime) const
+{
+    uint32_t cursor = 0;
+    return InterpolateRotation(animationTime, cursor, RotationInterpolation::Slerp);
 }
 
-int Bone::GetRotationIndex(float animationTime)
+glm::vec3 Bone::GetScale(float animationTime) const
 {
-    if (m_LastRotationIndex >= m_NumRotations - 1 || animationTime < m_Rotations[m_LastRotationIndex].timeStamp)
-    {
-        m_LastRotationIndex = 0;
-    }
+    uint32_t cursor = 0;
+    return InterpolateScaling(animationTime, cursor);
+}
 
-    for (int index = m_LastRotationIndex; index < m_NumRotations - 1; ++index)
-    {
-        if (animationTime < m_Rotations[index + 1].timeStamp)
-        {
-            m_LastRotationIndex = index;
-            return index;
-        }
-    }
-    return 0;
+glm::vec3 Bone::InterpolatePosition(float animationTime, uint32_t &cursor) const
+{
+    if (m_Compressed)
+        return SamplePacked(m_PackedPositions, animationTime * m_TimeScale, cursor, glm::vec3(0.0f));
+    if (m_Positions.empty())
+        return glm::vec3(0.0f);
+    if (m_Positions.size() == 1)
+        return m_Positions[0];
+
+    uint32_t index = FindSegment(m_PositionTimes, animationTime, cursor);
+    float factor = SegmentFactor(m_PositionTimes, index, animationTime);
+    return glm::mix(m_Positions[index], m_Positions[index + 1], factor);
 }
 
-int Bone::GetScaleIndex(float animationTime)
+glm::quat Bone::InterpolateRotation(float animationTime, uint32_t &cursor, RotationInterpolation mode) const
 {
-    if (m_LastScaleIndex >= m_NumScalings - 1 || animationTime < m_Scales[m_LastScaleIndex].timeStamp)
+    glm::quat start, end;
+    float factor = 0.0f;
+
+    if (m_Compressed)
+    {
+        const std::vector<uint16_t> &times = m_PackedRotations.times;
+        if (times.empty())
+            return glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+        if (times.size() == 1)
+            return glm::normalize(ClipCompression::DecodeQuat(m_PackedRotations.values.data()));
+
+        float time = animationTime * m_TimeScale;
+        uint32_t index = FindSegment(times, time, cursor);
+        factor = SegmentFactor(times, index, time);
+        ClipCompression::DecodeQuatPair(m_PackedRotations, index, start, end);
+    }
+    else
     {
-        m_LastScaleIndex = 0;
+        if (m_Rotations.empty())
+            return glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+        if (m_Rotations.size() == 1)
+            return glm::normalize(m_Rotations[0]);
+
+        uint32_t index = FindSegment(m_RotationTimes, animationTime, cursor);
+        factor = SegmentFactor(m_RotationTimes, index, animationTime);
+        start = m_Rotations[index];
+        end = m_Rotations[index + 1];
     }
 
-    for (int index = m_LastScaleIndex; index < m_NumScalings - 1; ++index)
+    if (mode == RotationInterpolation::Nlerp)
     {
-        if (animationTime < m_Scales[index + 1].timeStamp)
-        {
-            m_LastScaleIndex = index;
-            return index;
-        }
+        // Shortest arc, as slerp would take
+        if (glm::dot(start, end) < 0.0f)
+            end = -end;
+        return glm::normalize(start * (1.0f - factor) + end * factor);
     }
-    return 0;
+    return glm::normalize(glm::slerp(start, end, factor));
 }
 
-float Bone::GetScaleFactor(float lastTimeStamp, float nextTimeStamp, float animationTime)
+glm::vec3 Bone::InterpolateScaling(float animationTime, uint32_t &cursor) const
 {
-    float scaleFactor = 0.0f;
-    float midWayLength = animationTime - lastTimeStamp;
-    float framesDiff = nextTimeStamp - lastTimeStamp;
-    scaleFactor = midWayLength / framesDiff;
-    return scaleFactor;
+    if (m_Compressed)
+        return SamplePacked(m_PackedScales, animationTime * m_TimeScale, cursor, glm::vec3(1.0f));
+    if (m_Scales.empty())
+        return glm::vec3(1.0f);
+    if (m_Scales.size() == 1)
+        return m_Scales[0];
+
+    uint32_t index = FindSegment(m_ScaleTimes, animationTime, cursor);
+    float factor = SegmentFactor(m_ScaleTimes, index, animationTime);
+    return glm::mix(m_Scales[index], m_Scales[index + 1], factor);
 }
 
-glm::vec3 Bone::InterpolatePosition(float animationTime)
+void Bone::Compress(const ClipCompressionSettings &settings, float timeScale, ClipCompressionReport &report)
 {
-    if (1 == m_NumPositions)
-        return m_Positions[0].position;
-
-    int p0Index = GetPositionIndex(animationTime);
-    int p1Index = p0Index + 1;
-    float scaleFactor = GetScaleFactor(m_Positions[p0Index].timeStamp,
-                                       m_Positions[p1Index].timeStamp, animationTime);
-    return glm::mix(m_Positions[p0Index].position, m_Positions[p1Index].position, scaleFactor);
+    if (m_Compressed)
+        return;
+
+    report.rawBytes += GetMemoryBytes();
+    report.rawKeys += m_Positions.size() + m_Rotations.size() + m_Scales.size();
+
+    std::vector<uint32_t> positionKeys = ClipCompression::ReduceVec3Keys(m_PositionTimes, m_Positions, settings.positionTolerance);
+    std::vector<uint32_t> rotationKeys = ClipCompression::ReduceQuatKeys(m_RotationTimes, m_Rotations, settings.rotationTolerance);
+    std::vector<uint32_t> scaleKeys = ClipCompression::ReduceVec3Keys(m_ScaleTimes, m_Scales, settings.scaleTolerance);
+
+    m_PackedPositions = ClipCompression::CompressVec3(m_PositionTimes, m_Positions, positionKeys, timeScale);
+    m_PackedRotations = ClipCompression::CompressQuat(m_RotationTimes, m_Rotations, rotationKeys, timeScale);
+    m_PackedScales = ClipCompression::CompressVec3(m_ScaleTimes, m_Scales, scaleKeys, timeScale);
+    m_TimeScale = timeScale;
+    m_Compressed = true;
+
+    report.keptKeys += positionKeys.size() + rotationKeys.size() + scaleKeys.size();
+    report.compressedBytes += GetMemoryBytes();
+
+    // Sample the packed tracks where the source had keys
+    uint32_t cursor = 0;
+    for (size_t i = 0; i < m_Positions.size(); ++i)
+        report.maxPositionError = (std::max)(report.maxPositionError, glm::length(InterpolatePosition(m_PositionTimes[i], cursor) - m_Positions[i]));
+    cursor = 0;
+    for (size_t i = 0; i < m_Rotations.size(); ++i)
+        report.maxRotationError = (std::max)(report.maxRotationError,
+                                             ClipCompression::RotationError(InterpolateRotation(m_RotationTimes[i], cursor, RotationInterpolation::Slerp), m_Rotations[i]));
+    cursor = 0;
+    for (size_t i = 0; i < m_Scales.size(); ++i)
+        report.maxScaleError = (std::max)(report.maxScaleError, glm::length(InterpolateScaling(m_ScaleTimes[i], cursor) - m_Scales[i]));
+
+    ReleaseKeys(m_PositionTimes);
+    ReleaseKeys(m_Positions);
+    ReleaseKeys(m_RotationTimes);
+    ReleaseKeys(m_Rotations);
+    ReleaseKeys(m_ScaleTimes);
+    ReleaseKeys(m_Scales);
 }
 
-glm::quat Bone::InterpolateRotation(float animationTime)
+size_t Bone::GetMemoryBytes() const
 {
-    if (1 == m_NumRotations)
-    {
-        return glm::normalize(m_Rotations[0].orientation);
-    }
+    if (m_Compressed)
+        return m_PackedPositions.GetBytes() + m_PackedRotations.GetBytes() + m_PackedScales.GetBytes();
 
-    int p0Index = GetRotationIndex(animationTime);
-    int p1Index = p0Index + 1;
-    float scaleFactor = GetScaleFactor(m_Rotations[p0Index].timeStamp,
-                                       m_Rotations[p1Index].timeStamp, animationTime);
-    return glm::normalize(glm::slerp(m_Rotations[p0Index].orientation, m_Rotations[p1Index].orientation, scaleFactor));
+    return m_PositionTimes.size() * sizeof(float) + m_Positions.size() * sizeof(glm::vec3) +
+           m_RotationTimes.size() * sizeof(float) + m_Rotations.size() * sizeof(glm::quat) +
+           m_ScaleTimes.size() * sizeof(float) + m_Scales.size() * sizeof(glm::vec3);
 }
-
-glm::vec3 Bone::InterpolateScaling(float animationTime)
-{
-    if (1 == m_NumScalings)
-        return m_Scales[0].scale;
-
-    int p0Index = GetScaleIndex(animationTime);
-    int p1Index = p0Index + 1;
-    float scaleFactor = GetScaleFactor(m_Scales[p0Index].timeStamp,
-                                       m_Scales[p1Index].timeStamp, animationTime);
-    return glm::mix(m_Scales[p0Index].scale, m_Scales[p1Index].scale, scaleFactor);
-}
\ No newline at end of file
@@ -0,0 +1,275 @@
+#include <graphic/geometry/clip_compression.h>
+
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AXIS_ANIM_SSE 1
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+    constexpr float QUAT_RANGE = 0.70710678f; // |smaller three| <= 1/sqrt(2)
+    constexpr float QUAT_STEPS = 32767.0f;
+    // Lets the SSE path load two adjacent keys (6 values) with one 16-byte read
+    constexpr size_t VALUE_PADDING = 2;
+
+    uint16_t QuantizeTime(float time, float timeScale)
+    {
+        return static_cast<uint16_t>(glm::clamp(std::round(time * timeScale), 0.0f, ClipCompression::TIME_STEPS));
+    }
+
+    float TimeFactor(const std::vector<float> &times, uint32_t from, uint32_t to, uint32_t at)
+    {
+        float span = times[to] - times[from];
+        return span > 0.0f ? (times[at] - times[from]) / span : 0.0f;
+    }
+
+    // Greedy: extend the current segment until an interior key falls outside tolerance
+    template <typename T, typename ErrorFn>
+    std::vector<uint32_t> ReduceKeys(const std::vector<T> &values, ErrorFn segmentError)
+    {
+        std::vector<uint32_t> keep;
+        uint32_t count = static_cast<uint32_t>(values.size());
+        if (count == 0)
+            return keep;
+
+        keep.push_back(0);
+        uint32_t anchor = 0;
+        for (uint32_t end = 2; end < count; ++end)
+        {
+            for (uint32_t inner = anchor + 1; inner < end; ++inner)
+            {
+                if (segmentError(anchor, end, inner))
+                {
+                    keep.push_back(end - 1);
+                    anchor = end - 1;
+                    break;
+                }
+            }
+        }
+        if (count > 1)
+            keep.push_back(count - 1);
+        return keep;
+    }
+}
+
+void ClipCompressionReport::Merge(const ClipCompressionReport &other)
+{
+    rawBytes += other.rawBytes;
+    compressedBytes += other.compressedBytes;
+    rawKeys += other.rawKeys;
+    keptKeys += other.keptKeys;
+    maxPositionError = (std::max)(maxPositionError, other.maxPositionError);
+    maxRotationError = (std::max)(maxRotationError, other.maxRotationError);
+    maxScaleError = (std::max)(maxScaleError, other.maxScaleError);
+}
+
+namespace ClipCompression
+{
+    std::vector<uint32_t> ReduceVec3Keys(const std::vector<float> &times, const std::vector<glm::vec3> &values, float tolerance)
+    {
+        return ReduceKeys(values, [&](uint32_t from, uint32_t to, uint32_t at)
+        {
+            glm::vec3 predicted = glm::mix(values[from], values[to], TimeFactor(times, from, to, at));
+            return glm::length(predicted - values[at]) > tolerance;
+        });
+    }
+
+    std::vector<uint32_t> ReduceQuatKeys(const std::vector<float> &times, const std::vector<glm::quat> &values, float toleranceRadians)
+    {
+        return ReduceKeys(values, [&](uint32_t from, uint32_t to, uint32_t at)
+        {
+            glm::quat predicted = glm::slerp(values[from], values[to], TimeFactor(times, from, to, at));
+            return RotationError(predicted, values[at]) > toleranceRadians;
+        });
+    }
+
+    CompressedVec3Track CompressVec3(const std::vector<float> &times, const std::vector<glm::vec3> &values, const std::vector<uint32_t> &keep, float timeScale)
+    {
+        CompressedVec3Track track;
+        if (keep.empty())
+            return track;
+
+        glm::vec3 minValue = values[keep[0]];
+        glm::vec3 maxValue = values[keep[0]];
+        for (uint32_t index : keep)
+        {
+            minValue = glm::min(minValue, values[index]);
+            maxValue = glm::max(maxValue, values[index]);
+        }
+
+        track.offset = minValue;
+        track.step = (maxValue - minValue) / TIME_STEPS;
+        glm::vec3 inverseStep(0.0f);
+        for (int c = 0; c < 3; ++c)
+            inverseStep[c] = track.step[c] > 0.0f ? 1.0f / track.step[c] : 0.0f;
+
+        track.times.reserve(keep.size());
+        track.values.reserve(keep.size() * 3);
+        for (uint32_t index : keep)
+        {
+            track.times.push_back(QuantizeTime(times[index], timeScale));
+            glm::vec3 normalized = (values[index] - minValue) * inverseStep;
+            for (int c = 0; c < 3; ++c)
+                track.values.push_back(static_cast<uint16_t>(glm::clamp(std::round(normalized[c]), 0.0f, 65535.0f)));
+        }
+        track.values.resize(track.values.size() + VALUE_PADDING, 0);
+        return track;
+    }
+
+    CompressedQuatTrack CompressQuat(const std::vector<float> &times, const std::vector<glm::quat> &values, const std::vector<uint32_t> &keep, float timeScale)
+    {
+        CompressedQuatTrack track;
+        track.times.reserve(keep.size());
+        track.values.resize(keep.size() * 3 + VALUE_PADDING, 0);
+        for (size_t i = 0; i < keep.size(); ++i)
+        {
+            track.times.push_back(QuantizeTime(times[keep[i]], timeScale));
+            EncodeQuat(values[keep[i]], &track.values[i * 3]);
+        }
+        return track;
+    }
+
+    void EncodeQuat(const glm::quat &rotation, uint16_t out[3])
+    {
+        glm::quat q = glm::normalize(rotation);
+
+        int largest = 0;
+        for (int i = 1; i < 4; ++i)
+        {
+            if (std::abs(q[i]) > std::abs(q[largest]))
+                largest = i;
+        }
+        // q and -q are the same rotation; keep the dropped component positive
+        if (q[largest] < 0.0f)
+            q = -q;
+
+        int slot = 0;
+        for (int i = 0; i < 4; ++i)
+        {
+            if (i == largest)
+                continue;
+            float normalized = (glm::clamp(q[i], -QUAT_RANGE, QUAT_RANGE) / QUAT_RANGE) * 0.5f + 0.5f;
+            out[slot++] = static_cast<uint16_t>(std::round(normalized * QUAT_STEPS));
+        }
+        out[0] |= static_cast<uint16_t>((largest & 1) << 15);
+        out[1] |= static_cast<uint16_t>((largest >> 1) << 15);
+    }
+
+    glm::quat DecodeQuat(const uint16_t in[3])
+    {
+        int largest = (in[0] >> 15) | ((in[1] >> 15) << 1);
+        float small[3];
+        float sumSq = 0.0f;
+        for (int i = 0; i < 3; ++i)
+        {
+            small[i] = ((in[i] & 0x7FFF) / QUAT_STEPS * 2.0f - 1.0f) * QUAT_RANGE;
+            sumSq += small[i] * small[i];
+        }
+
+        glm::quat q;
+        int slot = 0;
+        for (int i = 0; i < 4; ++i)
+            q[i] = i == largest ? std::sqrt((std::max)(0.0f, 1.0f - sumSq)) : small[slot++];
+        return q;
+    }
+
+#if AXIS_ANIM_SSE
+    namespace
+    {
+        // Keys index and index + 1 widened to 32-bit lanes; lane 3 holds whatever follows the key
+        inline void LoadKeyPair(const uint16_t *keys, __m128i &a, __m128i &b)
+        {
+            const __m128i zero = _mm_setzero_si128();
+            __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i *>(keys));
+            a = _mm_unpacklo_epi16(packed, zero);
+            b = _mm_unpacklo_epi16(_mm_srli_si128(packed, 6), zero);
+        }
+
+        // Both keys' smaller three at once; w of each result is the rebuilt largest component
+        inline void DecodeSmallestThreePair(const uint16_t *keys, float (&a)[4], float (&b)[4])
+        {
+            const __m128i mask = _mm_setr_epi32(0x7FFF, 0x7FFF, 0x7FFF, 0);
+            const __m128 scale = _mm_set1_ps(2.0f * QUAT_RANGE / QUAT_STEPS);
+            const __m128 bias = _mm_setr_ps(QUAT_RANGE, QUAT_RANGE, QUAT_RANGE, 0.0f);
+
+            __m128i keyA, keyB;
+            LoadKeyPair(keys, keyA, keyB);
+            __m128 smallA = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(keyA, mask)), scale), bias);
+            __m128 smallB = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(keyB, mask)), scale), bias);
+
+            // Horizontal sums of squares of both keys, then one sqrt for the pair
+            __m128 sqA = _mm_mul_ps(smallA, smallA);
+            __m128 sqB = _mm_mul_ps(smallB, smallB);
+            __m128 lo = _mm_unpacklo_ps(sqA, sqB); // a0 b0 a1 b1
+            __m128 hi = _mm_unpackhi_ps(sqA, sqB); // a2 b2 a3 b3
+            __m128 sums = _mm_add_ps(_mm_add_ps(lo, _mm_movehl_ps(lo, lo)), hi);
+            __m128 largest = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(_mm_set1_ps(1.0f), sums), _mm_setzero_ps()));
+
+            _mm_storeu_ps(a, smallA);
+            _mm_storeu_ps(b, smallB);
+            float rebuilt[4];
+            _mm_storeu_ps(rebuilt, largest);
+            a[3] = rebuilt[0];
+            b[3] = rebuilt[1];
+        }
+
+        // Source lane of each quaternion component per dropped index; a table instead of branches,
+        // since the dropped index changes unpredictably from key to key
+        constexpr int SCATTER[4][4] = {{3, 0, 1, 2}, {0, 3, 1, 2}, {0, 1, 3, 2}, {0, 1, 2, 3}};
+
+        inline glm::quat Scatter(const float (&decoded)[4], int largest)
+        {
+            const int *lanes = SCATTER[largest];
+            glm::quat q;
+            for (int i = 0; i < 4; ++i)
+                q[i] = decoded[lanes[i]];
+            return q;
+        }
+    }
+#endif
+
+    glm::vec3 SampleVec3(const CompressedVec3Track &track, uint32_t index, float factor)
+    {
+        const uint16_t *keyA = &track.values[index * 3];
+#if AXIS_ANIM_SSE
+        __m128 step = _mm_setr_ps(track.step.x, track.step.y, track.step.z, 0.0f);
+        __m128i packedA, packedB;
+        LoadKeyPair(keyA, packedA, packedB);
+        __m128 a = _mm_cvtepi32_ps(packedA);
+        __m128 b = _mm_cvtepi32_ps(packedB);
+        __m128 blended = _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), _mm_set1_ps(factor)));
+        float result[4];
+        _mm_storeu_ps(result, _mm_add_ps(_mm_mul_ps(blended, step), _mm_setr_ps(track.offset.x, track.offset.y, track.offset.z, 0.0f)));
+        return glm::vec3(result[0], result[1], result[2]);
+#else
+        const uint16_t *keyB = keyA + 3;
+        glm::vec3 a(keyA[0], keyA[1], keyA[2]);
+        glm::vec3 b(keyB[0], keyB[1], keyB[2]);
+        return track.offset + glm::mix(a, b, factor) * track.step;
+#endif
+    }
+
+    void DecodeQuatPair(const CompressedQuatTrack &track, uint32_t index, glm::quat &a, glm::quat &b)
+    {
+        const uint16_t *keyA = &track.values[index * 3];
+        const uint16_t *keyB = keyA + 3;
+#if AXIS_ANIM_SSE
+        float decodedA[4], decodedB[4];
+        DecodeSmallestThreePair(keyA, decodedA, decodedB);
+        a = Scatter(decodedA, (keyA[0] >> 15) | ((keyA[1] >> 15) << 1));
+        b = Scatter(decodedB, (keyB[0] >> 15) | ((keyB[1] >> 15) << 1));
+#else
+        a = DecodeQuat(keyA);
+        b = DecodeQuat(keyB);
+#endif
+    }
+
+    float RotationError(const glm::quat &a, const glm::quat &b)
+    {
+        // atan2 of the relative rotation stays precise for tiny angles, unlike acos of the dot
+        glm::quat delta = glm::conjugate(glm::normalize(a)) * glm::normalize(b);
+        return 2.0f * std::atan2(glm::length(glm::vec3(delta.x, delta.y, delta.z)), std::abs(delta.w));
+    }
+}
@@ -7,17 +7,17 @@ Mesh::Mesh(std::vector<Vertex> vertices,
            std::vector<unsigned int> indices,
            std::vector<Texture> textures)
 {
-    this->vertices = vertices;
-    this->indices = indices;
-    this->textures = textures;
+    this->vertices = std::move(vertices);
+    this->indices = std::move(indices);
+    this->textures = std::move(textures);
 
     setupMesh();
 
-    if (!vertices.empty())
+    if (!this->vertices.empty())
     {
-        AABBmin = vertices[0].Position;
-        AABBmax = vertices[0].Position;
-        for (const auto &v : vertices)
+        AABBmin = this->vertices[0].Position;
+        AABBmax = this->vertices[0].Position;
+        for (const auto &v : this->vertices)
         {
             AABBmin.x = (std::min)(AABBmin.x, v.Position.x);
             AABBmin.y = (std::min)(AABBmin.y, v.Position.y);
@@ -30,7 +30,7 @@ Mesh::Mesh(std::vector<Vertex> vertices,
     }
 }
 
-void Mesh::Draw(Shader &shader)
+void Mesh::BindTextures(Shader &shader)
 {
     unsigned int diffuseNr = 1;
     unsigned int specularNr = 1;
@@ -53,11 +53,16 @@ void Mesh::Draw(Shader &shader)
         else if (name == "texture_height")
             number = std::to_string(heightNr++);
 
-        glUniform1i(glGetUniformLocation(shader.ID, (name + number).c_str()), i);
+        shader.setInt(name + number, i);
         glBindTexture(GL_TEXTURE_2D, textures[i].id);
     }
+}
+
+void Mesh::Draw(Shader &shader)
+{
+    BindTextures(shader);
 
-    shader.setBool("isInstanced", false);
+    shader.setBool("isInstanced"_uniform, false);
 
     glBindVertexArray(VAO);
     glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indices.size()), GL_UNSIGNED_INT, 0);
@@ -66,47 +71,59 @@ void Mesh::Draw(Shader &shader)
     glActiveTexture(GL_TEXTURE0);
 }
 
-void Mesh::DrawInstanced(Shader &shader, const std::vector<glm::mat4> &models)
+void Mesh::DrawInstanced(Shader &shader, unsigned int instanceBuffer, uint32_t bufferGeneration, size_t byteOffset, size_t count)
 {
-    unsigned int diffuseNr = 1;
-    unsigned int specularNr = 1;
-    unsigned int normalNr = 1;
-    unsigned int heightNr = 1;
+    if (count == 0)
+        return;
 
-    for (unsigned int i = 0; i < textures.size(); i++)
-    {
-        glActiveTexture(GL_TEXTURE0 + i);
+    BindTextures(shader);
 
-        std::string number;
-        std::string name = textures[i].type;
+    shader.setBool("isInstanced"_uniform, true);
 
-        if (name == "texture_diffuse")
-            number = std::to_string(diffuseNr++);
-        else if (name == "texture_specular")
-            number = std::to_string(specularNr++);
-        else if (name == "texture_normal")
-            number = std::to_string(normalNr++);
-        else if (name == "texture_height")
-            number = std::to_string(heightNr++);
+    glBindVertexArray(VAO);
 
-        glUniform1i(glGetUniformLocation(shader.ID, (name + number).c_str()), i);
-        glBindTexture(GL_TEXTURE_2D, textures[i].id);
-    }
+    // With base instance the attributes stay pointed at the start of the buffer and only the
+    // draw changes; otherwise the attribute pointers are moved to the allocation
+    if (GLAD_GL_VERSION_4_2 && glDrawElementsInstancedBaseInstance && byteOffset % sizeof(glm::mat4) == 0)
+    {
+        if (!isInstanceSource(instanceBuffer, bufferGeneration, 0))
+            bindInstanceAttributes(instanceBuffer, bufferGeneration, 0);
 
-    shader.setBool("isInstanced", true);
+        glDrawElementsInstancedBaseInstance(GL_TRIANGLES, static_cast<GLsizei>(indices.size()), GL_UNSIGNED_INT, 0,
+                                            static_cast<GLsizei>(count), static_cast<GLuint>(byteOffset / sizeof(glm::mat4)));
+    }
+    else
+    {
+        if (!isInstanceSource(instanceBuffer, bufferGeneration, byteOffset))
+            bindInstanceAttributes(instanceBuffer, bufferGeneration, byteOffset);
 
-    glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-    glBufferData(GL_ARRAY_BUFFER, models.size() * sizeof(glm::mat4), models.data(), GL_DYNAMIC_DRAW);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glDrawElementsInstanced(GL_TRIANGLES, static_cast<GLsizei>(indices.size()), GL_UNSIGNED_INT, 0, static_cast<GLsizei>(count));
+    }
 
-    glBindVertexArray(VAO);
-    glDrawElementsInstanced(GL_TRIANGLES, static_cast<GLsizei>(indices.size()), GL_UNSIGNED_INT, 0, static_cast<GLsizei>(models.size()));
     glBindVertexArray(0);
 
-    shader.setBool("isInstanced", false);
+    shader.setBool("isInstanced"_uniform, false);
     glActiveTexture(GL_TEXTURE0);
 }
 
+// A grown ring may reuse the deleted buffer's name, so the name alone does not identify it
+bool Mesh::isInstanceSource(unsigned int buffer, uint32_t generation, size_t byteOffset) const
+{
+    return m_InstanceSource == buffer && m_InstanceSourceGeneration == generation && m_InstanceSourceOffset == byteOffset;
+}
+
+// Expects the VAO to be bound
+void Mesh::bindInstanceAttributes(unsigned int buffer, uint32_t generation, size_t byteOffset)
+{
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    SetupInstanceAttributes(byteOffset);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    m_InstanceSource = buffer;
+    m_InstanceSourceGeneration = generation;
+    m_InstanceSourceOffset = byteOffset;
+}
+
 void Mesh::setupMesh()
 {
     glGenVertexArrays(1, &VAO);
@@ -127,6 +144,22 @@ void Mesh::setupMesh()
                  indices.data(),
                  GL_STATIC_DRAW);
 
+    SetupVertexAttributes();
+
+    glGenBuffers(1, &instanceVBO);
+    glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+
+    SetupInstanceAttributes(0);
+
+    m_InstanceSource = instanceVBO;
+    m_InstanceSourceGeneration = 0;
+    m_InstanceSourceOffset = 0;
+
+    glBindVertexArray(0);
+}
+
+void Mesh::SetupVertexAttributes()
+{
     glEnableVertexAttribArray(0);
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex),
                           (void *)offsetof(Vertex, Position));
@@ -154,25 +187,16 @@ void Mesh::setupMesh()
     glEnableVertexAttribArray(6);
     glVertexAttribPointer(6, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex),
                           (void *)offsetof(Vertex, m_Weights));
+}
 
-    glGenBuffers(1, &instanceVBO);
-    glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-
+void Mesh::SetupInstanceAttributes(size_t byteOffset)
+{
     std::size_t vec4Size = sizeof(glm::vec4);
 
-    glEnableVertexAttribArray(10);
-    glVertexAttribPointer(10, 4, GL_FLOAT, GL_FALSE, 4 * vec4Size, (void *)0);
-    glEnableVertexAttribArray(11);
-    glVertexAttribPointer(11, 4, GL_FLOAT, GL_FALSE, 4 * vec4Size, (void *)(1 * vec4Size));
-    glEnableVertexAttribArray(12);
-    glVertexAttribPointer(12, 4, GL_FLOAT, GL_FALSE, 4 * vec4Size, (void *)(2 * vec4Size));
-    glEnableVertexAttribArray(13);
-    glVertexAttribPointer(13, 4, GL_FLOAT, GL_FALSE, 4 * vec4Size, (void *)(3 * vec4Size));
-
-    glVertexAttribDivisor(10, 1);
-    glVertexAttribDivisor(11, 1);
-    glVertexAttribDivisor(12, 1);
-    glVertexAttribDivisor(13, 1);
-
-    glBindVertexArray(0);
-}
\ No newline at end of file
+    for (unsigned int i = 0; i < 4; i++)
+    {
+        glEnableVertexAttribArray(10 + i);
+        glVertexAttribPointer(10 + i, 4, GL_FLOAT, GL_FALSE, 4 * vec4Size, (void *)(byteOffset + i * vec4Size));
+        glVertexAttribDivisor(10 + i, 1);
+    }
+}
@@ -0,0 +1,192 @@
+#include <graphic/geometry/mesh_arena.h>
+#include <graphic/geometry/model.h>
+#include <utils/logger.h>
+#include <algorithm>
+
+namespace
+{
+    uint64_t HashTextures(const std::vector<Texture> &textures)
+    {
+        if (textures.empty())
+            return 0;
+
+        uint64_t hash = 1469598103934665603ull;
+        for (const Texture &texture : textures)
+        {
+            hash ^= texture.id;
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    GLuint CreateBuffer(size_t bytes)
+    {
+        GLuint buffer = 0;
+        glGenBuffers(1, &buffer);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+        glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(bytes), nullptr, GL_STATIC_DRAW);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        return buffer;
+    }
+
+    // Returns a bigger buffer holding the first usedBytes of the old one; the old one is deleted
+    GLuint GrowBuffer(GLuint buffer, size_t usedBytes, size_t newBytes)
+    {
+        GLuint grown = CreateBuffer(newBytes);
+        if (buffer && usedBytes > 0)
+        {
+            glBindBuffer(GL_COPY_READ_BUFFER, buffer);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, grown);
+            glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, static_cast<GLsizeiptr>(usedBytes));
+            glBindBuffer(GL_COPY_READ_BUFFER, 0);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        }
+        if (buffer)
+            glDeleteBuffers(1, &buffer);
+        return grown;
+    }
+}
+
+MeshArena::~MeshArena()
+{
+    Shutdown();
+}
+
+void MeshArena::Init(size_t vertexCapacity, size_t indexCapacity)
+{
+    if (m_VAO)
+        return;
+
+    m_VertexCapacity = (std::max)(vertexCapacity, size_t(1));
+    m_IndexCapacity = (std::max)(indexCapacity, size_t(1));
+    m_VBO = CreateBuffer(m_VertexCapacity * sizeof(Vertex));
+    m_EBO = CreateBuffer(m_IndexCapacity * sizeof(unsigned int));
+    CreateVertexArray();
+}
+
+void MeshArena::Shutdown()
+{
+    if (m_VAO)
+        glDeleteVertexArrays(1, &m_VAO);
+    if (m_VBO)
+        glDeleteBuffers(1, &m_VBO);
+    if (m_EBO)
+        glDeleteBuffers(1, &m_EBO);
+
+    m_VAO = m_VBO = m_EBO = 0;
+    m_InstanceSource = 0;
+    m_InstanceSourceGeneration = 0;
+    m_VertexCount = m_VertexCapacity = 0;
+    m_IndexCount = m_IndexCapacity = 0;
+    m_Models.clear();
+    m_Meshes.clear();
+}
+
+void MeshArena::CreateVertexArray()
+{
+    if (m_VAO)
+        glDeleteVertexArrays(1, &m_VAO);
+
+    glGenVertexArrays(1, &m_VAO);
+    glBindVertexArray(m_VAO);
+
+    glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+    Mesh::SetupVertexAttributes();
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    m_InstanceSource = 0;
+    m_InstanceSourceGeneration = 0;
+}
+
+void MeshArena::Reserve(size_t vertices, size_t indices)
+{
+    if (vertices <= m_VertexCapacity && indices <= m_IndexCapacity)
+        return;
+
+    if (vertices > m_VertexCapacity)
+    {
+        size_t capacity = (std::max)(m_VertexCapacity * 2, vertices);
+        m_VBO = GrowBuffer(m_VBO, m_VertexCount * sizeof(Vertex), capacity * sizeof(Vertex));
+        m_VertexCapacity = capacity;
+    }
+
+    if (indices > m_IndexCapacity)
+    {
+        size_t capacity = (std::max)(m_IndexCapacity * 2, indices);
+        m_EBO = GrowBuffer(m_EBO, m_IndexCount * sizeof(unsigned int), capacity * sizeof(unsigned int));
+        m_IndexCapacity = capacity;
+    }
+
+    LOGGER_INFO("MeshArena") << "Grew to " << m_VertexCapacity << " vertices / " << m_IndexCapacity << " indices";
+    CreateVertexArray();
+}
+
+const ArenaModel *MeshArena::Acquire(Model &model)
+{
+    if (!m_VAO)
+        return nullptr;
+
+    if (model.arenaHandle != 0)
+    {
+        size_t slot = model.arenaHandle - 1;
+        if (slot < m_Models.size() && m_Models[slot].model == &model)
+            return &m_Models[slot];
+    }
+
+    size_t vertexTotal = 0;
+    size_t indexTotal = 0;
+    for (const Mesh &mesh : model.meshes)
+    {
+        vertexTotal += mesh.vertices.size();
+        indexTotal += mesh.indices.size();
+    }
+    if (indexTotal == 0)
+        return nullptr;
+
+    Reserve(m_VertexCount + vertexTotal, m_IndexCount + indexTotal);
+
+    // Ranges live in each entry's own vector, so pointers to them survive m_Models growing
+    ArenaModel entry;
+    entry.model = &model;
+    for (Mesh &mesh : model.meshes)
+    {
+        ArenaMeshRange range;
+        range.indexCount = static_cast<uint32_t>(mesh.indices.size());
+        range.firstIndex = static_cast<uint32_t>(m_IndexCount);
+        range.baseVertex = static_cast<int32_t>(m_VertexCount);
+        range.meshId = static_cast<uint32_t>(m_Meshes.size());
+        range.textureKey = HashTextures(mesh.textures);
+
+        glBindBuffer(GL_COPY_WRITE_BUFFER, m_VBO);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(m_VertexCount * sizeof(Vertex)),
+                        static_cast<GLsizeiptr>(mesh.vertices.size() * sizeof(Vertex)), mesh.vertices.data());
+        glBindBuffer(GL_COPY_WRITE_BUFFER, m_EBO);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(m_IndexCount * sizeof(unsigned int)),
+                        static_cast<GLsizeiptr>(mesh.indices.size() * sizeof(unsigned int)), mesh.indices.data());
+
+        m_VertexCount += mesh.vertices.size();
+        m_IndexCount += mesh.indices.size();
+        m_Meshes.push_back(&mesh);
+        entry.meshes.push_back(range);
+    }
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+    model.arenaHandle = static_cast<uint32_t>(m_Models.size() + 1);
+    m_Models.push_back(std::move(entry));
+    return &m_Models.back();
+}
+
+void MeshArena::Bind(GLuint instanceBuffer, uint32_t bufferGeneration)
+{
+    glBindVertexArray(m_VAO);
+    if (m_InstanceSource != instanceBuffer || m_InstanceSourceGeneration != bufferGeneration)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+        Mesh::SetupInstanceAttributes(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        m_InstanceSource = instanceBuffer;
+        m_InstanceSourceGeneration = bufferGeneration;
+    }
+}
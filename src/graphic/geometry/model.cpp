@@ -12,456 +12,694 @@
 #include <vector>
 #include <cstring>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <semaphore>
+#include <thread>
 
 #include <utils/assimp_glm_helpers.h>
+#include <utils/logger.h>
+#include <utils/profiler.h>
 
-Model::Model(std::string const &path, bool isStatic, bool gamma) : gammaCorrection(gamma)
+namespace
 {
-    loadModel(path, isStatic);
+    using Clock = std::chrono::steady_clock;
 
-    if (!meshes.empty())
+    float MsSince(Clock::time_point start)
     {
-        AABBmin = meshes[0].AABBmin;
-        AABBmax = meshes[0].AABBmax;
-        for (const auto &mesh : meshes)
-        {
-            AABBmin.x = (std::min)(AABBmin.x, mesh.AABBmin.x);
-            AABBmin.y = (std::min)(AABBmin.y, mesh.AABBmin.y);
-            AABBmin.z = (std::min)(AABBmin.z, mesh.AABBmin.z);
+        return std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+    }
 
-            AABBmax.x = (std::max)(AABBmax.x, mesh.AABBmax.x);
-            AABBmax.y = (std::max)(AABBmax.y, mesh.AABBmax.y);
-            AABBmax.z = (std::max)(AABBmax.z, mesh.AABBmax.z);
-        }
+    enum TextureSlot : uint8_t
+    {
+        SLOT_BASE_COLOR,
+        SLOT_DIFFUSE,
+        SLOT_SPECULAR,
+        SLOT_NORMALS,
+        SLOT_HEIGHT,
+        SLOT_METALNESS,
+        SLOT_ROUGHNESS,
+        SLOT_AO,
+        SLOT_LIGHTMAP,
+        SLOT_COUNT
+    };
+
+    constexpr aiTextureType SLOT_TYPES[SLOT_COUNT] = {
+        aiTextureType_BASE_COLOR,
+        aiTextureType_DIFFUSE,
+        aiTextureType_SPECULAR,
+        aiTextureType_NORMALS,
+        aiTextureType_HEIGHT,
+        aiTextureType_METALNESS,
+        aiTextureType_DIFFUSE_ROUGHNESS,
+        aiTextureType_AMBIENT_OCCLUSION,
+        aiTextureType_LIGHTMAP};
+
+    // A distinct image referenced by the file
+    struct TextureRef
+    {
+        std::string key;  // ImageDecodeCache key: the resolved file, or model path + embedded name
+        std::string path; // as written in the first material using it
+        std::string file; // directory/filename, tried first
+        std::string alt;  // directory/path-as-written, tried when they differ
+        const aiTexture *embedded = nullptr;
+        ImageDecodeCache::Handle pixels; // null when decoding failed
+        int32_t image = -1;              // index in ModelImportData::images once a mesh binds it
+    };
+
+    struct MaterialRefs
+    {
+        bool gathered = false;
+        std::vector<uint32_t> slots[SLOT_COUNT]; // indices into ImportPlan::textures
+    };
+
+    // Built serially from the aiScene; the parallel jobs only read it, each writing its own output slot
+    struct ImportPlan
+    {
+        std::vector<const aiMesh *> meshes;    // node order, as they appear in the model
+        std::vector<std::vector<int>> boneIds; // per mesh, per aiBone
+        std::vector<MaterialRefs> materials;
+        std::vector<TextureRef> textures;
+        std::unordered_map<std::string, uint32_t> textureIndex; // TextureRef::key -> textures
+    };
+
+    std::string Sanitize(std::string path)
+    {
+        std::replace(path.begin(), path.end(), '\\', '/');
+        return path;
     }
-}
 
-void Model::Draw(Shader &shader)
-{
-    for (unsigned int i = 0; i < meshes.size(); i++)
-        meshes[i].Draw(shader);
-}
+    std::string FileName(const std::string &path)
+    {
+        size_t lastSlash = path.find_last_of('/');
+        return lastSlash != std::string::npos ? path.substr(lastSlash + 1) : path;
+    }
 
-void Model::DrawInstanced(Shader &shader, const std::vector<glm::mat4> &models)
-{
-    for (unsigned int i = 0; i < meshes.size(); i++)
-        meshes[i].DrawInstanced(shader, models);
-}
+    void CollectMeshes(const aiNode *node, const aiScene *scene, ImportPlan &plan)
+    {
+        if (!node || !scene || !scene->mMeshes)
+            return;
 
-std::unordered_map<std::string, BoneInfo> &Model::GetBoneInfoMap() { return m_BoneInfoMap; }
-int &Model::GetBoneCount() { return m_BoneCounter; }
+        for (unsigned int i = 0; i < node->mNumMeshes; i++)
+        {
+            unsigned int meshIndex = node->mMeshes[i];
+            if (meshIndex >= scene->mNumMeshes)
+                continue;
 
-void Model::loadModel(std::string const &path, bool isStatic)
-{
-    Assimp::Importer importer;
+            if (const aiMesh *mesh = scene->mMeshes[meshIndex])
+                plan.meshes.push_back(mesh);
+        }
 
-    unsigned int flags = aiProcess_Triangulate |
-                         aiProcess_GenSmoothNormals |
-                         aiProcess_CalcTangentSpace |
-                         aiProcess_FlipUVs;
+        for (unsigned int i = 0; i < node->mNumChildren; i++)
+        {
+            CollectMeshes(node->mChildren[i], scene, plan);
+        }
+    }
 
-    if (isStatic)
+    // Bone ids in first-seen order across the meshes, so the result matches a serial walk
+    void AssignBoneIds(ImportPlan &plan, ModelImportData &data)
     {
-        flags |= aiProcess_PreTransformVertices;
-    }
+        auto &boneInfoMap = data.boneInfoMap;
+        int &boneCount = data.boneCount;
 
-    const aiScene *scene = importer.ReadFile(path, flags);
+        plan.boneIds.resize(plan.meshes.size());
+        for (size_t m = 0; m < plan.meshes.size(); ++m)
+        {
+            const aiMesh *mesh = plan.meshes[m];
+            std::vector<int> &ids = plan.boneIds[m];
+            ids.reserve(mesh->mNumBones);
 
-    if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode)
-    {
-        std::cout << "[Model] ERROR::ASSIMP:: " << importer.GetErrorString() << std::endl;
-        return;
+            for (unsigned int boneIndex = 0; boneIndex < mesh->mNumBones; ++boneIndex)
+            {
+                std::string boneName = mesh->mBones[boneIndex]->mName.C_Str();
+                auto it = boneInfoMap.find(boneName);
+                if (it == boneInfoMap.end())
+                {
+                    BoneInfo newBoneInfo;
+                    newBoneInfo.id = boneCount++;
+                    newBoneInfo.offset = AssimpGLMHelpers::ConvertMatrixToGLMFormat(mesh->mBones[boneIndex]->mOffsetMatrix);
+                    it = boneInfoMap.emplace(boneName, newBoneInfo).first;
+                }
+                ids.push_back(it->second.id);
+            }
+        }
     }
 
-    directory = path.substr(0, path.find_last_of('/'));
-    processNode(scene->mRootNode, scene);
-}
+    uint32_t AddTextureRef(const aiString &str, const std::string &modelPath, const std::string &directory, const aiScene *scene, ImportPlan &plan)
+    {
+        std::string filename = Sanitize(str.C_Str());
+        std::string pureFilename = FileName(filename);
 
-void Model::processNode(aiNode *node, const aiScene *scene)
-{
-    if (!node || !scene || !scene->mMeshes)
-        return;
+        const aiTexture *aiTex = nullptr;
+        if (filename[0] == '*')
+        {
+            try
+            {
+                int id = std::stoi(filename.substr(1));
+                if (id >= 0 && static_cast<unsigned int>(id) < scene->mNumTextures)
+                    aiTex = scene->mTextures[id];
+            }
+            catch (...)
+            {
+            }
+        }
+        if (!aiTex)
+        {
+            aiTex = scene->GetEmbeddedTexture(str.C_Str());
+        }
+        if (!aiTex)
+        {
+            aiTex = scene->GetEmbeddedTexture(pureFilename.c_str());
+        }
 
-    for (unsigned int i = 0; i < node->mNumMeshes; i++)
-    {
-        unsigned int meshIndex = node->mMeshes[i];
-        if (meshIndex >= scene->mNumMeshes)
-            continue;
+        TextureRef ref;
+        ref.file = directory + '/' + pureFilename;
+        ref.key = aiTex ? modelPath + '|' + filename : ref.file;
 
-        aiMesh *mesh = scene->mMeshes[meshIndex];
-        if (mesh)
+        auto [it, inserted] = plan.textureIndex.try_emplace(ref.key, static_cast<uint32_t>(plan.textures.size()));
+        if (inserted)
         {
-            meshes.push_back(processMesh(mesh, scene));
+            ref.path = str.C_Str();
+            if (filename != pureFilename)
+                ref.alt = directory + '/' + filename;
+            ref.embedded = aiTex;
+            plan.textures.push_back(std::move(ref));
         }
+        return it->second;
     }
 
-    for (unsigned int i = 0; i < node->mNumChildren; i++)
+    // Every texture the meshes' materials name, deduplicated by resolved path
+    void GatherTextures(const std::string &modelPath, const std::string &directory, const aiScene *scene, ImportPlan &plan)
     {
-        processNode(node->mChildren[i], scene);
+        plan.materials.resize(scene->mNumMaterials);
+        for (const aiMesh *mesh : plan.meshes)
+        {
+            if (mesh->mMaterialIndex >= scene->mNumMaterials)
+                continue;
+
+            MaterialRefs &refs = plan.materials[mesh->mMaterialIndex];
+            if (refs.gathered)
+                continue;
+            refs.gathered = true;
+
+            aiMaterial *material = scene->mMaterials[mesh->mMaterialIndex];
+            for (int slot = 0; slot < SLOT_COUNT; ++slot)
+            {
+                for (unsigned int i = 0; i < material->GetTextureCount(SLOT_TYPES[slot]); i++)
+                {
+                    aiString str;
+                    material->GetTexture(SLOT_TYPES[slot], i, &str);
+                    refs.slots[slot].push_back(AddTextureRef(str, modelPath, directory, scene, plan));
+                }
+            }
+        }
     }
-}
 
-void Model::SetVertexBoneDataToDefault(Vertex &vertex)
-{
-    for (int i = 0; i < MAX_BONE_INFLUENCE; i++)
+    bool DecodeTexture(const TextureRef &ref, DecodedImage &image)
     {
-        vertex.m_BoneIDs[i] = -1;
-        vertex.m_Weights[i] = 0.0f;
+        int width, height, nrComponents;
+        unsigned char *data = nullptr;
+        bool shouldFree = true;
+
+        const int req_comp = 4;
+
+        if (const aiTexture *aiTex = ref.embedded)
+        {
+            if (aiTex->mHeight == 0)
+            {
+                data = stbi_load_from_memory(
+                    reinterpret_cast<unsigned char *>(aiTex->pcData),
+                    aiTex->mWidth,
+                    &width, &height, &nrComponents, req_comp);
+            }
+            else
+            {
+                data = reinterpret_cast<unsigned char *>(aiTex->pcData);
+                width = aiTex->mWidth;
+                height = aiTex->mHeight;
+                shouldFree = false;
+            }
+        }
+        else
+        {
+            data = stbi_load(ref.file.c_str(), &width, &height, &nrComponents, req_comp);
+            if (!data && !ref.alt.empty())
+            {
+                data = stbi_load(ref.alt.c_str(), &width, &height, &nrComponents, req_comp);
+            }
+        }
+
+        if (!data)
+        {
+            LOGGER_WARN("Model") << "Texture failed to load: " << FileName(ref.file) << " (Tried: " << ref.file << ")";
+            return false;
+        }
+
+        // The importer, and with it any embedded texel data, is gone before the upload
+        image.width = width;
+        image.height = height;
+        image.pixels.assign(data, data + static_cast<size_t>(width) * height * 4);
+        if (shouldFree)
+        {
+            stbi_image_free(data);
+        }
+        return true;
     }
-}
 
-Mesh Model::processMesh(aiMesh *mesh, const aiScene *scene)
-{
-    std::vector<Vertex> vertices;
-    std::vector<unsigned int> indices;
-    std::vector<Texture> textures;
+    void SetVertexBoneDataToDefault(Vertex &vertex)
+    {
+        for (int i = 0; i < MAX_BONE_INFLUENCE; i++)
+        {
+            vertex.m_BoneIDs[i] = -1;
+            vertex.m_Weights[i] = 0.0f;
+        }
+    }
 
-    vertices.reserve(mesh->mNumVertices);
-    indices.reserve(mesh->mNumFaces * 3);
+    void SetVertexBoneData(Vertex &vertex, int boneID, float weight)
+    {
+        for (int i = 0; i < MAX_BONE_INFLUENCE; ++i)
+        {
+            if (vertex.m_BoneIDs[i] < 0)
+            {
+                vertex.m_Weights[i] = weight;
+                vertex.m_BoneIDs[i] = boneID;
+                break;
+            }
+        }
+    }
 
-    for (unsigned int i = 0; i < mesh->mNumVertices; i++)
+    void BuildMesh(const aiMesh *mesh, const std::vector<int> &boneIds, ModelMeshData &result)
     {
-        Vertex vertex;
-        SetVertexBoneDataToDefault(vertex);
-        vertex.Position = AssimpGLMHelpers::GetGLMVec(mesh->mVertices[i]);
-        vertex.Normal = AssimpGLMHelpers::GetGLMVec(mesh->mNormals[i]);
+        std::vector<Vertex> &vertices = result.vertices;
+        std::vector<unsigned int> &indices = result.indices;
+
+        vertices.reserve(mesh->mNumVertices);
+        indices.reserve(mesh->mNumFaces * 3);
 
-        if (mesh->HasNormals())
+        for (unsigned int i = 0; i < mesh->mNumVertices; i++)
         {
-            vertex.Normal = AssimpGLMHelpers::GetGLMVec(mesh->mNormals[i]);
+            Vertex vertex;
+            SetVertexBoneDataToDefault(vertex);
+            vertex.Position = AssimpGLMHelpers::GetGLMVec(mesh->mVertices[i]);
+
+            if (mesh->HasNormals())
+            {
+                vertex.Normal = AssimpGLMHelpers::GetGLMVec(mesh->mNormals[i]);
+            }
+
+            if (mesh->mTextureCoords[0])
+            {
+                glm::vec2 vec;
+                vec.x = mesh->mTextureCoords[0][i].x;
+                vec.y = mesh->mTextureCoords[0][i].y;
+                vertex.TexCoords = vec;
+                vertex.Tangent = AssimpGLMHelpers::GetGLMVec(mesh->mTangents[i]);
+                vertex.Bitangent = AssimpGLMHelpers::GetGLMVec(mesh->mBitangents[i]);
+            }
+            else
+            {
+                vertex.TexCoords = glm::vec2(0.0f, 0.0f);
+            }
+
+            vertices.push_back(vertex);
         }
 
-        if (mesh->mTextureCoords[0])
+        for (unsigned int i = 0; i < mesh->mNumFaces; i++)
         {
-            glm::vec2 vec;
-            vec.x = mesh->mTextureCoords[0][i].x;
-            vec.y = mesh->mTextureCoords[0][i].y;
-            vertex.TexCoords = vec;
-            vertex.Tangent = AssimpGLMHelpers::GetGLMVec(mesh->mTangents[i]);
-            vertex.Bitangent = AssimpGLMHelpers::GetGLMVec(mesh->mBitangents[i]);
+            const aiFace &face = mesh->mFaces[i];
+            for (unsigned int j = 0; j < face.mNumIndices; j++)
+                indices.push_back(face.mIndices[j]);
         }
-        else
+
+        for (unsigned int boneIndex = 0; boneIndex < mesh->mNumBones; ++boneIndex)
         {
-            vertex.TexCoords = glm::vec2(0.0f, 0.0f);
+            const aiBone *bone = mesh->mBones[boneIndex];
+            for (unsigned int weightIndex = 0; weightIndex < bone->mNumWeights; ++weightIndex)
+            {
+                unsigned int vertexId = bone->mWeights[weightIndex].mVertexId;
+                if (vertexId < vertices.size())
+                {
+                    SetVertexBoneData(vertices[vertexId], boneIds[boneIndex], bone->mWeights[weightIndex].mWeight);
+                }
+            }
         }
+    }
 
-        vertices.push_back(vertex);
+    // 1x1 texture standing in for a missing map; one per mesh, like the maps it replaces
+    uint32_t AddFallbackImage(ModelImportData &data, const std::string &type, const std::string &path, const unsigned char (&rgba)[4])
+    {
+        auto pixels = std::make_shared<DecodedImage>();
+        pixels->width = 1;
+        pixels->height = 1;
+        pixels->pixels.assign(rgba, rgba + 4);
+
+        ModelImage image;
+        image.type = type;
+        image.path = path;
+        image.fallback = true;
+        image.pixels = std::move(pixels);
+        data.images.push_back(std::move(image));
+        return static_cast<uint32_t>(data.images.size() - 1);
     }
 
-    for (unsigned int i = 0; i < mesh->mNumFaces; i++)
+    // Binds the decoded textures of one slot; a texture keeps the type of the first slot that bound it
+    void BindSlot(const MaterialRefs &refs, TextureSlot slot, const char *typeName, ImportPlan &plan, ModelImportData &data, std::vector<uint32_t> &out)
     {
-        aiFace face = mesh->mFaces[i];
-        for (unsigned int j = 0; j < face.mNumIndices; j++)
-            indices.push_back(face.mIndices[j]);
+        for (uint32_t index : refs.slots[slot])
+        {
+            TextureRef &ref = plan.textures[index];
+            if (!ref.pixels)
+                continue;
+
+            if (ref.image < 0)
+            {
+                ModelImage image;
+                image.type = typeName;
+                image.path = ref.path;
+                image.pixels = ref.pixels;
+                ref.image = static_cast<int32_t>(data.images.size());
+                data.images.push_back(std::move(image));
+            }
+            out.push_back(static_cast<uint32_t>(ref.image));
+        }
     }
 
-    if (mesh->mMaterialIndex >= 0)
+    void BindTextures(const aiMesh *mesh, const aiScene *scene, ImportPlan &plan, ModelImportData &data, std::vector<uint32_t> &textures)
     {
+        if (mesh->mMaterialIndex >= scene->mNumMaterials)
+            return;
+
         aiMaterial *material = scene->mMaterials[mesh->mMaterialIndex];
+        const MaterialRefs &refs = plan.materials[mesh->mMaterialIndex];
 
-        std::vector<Texture> diffuseMaps = loadMaterialTextures(material, aiTextureType_BASE_COLOR, "texture_diffuse", scene);
-        if (diffuseMaps.empty())
+        size_t before = textures.size();
+        BindSlot(refs, SLOT_BASE_COLOR, "texture_diffuse", plan, data, textures);
+        if (textures.size() == before)
         {
-            diffuseMaps = loadMaterialTextures(material, aiTextureType_DIFFUSE, "texture_diffuse", scene);
+            BindSlot(refs, SLOT_DIFFUSE, "texture_diffuse", plan, data, textures);
 
-            if (diffuseMaps.empty())
+            if (textures.size() == before)
             {
                 aiColor4D color;
                 if (aiGetMaterialColor(material, AI_MATKEY_BASE_COLOR, &color) == AI_SUCCESS ||
                     aiGetMaterialColor(material, AI_MATKEY_COLOR_DIFFUSE, &color) == AI_SUCCESS)
                 {
-                    unsigned char data[4];
-                    data[0] = (unsigned char)(color.r * 255.0f);
-                    data[1] = (unsigned char)(color.g * 255.0f);
-                    data[2] = (unsigned char)(color.b * 255.0f);
-                    data[3] = (unsigned char)(color.a * 255.0f);
-                    unsigned int textureID;
-                    glGenTextures(1, &textureID);
-                    glBindTexture(GL_TEXTURE_2D, textureID);
-                    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
-                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-                    Texture texture;
-                    texture.id = textureID;
-                    texture.type = "texture_diffuse";
-                    texture.path = "INTERNAL_COLOR_FALLBACK";
-                    diffuseMaps.push_back(texture);
+                    unsigned char rgba[4];
+                    rgba[0] = (unsigned char)(color.r * 255.0f);
+                    rgba[1] = (unsigned char)(color.g * 255.0f);
+                    rgba[2] = (unsigned char)(color.b * 255.0f);
+                    rgba[3] = (unsigned char)(color.a * 255.0f);
+                    textures.push_back(AddFallbackImage(data, "texture_diffuse", "INTERNAL_COLOR_FALLBACK", rgba));
                 }
                 else
                 {
-                    unsigned char data[4] = { 255, 255, 255, 255 };
-                    unsigned int textureID;
-                    glGenTextures(1, &textureID);
-                    glBindTexture(GL_TEXTURE_2D, textureID);
-                    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
-                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-                    Texture texture;
-                    texture.id = textureID;
-                    texture.type = "texture_diffuse";
-                    texture.path = "INTERNAL_WHITE_FALLBACK";
-                    diffuseMaps.push_back(texture);
+                    const unsigned char white[4] = {255, 255, 255, 255};
+                    textures.push_back(AddFallbackImage(data, "texture_diffuse", "INTERNAL_WHITE_FALLBACK", white));
                 }
             }
         }
-        textures.insert(textures.end(), diffuseMaps.begin(), diffuseMaps.end());
 
-        std::vector<Texture> specularMaps = loadMaterialTextures(material, aiTextureType_SPECULAR, "texture_specular", scene);
-        if (specularMaps.empty())
+        before = textures.size();
+        BindSlot(refs, SLOT_SPECULAR, "texture_specular", plan, data, textures);
+        if (textures.size() == before)
         {
-            unsigned char data[4] = {255, 255, 255, 255};
-            unsigned int textureID;
-            glGenTextures(1, &textureID);
-            glBindTexture(GL_TEXTURE_2D, textureID);
-            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-            Texture texture;
-            texture.id = textureID;
-            texture.type = "texture_specular";
-            texture.path = "INTERNAL_SPECULAR_FALLBACK";
-            specularMaps.push_back(texture);
+            const unsigned char white[4] = {255, 255, 255, 255};
+            textures.push_back(AddFallbackImage(data, "texture_specular", "INTERNAL_SPECULAR_FALLBACK", white));
         }
-        textures.insert(textures.end(), specularMaps.begin(), specularMaps.end());
 
-        std::vector<Texture> normalMaps = loadMaterialTextures(material, aiTextureType_NORMALS, "texture_normal", scene);
-        if (normalMaps.empty())
+        before = textures.size();
+        BindSlot(refs, SLOT_NORMALS, "texture_normal", plan, data, textures);
+        if (textures.size() == before)
         {
-            normalMaps = loadMaterialTextures(material, aiTextureType_HEIGHT, "texture_normal", scene);
+            BindSlot(refs, SLOT_HEIGHT, "texture_normal", plan, data, textures);
         }
-        textures.insert(textures.end(), normalMaps.begin(), normalMaps.end());
-
-        std::vector<Texture> metallicMaps = loadMaterialTextures(material, aiTextureType_METALNESS, "texture_metallic", scene);
-        textures.insert(textures.end(), metallicMaps.begin(), metallicMaps.end());
 
-        std::vector<Texture> roughnessMaps = loadMaterialTextures(material, aiTextureType_DIFFUSE_ROUGHNESS, "texture_roughness", scene);
-        textures.insert(textures.end(), roughnessMaps.begin(), roughnessMaps.end());
+        BindSlot(refs, SLOT_METALNESS, "texture_metallic", plan, data, textures);
+        BindSlot(refs, SLOT_ROUGHNESS, "texture_roughness", plan, data, textures);
 
-        std::vector<Texture> aoMaps = loadMaterialTextures(material, aiTextureType_AMBIENT_OCCLUSION, "texture_ao", scene);
-
-        if (aoMaps.empty())
-            aoMaps = loadMaterialTextures(material, aiTextureType_LIGHTMAP, "texture_ao", scene);
-        textures.insert(textures.end(), aoMaps.begin(), aoMaps.end());
+        before = textures.size();
+        BindSlot(refs, SLOT_AO, "texture_ao", plan, data, textures);
+        if (textures.size() == before)
+            BindSlot(refs, SLOT_LIGHTMAP, "texture_ao", plan, data, textures);
     }
 
-    ExtractBoneWeightForVertices(vertices, mesh, scene);
-
-    return Mesh(vertices, indices, textures);
-}
-
-void Model::SetVertexBoneData(Vertex &vertex, int boneID, float weight)
-{
-    for (int i = 0; i < MAX_BONE_INFLUENCE; ++i)
+    // Helper threads shared by every import in flight. SceneStream already runs several imports at
+    // once, so letting each take a helper per core would oversubscribe the machine.
+    std::counting_semaphore<> &HelperSlots()
     {
-        if (vertex.m_BoneIDs[i] < 0)
-        {
-            vertex.m_Weights[i] = weight;
-            vertex.m_BoneIDs[i] = boneID;
-            break;
-        }
+        static std::counting_semaphore<> slots((std::max)(1u, std::thread::hardware_concurrency()) - 1);
+        return slots;
     }
-}
 
-void Model::ExtractBoneWeightForVertices(std::vector<Vertex> &vertices, aiMesh *mesh, const aiScene *scene)
-{
-    auto &boneInfoMap = m_BoneInfoMap;
-    int &boneCount = m_BoneCounter;
-
-    for (int boneIndex = 0; boneIndex < mesh->mNumBones; ++boneIndex)
+    // Runs job(0..count-1) on the calling thread plus whatever helpers are free right now
+    void RunJobs(size_t count, const std::function<void(size_t)> &job)
     {
-        int boneID = -1;
-        std::string boneName = mesh->mBones[boneIndex]->mName.C_Str();
-        if (boneInfoMap.find(boneName) == boneInfoMap.end())
-        {
-            BoneInfo newBoneInfo;
-            newBoneInfo.id = boneCount;
-            newBoneInfo.offset = AssimpGLMHelpers::ConvertMatrixToGLMFormat(mesh->mBones[boneIndex]->mOffsetMatrix);
-            boneInfoMap[boneName] = newBoneInfo;
-            boneID = boneCount;
-            boneCount++;
-        }
-        else
+        std::atomic<size_t> next{0};
+        auto worker = [&]()
         {
-            boneID = boneInfoMap[boneName].id;
-        }
-        assert(boneID != -1);
-        auto weights = mesh->mBones[boneIndex]->mWeights;
-        int numWeights = mesh->mBones[boneIndex]->mNumWeights;
+            for (size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1))
+                job(i);
+        };
 
-        for (int weightIndex = 0; weightIndex < numWeights; ++weightIndex)
+        // Declared before the futures, so the slots go back only after the helpers have joined
+        struct SlotGuard
         {
-            int vertexId = weights[weightIndex].mVertexId;
-            float weight = weights[weightIndex].mWeight;
-            if (vertexId < vertices.size())
+            ptrdiff_t held = 0;
+            ~SlotGuard()
             {
-                SetVertexBoneData(vertices[vertexId], boneID, weight);
+                if (held > 0)
+                    HelperSlots().release(held);
             }
-        }
+        } slots;
+
+        while (static_cast<size_t>(slots.held) + 1 < count && HelperSlots().try_acquire())
+            ++slots.held;
+
+        std::vector<std::future<void>> futures;
+        futures.reserve(static_cast<size_t>(slots.held));
+        for (ptrdiff_t i = 0; i < slots.held; ++i)
+            futures.push_back(std::async(std::launch::async, worker));
+
+        worker();
+        for (auto &future : futures)
+            future.get();
     }
 }
 
-unsigned int Model::TextureFromFile(const char *path, const std::string &directory, const aiScene *scene, bool gamma)
+Model::Model(std::string const &path, bool isStatic, bool gamma) : gammaCorrection(gamma)
 {
-    std::string filename = std::string(path);
-    std::replace(filename.begin(), filename.end(), '\\', '/');
-
-    std::string directory_sanitized = directory;
-    std::replace(directory_sanitized.begin(), directory_sanitized.end(), '\\', '/');
+    ModelImportData data;
+    Import(path, isStatic, data);
+    Upload(data);
+}
 
-    std::string pureFilename = filename;
-    size_t lastSlash = filename.find_last_of('/');
-    if (lastSlash != std::string::npos)
-    {
-        pureFilename = filename.substr(lastSlash + 1);
-    }
+Model::Model(ModelImportData &&data) : gammaCorrection(false)
+{
+    Upload(data);
+}
 
-    unsigned int textureID = 0;
+void Model::Upload(ModelImportData &data)
+{
+    AXIS_PROFILE_SCOPE("Model::Upload");
+    auto start = Clock::now();
 
-    int width, height, nrComponents;
-    unsigned char *data = nullptr;
-    bool shouldFree = true;
+    directory = data.directory;
+    m_BoneInfoMap = std::move(data.boneInfoMap);
+    m_BoneCounter = data.boneCount;
 
-    const aiTexture *aiTex = nullptr;
+    for (ModelImage &image : data.images)
+    {
+        if (image.id == 0)
+            UploadImage(image);
+        if (!image.fallback)
+            textures_loaded.push_back({image.id, image.type, image.path});
+    }
 
-    if (filename[0] == '*')
+    meshes.reserve(data.meshes.size());
+    for (ModelMeshData &mesh : data.meshes)
     {
-        try
-        {
-            int id = std::stoi(filename.substr(1));
-            if (id < scene->mNumTextures)
-                aiTex = scene->mTextures[id];
-        }
-        catch (...)
+        std::vector<Texture> textures;
+        textures.reserve(mesh.images.size());
+        for (uint32_t index : mesh.images)
         {
+            const ModelImage &image = data.images[index];
+            textures.push_back({image.id, image.type, image.path});
         }
+        meshes.emplace_back(std::move(mesh.vertices), std::move(mesh.indices), std::move(textures));
     }
 
-    if (!aiTex)
+    if (!meshes.empty())
     {
-        aiTex = scene->GetEmbeddedTexture(path);
+        AABBmin = meshes[0].AABBmin;
+        AABBmax = meshes[0].AABBmax;
+        for (const auto &mesh : meshes)
+        {
+            AABBmin.x = (std::min)(AABBmin.x, mesh.AABBmin.x);
+            AABBmin.y = (std::min)(AABBmin.y, mesh.AABBmin.y);
+            AABBmin.z = (std::min)(AABBmin.z, mesh.AABBmin.z);
+
+            AABBmax.x = (std::max)(AABBmax.x, mesh.AABBmax.x);
+            AABBmax.y = (std::max)(AABBmax.y, mesh.AABBmax.y);
+            AABBmax.z = (std::max)(AABBmax.z, mesh.AABBmax.z);
+        }
     }
-    if (!aiTex)
+
+    loadTimings = data.timings;
+    loadTimings.uploadMs = MsSince(start);
+    if (data.valid)
     {
-        aiTex = scene->GetEmbeddedTexture(pureFilename.c_str());
+        LOGGER_DEBUG("Model") << directory << ": read " << loadTimings.readMs << " ms, gather " << loadTimings.gatherMs
+                              << " ms, jobs " << loadTimings.jobsMs << " ms (meshes " << loadTimings.meshMs << ", decode "
+                              << loadTimings.decodeMs << ", " << loadTimings.decoded << "/" << loadTimings.textures
+                              << " textures decoded), upload " << loadTimings.uploadMs << " ms";
     }
+}
+
+void Model::UploadImage(ModelImage &image)
+{
+    if (!image.pixels)
+        return;
 
-    const int req_comp = 4;
+    const DecodedImage &pixels = *image.pixels;
+    glGenTextures(1, &image.id);
+    glBindTexture(GL_TEXTURE_2D, image.id);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, pixels.width, pixels.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.pixels.data());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
 
-    if (aiTex)
+    if (image.fallback)
     {
-        if (aiTex->mHeight == 0)
-        {
-            data = stbi_load_from_memory(
-                reinterpret_cast<unsigned char *>(aiTex->pcData),
-                aiTex->mWidth,
-                &width, &height, &nrComponents, req_comp);
-            shouldFree = true;
-        }
-        else
-        {
-            data = reinterpret_cast<unsigned char *>(aiTex->pcData);
-            width = aiTex->mWidth;
-            height = aiTex->mHeight;
-            nrComponents = 4;
-            shouldFree = false;
-        }
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
     }
     else
     {
-        std::string fullPath = directory_sanitized + '/' + pureFilename;
-        data = stbi_load(fullPath.c_str(), &width, &height, &nrComponents, req_comp);
-
-        if (!data && filename != pureFilename)
-        {
-            std::string fullPathOriginal = directory_sanitized + '/' + filename;
-            data = stbi_load(fullPathOriginal.c_str(), &width, &height, &nrComponents, req_comp);
-        }
-
-        shouldFree = true;
-    }
-
-    if (data)
-    {
-        glGenTextures(1, &textureID);
-        glBindTexture(GL_TEXTURE_2D, textureID);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
         glGenerateMipmap(GL_TEXTURE_2D);
-
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    }
 
-        if (shouldFree)
+    // The cache holds pixels weakly; the last model to upload them frees them
+    image.pixels.reset();
+}
+
+void Model::ReleaseImages(ModelImportData &data)
+{
+    for (ModelImage &image : data.images)
+    {
+        if (image.id != 0)
         {
-            stbi_image_free(data);
+            glDeleteTextures(1, &image.id);
+            image.id = 0;
         }
     }
-    else
-    {
-        std::string fullPath = directory_sanitized + '/' + pureFilename;
-        std::cout << "[Model] Texture failed to load: " << pureFilename
-                  << " (Tried: " << fullPath << ")" << std::endl;
-        return 0;
-    }
+}
 
-    return textureID;
+void Model::Draw(Shader &shader)
+{
+    for (unsigned int i = 0; i < meshes.size(); i++)
+        meshes[i].Draw(shader);
 }
 
-std::vector<Texture> Model::loadMaterialTextures(aiMaterial *mat, aiTextureType type, std::string typeName, const aiScene *scene)
+void Model::DrawInstanced(Shader &shader, unsigned int instanceBuffer, uint32_t bufferGeneration, size_t byteOffset, size_t count)
 {
-    std::vector<Texture> textures;
-    for (unsigned int i = 0; i < mat->GetTextureCount(type); i++)
-    {
-        aiString str;
-        mat->GetTexture(type, i, &str);
+    for (unsigned int i = 0; i < meshes.size(); i++)
+        meshes[i].DrawInstanced(shader, instanceBuffer, bufferGeneration, byteOffset, count);
+}
 
-        std::string rawPath = str.C_Str();
-        std::replace(rawPath.begin(), rawPath.end(), '\\', '/');
+std::unordered_map<std::string, BoneInfo> &Model::GetBoneInfoMap() { return m_BoneInfoMap; }
+int &Model::GetBoneCount() { return m_BoneCounter; }
 
-        std::string filename = rawPath;
-        size_t lastSlash = rawPath.find_last_of('/');
-        if (lastSlash != std::string::npos)
-        {
-            filename = rawPath.substr(lastSlash + 1);
-        }
+bool Model::Import(std::string const &path, bool isStatic, ModelImportData &data)
+{
+    AXIS_PROFILE_SCOPE("Model::Import");
+    auto start = Clock::now();
 
-        bool skip = false;
-        for (unsigned int j = 0; j < textures_loaded.size(); j++)
-        {
-            std::string loadedName = textures_loaded[j].path;
+    Assimp::Importer importer;
 
-            std::replace(loadedName.begin(), loadedName.end(), '\\', '/');
-            size_t ls = loadedName.find_last_of('/');
-            if (ls != std::string::npos)
-                loadedName = loadedName.substr(ls + 1);
+    unsigned int flags = aiProcess_Triangulate |
+                         aiProcess_GenSmoothNormals |
+                         aiProcess_CalcTangentSpace |
+                         aiProcess_FlipUVs;
 
-            if (filename == loadedName)
-            {
-                textures.push_back(textures_loaded[j]);
-                skip = true;
-                break;
-            }
-        }
+    if (isStatic)
+    {
+        flags |= aiProcess_PreTransformVertices;
+    }
+
+    const aiScene *scene = nullptr;
+    {
+        AXIS_PROFILE_SCOPE("Model::Import::Read");
+        scene = importer.ReadFile(path, flags);
+    }
+    data.timings.readMs = MsSince(start);
+
+    if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode)
+    {
+        LOGGER_ERROR("Model") << "ASSIMP: " << importer.GetErrorString();
+        return false;
+    }
+
+    data.directory = path.substr(0, path.find_last_of('/'));
 
-        if (!skip)
+    // Gather: cheap serial passes that leave the parallel jobs nothing shared to write
+    start = Clock::now();
+    ImportPlan plan;
+    {
+        AXIS_PROFILE_SCOPE("Model::Import::Gather");
+        CollectMeshes(scene->mRootNode, scene, plan);
+        AssignBoneIds(plan, data);
+        GatherTextures(path, Sanitize(data.directory), scene, plan);
+        ImageDecodeCache::Instance().Trim();
+    }
+    data.timings.gatherMs = MsSince(start);
+
+    // Jobs: one per distinct texture, then one per mesh. Textures go first as they are the slow ones
+    start = Clock::now();
+    data.meshes.resize(plan.meshes.size());
+    std::atomic<int64_t> meshNs{0};
+    std::atomic<int64_t> decodeNs{0};
+    std::atomic<int> decoded{0};
+    {
+        AXIS_PROFILE_SCOPE("Model::Import::Jobs");
+        size_t textureCount = plan.textures.size();
+        RunJobs(textureCount + plan.meshes.size(), [&](size_t i)
         {
-            unsigned int id = TextureFromFile(str.C_Str(), this->directory, scene);
-            if (id != 0)
+            auto jobStart = Clock::now();
+            if (i < textureCount)
             {
-                Texture texture;
-                texture.id = id;
-                texture.type = typeName;
-                texture.path = str.C_Str();
-                textures.push_back(texture);
-                textures_loaded.push_back(texture);
+                AXIS_PROFILE_SCOPE("Model::Import::Decode");
+                TextureRef &ref = plan.textures[i];
+                bool ran = false;
+                ref.pixels = ImageDecodeCache::Instance().Decode(ref.key, [&ref](DecodedImage &image)
+                                                                 { return DecodeTexture(ref, image); }, &ran);
+                if (ran)
+                {
+                    ++decoded;
+                    decodeNs += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - jobStart).count();
+                }
             }
-        }
+            else
+            {
+                AXIS_PROFILE_SCOPE("Model::Import::Mesh");
+                size_t m = i - textureCount;
+                BuildMesh(plan.meshes[m], plan.boneIds[m], data.meshes[m]);
+                meshNs += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - jobStart).count();
+            }
+        });
     }
-
-    return textures;
-}
\ No newline at end of file
+    data.timings.jobsMs = MsSince(start);
+    data.timings.meshMs = static_cast<float>(meshNs.load()) / 1.0e6f;
+    data.timings.decodeMs = static_cast<float>(decodeNs.load()) / 1.0e6f;
+    data.timings.textures = static_cast<int>(plan.textures.size());
+    data.timings.decoded = decoded.load();
+
+    // Bind in mesh order, so image indices and fallbacks come out as a serial walk would make them
+    for (size_t m = 0; m < plan.meshes.size(); ++m)
+        BindTextures(plan.meshes[m], scene, plan, data, data.meshes[m].images);
+
+    data.valid = true;
+    return true;
+}
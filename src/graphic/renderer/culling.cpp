@@ -0,0 +1,209 @@
+#include <graphic/renderer/culling.h>
+#include <graphic/renderer/frustum.h>
+#include <scene/dynamic_aabb_tree.h>
+#include <algorithm>
+
+#if defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
+#define AXIS_CULL_AVX2 1
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AXIS_CULL_SSE 1
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+    constexpr size_t LANE_PADDING = 8;
+
+    inline void ClearLanes(VisibilityBits &bits, size_t first, uint32_t culledMask)
+    {
+        bits[first >> 6] &= ~(static_cast<uint64_t>(culledMask) << (first & 63));
+    }
+
+    struct PlaneSelect
+    {
+        float nx, ny, nz, d;
+        bool maxX, maxY, maxZ;
+    };
+
+    void GatherPlanes(const Frustum &frustum, PlaneSelect (&out)[6])
+    {
+        for (int p = 0; p < 6; ++p)
+        {
+            const Plane &plane = frustum.GetPlane(p);
+            out[p] = {plane.normal.x, plane.normal.y, plane.normal.z, plane.distance,
+                      plane.normal.x >= 0.0f, plane.normal.y >= 0.0f, plane.normal.z >= 0.0f};
+        }
+    }
+}
+
+void BoundsSoA::Resize(size_t size)
+{
+    count = size;
+    size_t padded = (size + LANE_PADDING - 1) / LANE_PADDING * LANE_PADDING;
+    for (auto *lane : {&minX, &minY, &minZ, &maxX, &maxY, &maxZ})
+        lane->assign(padded, 0.0f);
+}
+
+void BoundsSoA::Set(size_t index, const glm::vec3 &min, const glm::vec3 &max)
+{
+    minX[index] = min.x;
+    minY[index] = min.y;
+    minZ[index] = min.z;
+    maxX[index] = max.x;
+    maxY[index] = max.y;
+    maxZ[index] = max.z;
+}
+
+namespace Culling
+{
+    void SetAll(size_t count, VisibilityBits &bits)
+    {
+        bits.assign((count + 63) / 64, ~0ull);
+        if (count & 63)
+            bits.back() = (1ull << (count & 63)) - 1;
+    }
+
+    // A box is outside when its vertex farthest along the plane normal is still behind the plane
+    void FrustumCull(const Frustum &frustum, const BoundsSoA &bounds, VisibilityBits &bits)
+    {
+        PlaneSelect planes[6];
+        GatherPlanes(frustum, planes);
+
+#if AXIS_CULL_AVX2
+        for (size_t i = 0; i < bounds.count; i += 8)
+        {
+            __m256 mnx = _mm256_loadu_ps(&bounds.minX[i]);
+            __m256 mny = _mm256_loadu_ps(&bounds.minY[i]);
+            __m256 mnz = _mm256_loadu_ps(&bounds.minZ[i]);
+            __m256 mxx = _mm256_loadu_ps(&bounds.maxX[i]);
+            __m256 mxy = _mm256_loadu_ps(&bounds.maxY[i]);
+            __m256 mxz = _mm256_loadu_ps(&bounds.maxZ[i]);
+
+            __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+            for (const PlaneSelect &plane : planes)
+            {
+                __m256 dist = _mm256_fmadd_ps(plane.maxX ? mxx : mnx, _mm256_set1_ps(plane.nx), _mm256_set1_ps(plane.d));
+                dist = _mm256_fmadd_ps(plane.maxY ? mxy : mny, _mm256_set1_ps(plane.ny), dist);
+                dist = _mm256_fmadd_ps(plane.maxZ ? mxz : mnz, _mm256_set1_ps(plane.nz), dist);
+                inside = _mm256_and_ps(inside, _mm256_cmp_ps(dist, _mm256_setzero_ps(), _CMP_GE_OQ));
+            }
+
+            uint32_t culled = ~static_cast<uint32_t>(_mm256_movemask_ps(inside)) & 0xFFu;
+            if (culled)
+                ClearLanes(bits, i, culled);
+        }
+#elif AXIS_CULL_SSE
+        for (size_t i = 0; i < bounds.count; i += 4)
+        {
+            __m128 mnx = _mm_loadu_ps(&bounds.minX[i]);
+            __m128 mny = _mm_loadu_ps(&bounds.minY[i]);
+            __m128 mnz = _mm_loadu_ps(&bounds.minZ[i]);
+            __m128 mxx = _mm_loadu_ps(&bounds.maxX[i]);
+            __m128 mxy = _mm_loadu_ps(&bounds.maxY[i]);
+            __m128 mxz = _mm_loadu_ps(&bounds.maxZ[i]);
+
+            __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+            for (const PlaneSelect &plane : planes)
+            {
+                __m128 dist = _mm_add_ps(_mm_mul_ps(plane.maxX ? mxx : mnx, _mm_set1_ps(plane.nx)), _mm_set1_ps(plane.d));
+                dist = _mm_add_ps(dist, _mm_mul_ps(plane.maxY ? mxy : mny, _mm_set1_ps(plane.ny)));
+                dist = _mm_add_ps(dist, _mm_mul_ps(plane.maxZ ? mxz : mnz, _mm_set1_ps(plane.nz)));
+                inside = _mm_and_ps(inside, _mm_cmpge_ps(dist, _mm_setzero_ps()));
+            }
+
+            uint32_t culled = ~static_cast<uint32_t>(_mm_movemask_ps(inside)) & 0xFu;
+            if (culled)
+                ClearLanes(bits, i, culled);
+        }
+#else
+        for (size_t i = 0; i < bounds.count; ++i)
+        {
+            for (const PlaneSelect &plane : planes)
+            {
+                float px = plane.maxX ? bounds.maxX[i] : bounds.minX[i];
+                float py = plane.maxY ? bounds.maxY[i] : bounds.minY[i];
+                float pz = plane.maxZ ? bounds.maxZ[i] : bounds.minZ[i];
+                if (plane.nx * px + plane.ny * py + plane.nz * pz + plane.d < 0.0f)
+                {
+                    ClearLanes(bits, i, 1u);
+                    break;
+                }
+            }
+        }
+#endif
+    }
+
+    void DistanceCull(const glm::vec3 &point, float maxDistanceSq, const BoundsSoA &bounds, VisibilityBits &bits)
+    {
+#if AXIS_CULL_AVX2
+        __m256 cx = _mm256_set1_ps(point.x);
+        __m256 cy = _mm256_set1_ps(point.y);
+        __m256 cz = _mm256_set1_ps(point.z);
+        __m256 limit = _mm256_set1_ps(maxDistanceSq);
+        __m256 zero = _mm256_setzero_ps();
+
+        for (size_t i = 0; i < bounds.count; i += 8)
+        {
+            __m256 dx = _mm256_max_ps(_mm256_sub_ps(_mm256_loadu_ps(&bounds.minX[i]), cx), _mm256_max_ps(zero, _mm256_sub_ps(cx, _mm256_loadu_ps(&bounds.maxX[i]))));
+            __m256 dy = _mm256_max_ps(_mm256_sub_ps(_mm256_loadu_ps(&bounds.minY[i]), cy), _mm256_max_ps(zero, _mm256_sub_ps(cy, _mm256_loadu_ps(&bounds.maxY[i]))));
+            __m256 dz = _mm256_max_ps(_mm256_sub_ps(_mm256_loadu_ps(&bounds.minZ[i]), cz), _mm256_max_ps(zero, _mm256_sub_ps(cz, _mm256_loadu_ps(&bounds.maxZ[i]))));
+
+            __m256 distSq = _mm256_fmadd_ps(dx, dx, _mm256_fmadd_ps(dy, dy, _mm256_mul_ps(dz, dz)));
+            uint32_t culled = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(distSq, limit, _CMP_GT_OQ)));
+            if (culled)
+                ClearLanes(bits, i, culled);
+        }
+#elif AXIS_CULL_SSE
+        __m128 cx = _mm_set1_ps(point.x);
+        __m128 cy = _mm_set1_ps(point.y);
+        __m128 cz = _mm_set1_ps(point.z);
+        __m128 limit = _mm_set1_ps(maxDistanceSq);
+        __m128 zero = _mm_setzero_ps();
+
+        for (size_t i = 0; i < bounds.count; i += 4)
+        {
+            __m128 dx = _mm_max_ps(_mm_sub_ps(_mm_loadu_ps(&bounds.minX[i]), cx), _mm_max_ps(zero, _mm_sub_ps(cx, _mm_loadu_ps(&bounds.maxX[i]))));
+            __m128 dy = _mm_max_ps(_mm_sub_ps(_mm_loadu_ps(&bounds.minY[i]), cy), _mm_max_ps(zero, _mm_sub_ps(cy, _mm_loadu_ps(&bounds.maxY[i]))));
+            __m128 dz = _mm_max_ps(_mm_sub_ps(_mm_loadu_ps(&bounds.minZ[i]), cz), _mm_max_ps(zero, _mm_sub_ps(cz, _mm_loadu_ps(&bounds.maxZ[i]))));
+
+            __m128 distSq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_add_ps(_mm_mul_ps(dy, dy), _mm_mul_ps(dz, dz)));
+            uint32_t culled = static_cast<uint32_t>(_mm_movemask_ps(_mm_cmpgt_ps(distSq, limit)));
+            if (culled)
+                ClearLanes(bits, i, culled);
+        }
+#else
+        for (size_t i = 0; i < bounds.count; ++i)
+        {
+            float dx = (std::max)(bounds.minX[i] - point.x, (std::max)(0.0f, point.x - bounds.maxX[i]));
+            float dy = (std::max)(bounds.minY[i] - point.y, (std::max)(0.0f, point.y - bounds.maxY[i]));
+            float dz = (std::max)(bounds.minZ[i] - point.z, (std::max)(0.0f, point.z - bounds.maxZ[i]));
+            if (dx * dx + dy * dy + dz * dz > maxDistanceSq)
+                ClearLanes(bits, i, 1u);
+        }
+#endif
+    }
+
+    void HierarchicalCull(const DynamicAABBTree &tree, const Frustum &frustum, const glm::vec3 &point, float maxDistanceSq,
+                          size_t count, VisibilityBits &bits)
+    {
+        bits.assign((count + 63) / 64, 0ull);
+        tree.QueryFrustum(frustum, point, maxDistanceSq, [&](int32_t proxyId)
+        {
+            uint32_t index = tree.GetUserData(proxyId);
+            if (index < count)
+                bits[index >> 6] |= 1ull << (index & 63);
+        });
+    }
+
+    const char *GetKernelName()
+    {
+#if AXIS_CULL_AVX2
+        return "AVX2";
+#elif AXIS_CULL_SSE
+        return "SSE2";
+#else
+        return "Scalar";
+#endif
+    }
+}
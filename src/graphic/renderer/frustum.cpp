@@ -63,3 +63,35 @@ bool Frustum::IsBoxVisible(const glm::vec3 &min, const glm::vec3 &max) const
     }
     return true;
 }
+
+FrustumResult Frustum::ClassifyBox(const glm::vec3 &min, const glm::vec3 &max) const
+{
+    FrustumResult result = FrustumResult::Inside;
+    for (int i = 0; i < 6; ++i)
+    {
+        glm::vec3 p = min;
+        glm::vec3 n = max;
+        if (planes[i].normal.x >= 0)
+        {
+            p.x = max.x;
+            n.x = min.x;
+        }
+        if (planes[i].normal.y >= 0)
+        {
+            p.y = max.y;
+            n.y = min.y;
+        }
+        if (planes[i].normal.z >= 0)
+        {
+            p.z = max.z;
+            n.z = min.z;
+        }
+
+        if (glm::dot(planes[i].normal, p) + planes[i].distance < 0)
+            return FrustumResult::Outside;
+
+        if (glm::dot(planes[i].normal, n) + planes[i].distance < 0)
+            result = FrustumResult::Intersect;
+    }
+    return result;
+}
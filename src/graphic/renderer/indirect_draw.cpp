@@ -0,0 +1,95 @@
+#include <graphic/renderer/indirect_draw.h>
+#include <algorithm>
+
+void IndirectCommandBuilder::Reset()
+{
+    m_Runs.clear();
+    m_Instances.clear();
+    m_Pending.clear();
+    m_Commands.clear();
+    m_Batches.clear();
+}
+
+void IndirectCommandBuilder::Add(uint64_t stateKey, uint32_t modelId, const ArenaMeshRange *meshes, uint32_t meshCount,
+                                 const glm::mat4 &world, uint32_t userData)
+{
+    if (!m_Runs.empty())
+    {
+        Run &last = m_Runs.back();
+        if (last.stateKey == stateKey && last.modelId == modelId)
+        {
+            ++last.instanceCount;
+            m_Instances.push_back(world);
+            return;
+        }
+    }
+
+    m_Runs.push_back({stateKey, modelId, meshes, meshCount, static_cast<uint32_t>(m_Instances.size()), 1, userData});
+    m_Instances.push_back(world);
+}
+
+size_t IndirectCommandBuilder::CountCommands() const
+{
+    size_t count = 0;
+    for (const Run &run : m_Runs)
+    {
+        for (uint32_t i = 0; i < run.meshCount; ++i)
+        {
+            if (run.meshes[i].indexCount != 0)
+                ++count;
+        }
+    }
+    return count;
+}
+
+void IndirectCommandBuilder::Finish(uint32_t baseInstance)
+{
+    m_Pending.clear();
+    m_Commands.clear();
+    m_Batches.clear();
+
+    for (const Run &run : m_Runs)
+    {
+        for (uint32_t i = 0; i < run.meshCount; ++i)
+        {
+            const ArenaMeshRange &mesh = run.meshes[i];
+            if (mesh.indexCount == 0)
+                continue;
+
+            DrawElementsIndirectCommand command;
+            command.count = mesh.indexCount;
+            command.instanceCount = run.instanceCount;
+            command.firstIndex = mesh.firstIndex;
+            command.baseVertex = mesh.baseVertex;
+            command.baseInstance = baseInstance + run.firstInstance;
+            m_Pending.push_back({run.stateKey, mesh.textureKey, mesh.meshId, run.userData, command});
+        }
+    }
+
+    // Stable, so commands inside a batch keep the queue's front-to-back order
+    std::stable_sort(m_Pending.begin(), m_Pending.end(), [](const PendingCommand &a, const PendingCommand &b)
+    {
+        if (a.stateKey != b.stateKey)
+            return a.stateKey < b.stateKey;
+        return a.textureKey < b.textureKey;
+    });
+
+    m_Commands.reserve(m_Pending.size());
+    for (const PendingCommand &pending : m_Pending)
+    {
+        bool newBatch = m_Batches.empty() || m_Batches.back().stateKey != pending.stateKey || m_Batches.back().textureKey != pending.textureKey;
+        if (newBatch)
+        {
+            IndirectBatch batch;
+            batch.stateKey = pending.stateKey;
+            batch.textureKey = pending.textureKey;
+            batch.meshId = pending.meshId;
+            batch.userData = pending.userData;
+            batch.firstCommand = static_cast<uint32_t>(m_Commands.size());
+            m_Batches.push_back(batch);
+        }
+
+        m_Commands.push_back(pending.command);
+        ++m_Batches.back().commandCount;
+    }
+}
@@ -16,6 +16,12 @@ void LightRenderer::Init()
 }
 
 void LightRenderer::UploadLightData(Scene &scene, Shader *shader)
+{
+    Upload(scene);
+    Apply(shader);
+}
+
+void LightRenderer::Upload(Scene &scene)
 {
     m_DirLights.clear();
     auto dirView = scene.registry.view<DirectionalLightComponent>();
@@ -127,8 +133,11 @@ void LightRenderer::UploadLightData(Scene &scene, Shader *shader)
     glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_SpotLightSSBO);
     glBufferData(GL_SHADER_STORAGE_BUFFER, m_SpotLights.size() * sizeof(GPUSpotLight), m_SpotLights.data(), GL_DYNAMIC_DRAW);
     glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, m_SpotLightSSBO);
+}
 
-    shader->setInt("numDirLights", (int)m_DirLights.size());
-    shader->setInt("nrPointLights", (int)m_PointLights.size());
-    shader->setInt("nrSpotLights", (int)m_SpotLights.size());
+void LightRenderer::Apply(Shader *shader) const
+{
+    shader->setInt("numDirLights"_uniform, GetDirLightCount());
+    shader->setInt("nrPointLights"_uniform, GetPointLightCount());
+    shader->setInt("nrSpotLights"_uniform, GetSpotLightCount());
 }
@@ -0,0 +1,438 @@
+#include <graphic/renderer/render_queue.h>
+#include <graphic/geometry/model.h>
+#include <ecs/component.h>
+#include <scene/dynamic_aabb_tree.h>
+#include <utils/logger.h>
+#include <utils/profiler.h>
+#include <glm/gtx/norm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+    constexpr uint16_t MAX_INTERNED_ID = 0xFFFF;
+
+    uint64_t HashFloats(uint64_t hash, const float *values, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &values[i], sizeof(bits));
+            hash ^= bits;
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+}
+
+RenderQueue::~RenderQueue()
+{
+    Detach();
+}
+
+void RenderQueue::Attach(entt::registry &registry, DynamicAABBTree *tree)
+{
+    if (m_Registry == &registry && m_Tree == tree)
+        return;
+
+    Detach();
+    m_Registry = &registry;
+    m_Tree = tree;
+    if (m_Tree)
+        m_Tree->Clear();
+
+    registry.on_construct<TransformComponent>().connect<&RenderQueue::OnEntityChanged>(*this);
+    registry.on_destroy<TransformComponent>().connect<&RenderQueue::OnEntityChanged>(*this);
+    registry.on_construct<MeshRendererComponent>().connect<&RenderQueue::OnEntityChanged>(*this);
+    registry.on_update<MeshRendererComponent>().connect<&RenderQueue::OnEntityChanged>(*this);
+    registry.on_destroy<MeshRendererComponent>().connect<&RenderQueue::OnEntityChanged>(*this);
+    registry.on_construct<MaterialComponent>().connect<&RenderQueue::OnEntityChanged>(*this);
+    registry.on_update<MaterialComponent>().connect<&RenderQueue::OnEntityChanged>(*this);
+    registry.on_destroy<MaterialComponent>().connect<&RenderQueue::OnEntityChanged>(*this);
+
+    for (auto entity : registry.view<TransformComponent, MeshRendererComponent>())
+        m_Pending.push_back(entity);
+}
+
+void RenderQueue::Detach()
+{
+    if (!m_Registry)
+        return;
+
+    m_Registry->on_construct<TransformComponent>().disconnect(this);
+    m_Registry->on_destroy<TransformComponent>().disconnect(this);
+    m_Registry->on_construct<MeshRendererComponent>().disconnect(this);
+    m_Registry->on_update<MeshRendererComponent>().disconnect(this);
+    m_Registry->on_destroy<MeshRendererComponent>().disconnect(this);
+    m_Registry->on_construct<MaterialComponent>().disconnect(this);
+    m_Registry->on_update<MaterialComponent>().disconnect(this);
+    m_Registry->on_destroy<MaterialComponent>().disconnect(this);
+
+    if (m_Tree)
+        m_Tree->Clear();
+
+    m_Registry = nullptr;
+    m_Tree = nullptr;
+    m_Items.clear();
+    m_Pending.clear();
+    m_ItemIndices.clear();
+    m_Bounds.Resize(0);
+    m_ShaderIds.clear();
+    m_ModelIds.clear();
+    m_MaterialIds.clear();
+    m_HasDepthOrigin = false;
+}
+
+void RenderQueue::OnEntityChanged(entt::registry &, entt::entity entity)
+{
+    m_Pending.push_back(entity);
+}
+
+void RenderQueue::Update(const glm::vec3 &cameraPos, const std::vector<entt::entity> *moved)
+{
+    if (!m_Registry)
+        return;
+
+    AXIS_PROFILE_SCOPE("RenderQueue::Update");
+
+    entt::registry &registry = *m_Registry;
+
+    float halfBucket = m_DepthBucketSize * 0.5f;
+    bool refreshDepth = !m_HasDepthOrigin || glm::distance2(cameraPos, m_DepthOrigin) > halfBucket * halfBucket;
+    if (refreshDepth)
+    {
+        m_DepthOrigin = cameraPos;
+        m_HasDepthOrigin = true;
+    }
+
+    m_Changed.clear();
+    m_Rekeyed.clear();
+
+    std::sort(m_Pending.begin(), m_Pending.end());
+    m_Pending.erase(std::unique(m_Pending.begin(), m_Pending.end()), m_Pending.end());
+    auto isPending = [&](entt::entity entity)
+    { return std::binary_search(m_Pending.begin(), m_Pending.end(), entity); };
+
+    // Items that keep their key stay in place and only have their SoA bounds rewritten
+    auto refresh = [&](uint32_t index)
+    {
+        RenderQueueItem &item = m_Items[index];
+        uint32_t version = item.worldVersion;
+        if (RefreshItem(item, false))
+            m_Rekeyed.push_back(index);
+        else if (item.worldVersion != version)
+            m_Bounds.Set(index, item.worldMin, item.worldMax);
+    };
+
+    if (moved)
+    {
+        for (entt::entity entity : *moved)
+        {
+            uint32_t index = FindItem(entity);
+            if (index != UINT32_MAX && !isPending(entity))
+                refresh(index);
+        }
+    }
+    else
+    {
+        for (uint32_t index = 0; index < m_Items.size(); ++index)
+        {
+            if (!isPending(m_Items[index].entity))
+                refresh(index);
+        }
+    }
+
+    // Depth buckets come from the cached bounds; only items that land in a different bucket are re-keyed
+    if (refreshDepth)
+    {
+        for (uint32_t index = 0; index < m_Items.size(); ++index)
+        {
+            RenderQueueItem &item = m_Items[index];
+            uint64_t key = (item.key & ~0xFFFFull) | GetDepthBucket(item);
+            if (key != item.key)
+            {
+                item.key = key;
+                m_Rekeyed.push_back(index);
+            }
+        }
+    }
+
+    if (!m_Pending.empty() || !m_Rekeyed.empty())
+    {
+        std::sort(m_Rekeyed.begin(), m_Rekeyed.end());
+        m_Rekeyed.erase(std::unique(m_Rekeyed.begin(), m_Rekeyed.end()), m_Rekeyed.end());
+
+        // Untouched items are compacted in place and stay sorted; re-keyed ones move to m_Changed.
+        // Proxies of re-added entities are reused below, the rest are destroyed
+        m_RemovedProxies.clear();
+        auto rekeyed = m_Rekeyed.begin();
+        size_t write = 0;
+        for (size_t i = 0; i < m_Items.size(); ++i)
+        {
+            const RenderQueueItem &item = m_Items[i];
+            bool isRekeyed = rekeyed != m_Rekeyed.end() && *rekeyed == i;
+            if (isRekeyed)
+                ++rekeyed;
+
+            if (isPending(item.entity))
+            {
+                if (item.proxyId >= 0)
+                    m_RemovedProxies.emplace_back(item.entity, item.proxyId);
+                continue;
+            }
+            if (isRekeyed)
+            {
+                m_Changed.push_back(item);
+                continue;
+            }
+            if (write != i)
+                m_Items[write] = item;
+            ++write;
+        }
+        m_Items.resize(write);
+        std::sort(m_RemovedProxies.begin(), m_RemovedProxies.end());
+        m_BoundsDirty = true;
+
+        for (auto entity : m_Pending)
+        {
+            if (!registry.valid(entity))
+                continue;
+
+            if (!registry.all_of<TransformComponent, MeshRendererComponent>(entity))
+            {
+                registry.remove<WorldBoundsComponent>(entity);
+                continue;
+            }
+
+            RenderQueueItem item;
+            item.entity = entity;
+            item.materialId = InternMaterial(entity);
+
+            auto removed = std::lower_bound(m_RemovedProxies.begin(), m_RemovedProxies.end(), std::make_pair(entity, int32_t(-1)));
+            if (removed != m_RemovedProxies.end() && removed->first == entity)
+            {
+                item.proxyId = removed->second;
+                removed->second = -1;
+            }
+
+            RefreshItem(item, true);
+            m_Changed.push_back(item);
+        }
+        m_Pending.clear();
+
+        for (const auto &[entity, proxyId] : m_RemovedProxies)
+        {
+            if (proxyId >= 0 && m_Tree)
+                m_Tree->DestroyProxy(proxyId);
+        }
+        m_RemovedProxies.clear();
+    }
+
+    m_LastChangedCount = m_Changed.size();
+    if (!m_Changed.empty())
+    {
+        RadixSort(m_Changed, m_Scratch);
+
+        m_Scratch.resize(m_Items.size() + m_Changed.size());
+        std::merge(m_Items.begin(), m_Items.end(), m_Changed.begin(), m_Changed.end(), m_Scratch.begin(),
+                   [](const RenderQueueItem &lhs, const RenderQueueItem &rhs)
+                   { return lhs.key < rhs.key; });
+        m_Items.swap(m_Scratch);
+    }
+
+    if (m_BoundsDirty || m_Bounds.count != m_Items.size())
+    {
+        m_Bounds.Resize(m_Items.size());
+        std::fill(m_ItemIndices.begin(), m_ItemIndices.end(), UINT32_MAX);
+        for (size_t i = 0; i < m_Items.size(); ++i)
+        {
+            const RenderQueueItem &item = m_Items[i];
+            m_Bounds.Set(i, item.worldMin, item.worldMax);
+            if (m_Tree && item.proxyId >= 0)
+                m_Tree->SetUserData(item.proxyId, static_cast<uint32_t>(i));
+
+            size_t entityIndex = entt::to_entity(item.entity);
+            if (entityIndex >= m_ItemIndices.size())
+                m_ItemIndices.resize(entityIndex + 1, UINT32_MAX);
+            m_ItemIndices[entityIndex] = static_cast<uint32_t>(i);
+        }
+        m_BoundsDirty = false;
+    }
+}
+
+uint32_t RenderQueue::FindItem(entt::entity entity) const
+{
+    size_t entityIndex = entt::to_entity(entity);
+    if (entityIndex >= m_ItemIndices.size())
+        return UINT32_MAX;
+
+    uint32_t index = m_ItemIndices[entityIndex];
+    if (index >= m_Items.size() || m_Items[index].entity != entity)
+        return UINT32_MAX;
+    return index;
+}
+
+bool RenderQueue::RefreshItem(RenderQueueItem &item, bool rebuild)
+{
+    const auto &transform = m_Registry->get<TransformComponent>(item.entity);
+    if (rebuild)
+    {
+        const auto &renderer = m_Registry->get<MeshRendererComponent>(item.entity);
+        item.model = renderer.model;
+        item.shader = renderer.shader;
+        item.castShadow = renderer.castShadow;
+    }
+    else if (transform.GetWorldVersion() == item.worldVersion)
+    {
+        return false;
+    }
+
+    item.worldVersion = transform.GetWorldVersion();
+    const glm::mat4 &modelMatrix = transform.GetWorldMatrix();
+
+    glm::vec3 center(0.0f);
+    glm::vec3 extent(0.0f);
+    if (item.model)
+    {
+        center = (item.model->AABBmin + item.model->AABBmax) * 0.5f;
+        extent = (item.model->AABBmax - item.model->AABBmin) * 0.5f;
+    }
+
+    glm::vec3 worldCenter = glm::vec3(modelMatrix * glm::vec4(center, 1.0f));
+
+    glm::mat3 rot = glm::mat3(modelMatrix);
+    glm::vec3 worldExtent = glm::vec3(
+        std::abs(rot[0][0]) * extent.x + std::abs(rot[1][0]) * extent.y + std::abs(rot[2][0]) * extent.z,
+        std::abs(rot[0][1]) * extent.x + std::abs(rot[1][1]) * extent.y + std::abs(rot[2][1]) * extent.z,
+        std::abs(rot[0][2]) * extent.x + std::abs(rot[1][2]) * extent.y + std::abs(rot[2][2]) * extent.z);
+
+    item.worldMin = worldCenter - worldExtent;
+    item.worldMax = worldCenter + worldExtent;
+
+    auto &bounds = m_Registry->get_or_emplace<WorldBoundsComponent>(item.entity);
+    bounds.min = item.worldMin;
+    bounds.max = item.worldMax;
+
+    if (m_Tree)
+    {
+        if (item.proxyId < 0)
+            item.proxyId = m_Tree->CreateProxy(item.worldMin, item.worldMax, item.entity);
+        else
+            m_Tree->MoveProxy(item.proxyId, item.worldMin, item.worldMax);
+    }
+
+    uint64_t state = rebuild ? BuildStateKey(item) : (item.key & ~0xFFFFull);
+    uint64_t key = state | GetDepthBucket(item);
+    bool changed = rebuild || key != item.key;
+    item.key = key;
+    return changed;
+}
+
+uint64_t RenderQueue::BuildStateKey(const RenderQueueItem &item)
+{
+    uint64_t shaderId = item.shader ? InternShader(item.shader) : 0;
+    uint64_t modelId = item.model ? InternModel(item.model) : 0;
+
+    return (shaderId << SHADER_SHIFT) | (static_cast<uint64_t>(item.materialId) << MATERIAL_SHIFT) | (modelId << MODEL_SHIFT);
+}
+
+uint16_t RenderQueue::GetDepthBucket(const RenderQueueItem &item) const
+{
+    glm::vec3 center = (item.worldMin + item.worldMax) * 0.5f;
+    float buckets = glm::distance(center, m_DepthOrigin) / m_DepthBucketSize;
+    return static_cast<uint16_t>((std::min)(buckets, static_cast<float>(MAX_INTERNED_ID)));
+}
+
+uint16_t RenderQueue::InternShader(Shader *shader)
+{
+    auto it = m_ShaderIds.find(shader);
+    if (it != m_ShaderIds.end())
+        return it->second;
+
+    uint16_t id = static_cast<uint16_t>((std::min)(m_ShaderIds.size() + 1, static_cast<size_t>(MAX_INTERNED_ID)));
+    m_ShaderIds.emplace(shader, id);
+    return id;
+}
+
+uint16_t RenderQueue::InternModel(Model *model)
+{
+    auto it = m_ModelIds.find(model);
+    if (it != m_ModelIds.end())
+        return it->second;
+
+    uint16_t id = static_cast<uint16_t>((std::min)(m_ModelIds.size() + 1, static_cast<size_t>(MAX_INTERNED_ID)));
+    m_ModelIds.emplace(model, id);
+    return id;
+}
+
+uint16_t RenderQueue::InternMaterial(entt::entity entity)
+{
+    const auto *mat = m_Registry->try_get<MaterialComponent>(entity);
+    if (!mat)
+        return 0;
+
+    const float values[] = {
+        static_cast<float>(mat->type), mat->roughness, mat->opacity,
+        mat->emission.x, mat->emission.y, mat->emission.z,
+        mat->shininess, mat->specular.x, mat->specular.y, mat->specular.z,
+        mat->ambient.x, mat->ambient.y, mat->ambient.z,
+        mat->metallic, mat->ao,
+        mat->uvScale.x, mat->uvScale.y, mat->uvOffset.x, mat->uvOffset.y};
+
+    uint64_t hash = HashFloats(14695981039346656037ull, values, sizeof(values) / sizeof(values[0]));
+
+    auto it = m_MaterialIds.find(hash);
+    if (it != m_MaterialIds.end())
+        return it->second;
+
+    uint16_t id = static_cast<uint16_t>((std::min)(m_MaterialIds.size() + 1, static_cast<size_t>(MAX_INTERNED_ID)));
+    if (id == MAX_INTERNED_ID)
+        LOGGER_WARN("RenderQueue") << "Material id space exhausted, batching may degrade";
+    m_MaterialIds.emplace(hash, id);
+    return id;
+}
+
+// LSD radix sort over the 64-bit key, 8 bits per pass; passes where every key shares the digit are skipped
+void RenderQueue::RadixSort(std::vector<RenderQueueItem> &items, std::vector<RenderQueueItem> &scratch)
+{
+    if (items.size() < 2)
+        return;
+
+    if (items.size() <= 64)
+    {
+        std::stable_sort(items.begin(), items.end(), [](const RenderQueueItem &lhs, const RenderQueueItem &rhs)
+                         { return lhs.key < rhs.key; });
+        return;
+    }
+
+    scratch.resize(items.size());
+    std::vector<RenderQueueItem> *src = &items;
+    std::vector<RenderQueueItem> *dst = &scratch;
+
+    for (uint32_t shift = 0; shift < 64; shift += 8)
+    {
+        size_t counts[256] = {};
+        for (const auto &item : *src)
+            ++counts[(item.key >> shift) & 0xFF];
+
+        if (counts[((*src)[0].key >> shift) & 0xFF] == src->size())
+            continue;
+
+        size_t offset = 0;
+        for (size_t &count : counts)
+        {
+            size_t c = count;
+            count = offset;
+            offset += c;
+        }
+
+        for (const auto &item : *src)
+            (*dst)[counts[(item.key >> shift) & 0xFF]++] = item;
+
+        std::swap(src, dst);
+    }
+
+    if (src != &items)
+        items.swap(scratch);
+}
@@ -24,7 +24,54 @@ void ShadowRenderer::Shutdown()
     m_Shadow.Shutdown();
 }
 
-void ShadowRenderer::RenderShadows(Scene &scene)
+void ShadowRenderer::ApplySkinning(Shader *shader, Scene &scene, entt::entity entity)
+{
+    if (const AnimationComponent *anim = scene.registry.try_get<AnimationComponent>(entity); anim && anim->animator)
+    {
+        const std::vector<glm::mat4> &transforms = anim->animator->GetFinalBoneMatrices();
+        shader->setMat4Array("finalBonesMatrices[0]"_uniform, transforms.data(), (std::min)(static_cast<int>(transforms.size()), GPUSkinningData::MAX_BONES));
+        shader->setBool("hasAnimation"_uniform, true);
+    }
+    else if (const BakedAnimationComponent *baked = scene.registry.try_get<BakedAnimationComponent>(entity); baked && baked->baked)
+    {
+        // Nearest baked frame from the CPU copy; shadow passes draw casters one by one anyway
+        const glm::mat4 *palette = baked->baked->GetPalette(baked->clip, baked->time);
+        shader->setMat4Array("finalBonesMatrices[0]"_uniform, palette, (std::min)(baked->baked->GetBoneCount(), GPUSkinningData::MAX_BONES));
+        shader->setBool("hasAnimation"_uniform, true);
+    }
+    else
+    {
+        shader->setBool("hasAnimation"_uniform, false);
+    }
+}
+
+void ShadowRenderer::CullShadowCasters(const RenderQueue &queue, const DynamicAABBTree *tree, const Frustum *lightFrustum, const glm::vec3 &camPos)
+{
+    const BoundsSoA &bounds = queue.GetBounds();
+    if (tree && lightFrustum)
+    {
+        Culling::HierarchicalCull(*tree, *lightFrustum, camPos, m_ShadowDistanceCullingSq, bounds.count, m_Visibility);
+    }
+    else
+    {
+        Culling::SetAll(bounds.count, m_Visibility);
+
+        if (lightFrustum)
+            Culling::FrustumCull(*lightFrustum, bounds, m_Visibility);
+
+        if (m_ShadowDistanceCullingSq > 0.0f)
+            Culling::DistanceCull(camPos, m_ShadowDistanceCullingSq, bounds, m_Visibility);
+    }
+
+    const auto &items = queue.GetItems();
+    Culling::ForEachVisible(m_Visibility, [&](size_t index)
+    {
+        if (!items[index].model || !items[index].castShadow)
+            m_Visibility[index >> 6] &= ~(1ull << (index & 63));
+    });
+}
+
+void ShadowRenderer::RenderShadows(Scene &scene, const RenderQueue &queue)
 {
     if (m_ShadowMode == 0)
         return;
@@ -64,6 +111,8 @@ void ShadowRenderer::RenderShadows(Scene &scene)
         }
     }
 
+    const DynamicAABBTree *spatialTree = m_HierarchicalCulling ? &scene.GetSpatialTree() : nullptr;
+
     glm::vec3 camPos(0.0f);
     entt::entity camEntity = scene.GetActiveCamera();
     if (camEntity != entt::null)
@@ -102,76 +151,23 @@ void ShadowRenderer::RenderShadows(Scene &scene)
         glClear(GL_DEPTH_BUFFER_BIT);
 
         shaderDir->use();
-        shaderDir->setMat4("lightSpaceMatrix", m_LightSpaceMatrixDir[lightIdx]);
-
-        auto view = scene.registry.view<TransformComponent, MeshRendererComponent>();
-        for (auto entity : view)
-        {
-            auto [trans, renderer] = view.get<TransformComponent, MeshRendererComponent>(entity);
-
-            if (!renderer.model || !renderer.castShadow)
-                continue;
-
-            glm::mat4 modelMatrix = trans.GetWorldModelMatrix(scene.registry);
-            glm::vec3 min = renderer.model->AABBmin;
-            glm::vec3 max = renderer.model->AABBmax;
-
-            glm::vec3 center = (min + max) * 0.5f;
-            glm::vec3 extent = (max - min) * 0.5f;
-
-            glm::vec3 worldCenter = glm::vec3(modelMatrix * glm::vec4(center, 1.0f));
-
-            glm::mat3 rot = glm::mat3(modelMatrix);
-            glm::vec3 worldExtent = glm::vec3(
-                std::abs(rot[0][0]) * extent.x + std::abs(rot[1][0]) * extent.y + std::abs(rot[2][0]) * extent.z,
-                std::abs(rot[0][1]) * extent.x + std::abs(rot[1][1]) * extent.y + std::abs(rot[2][1]) * extent.z,
-                std::abs(rot[0][2]) * extent.x + std::abs(rot[1][2]) * extent.y + std::abs(rot[2][2]) * extent.z);
+        shaderDir->setMat4("lightSpaceMatrix"_uniform, m_LightSpaceMatrixDir[lightIdx]);
 
-            glm::vec3 worldMin = worldCenter - worldExtent;
-            glm::vec3 worldMax = worldCenter + worldExtent;
+        CullShadowCasters(queue, spatialTree, m_ShadowFrustumCullingEnabled ? &lightFrustum : nullptr, camPos);
 
-            if (m_ShadowDistanceCullingSq > 0.0f)
-            {
-                float dx = (std::max)(worldMin.x - camPos.x, (std::max)(0.0f, camPos.x - worldMax.x));
-                float dy = (std::max)(worldMin.y - camPos.y, (std::max)(0.0f, camPos.y - worldMax.y));
-                float dz = (std::max)(worldMin.z - camPos.z, (std::max)(0.0f, camPos.z - worldMax.z));
-                
-                float distSq = dx*dx + dy*dy + dz*dz;
-                
-                if (distSq > m_ShadowDistanceCullingSq)
-                    continue;
-            }
-
-            if (m_ShadowFrustumCullingEnabled)
-            {
-                if (!lightFrustum.IsBoxVisible(worldMin, worldMax))
-                    continue;
-            }
+        const auto &items = queue.GetItems();
+        Culling::ForEachVisible(m_Visibility, [&](size_t index)
+        {
+            const RenderQueueItem &item = items[index];
+            entt::entity entity = item.entity;
+            auto &trans = scene.registry.get<TransformComponent>(entity);
 
-            shaderDir->setMat4("model", trans.GetWorldModelMatrix(scene.registry));
+            shaderDir->setMat4("model"_uniform, trans.GetWorldMatrix());
 
-            if (scene.registry.all_of<AnimationComponent>(entity))
-            {
-                auto &anim = scene.registry.get<AnimationComponent>(entity);
-                if (anim.animator)
-                {
-                    auto transforms = anim.animator->GetFinalBoneMatrices();
-                    for (int j = 0; j < transforms.size() && j < 100; ++j)
-                        shaderDir->setMat4("finalBonesMatrices[" + std::to_string(j) + "]", transforms[j]);
-                    shaderDir->setBool("hasAnimation", true);
-                }
-                else
-                {
-                    shaderDir->setBool("hasAnimation", false);
-                }
-            }
-            else
-            {
-                shaderDir->setBool("hasAnimation", false);
-            }
+            ApplySkinning(shaderDir, scene, entity);
 
-            renderer.model->Draw(*shaderDir);
-        }
+            item.model->Draw(*shaderDir);
+        });
     }
 
     m_Shadow.UnbindFBO();
@@ -219,8 +215,7 @@ void ShadowRenderer::RenderShadows(Scene &scene)
         shadowTransforms.push_back(shadowProj * glm::lookAt(lightPos, lightPos + glm::vec3(0.0, 0.0, 1.0), glm::vec3(0.0, -1.0, 0.0)));
         shadowTransforms.push_back(shadowProj * glm::lookAt(lightPos, lightPos + glm::vec3(0.0, 0.0, -1.0), glm::vec3(0.0, -1.0, 0.0)));
 
-        for (int i = 0; i < 6; ++i)
-            shaderPoint->setMat4("shadowMatrices[" + std::to_string(i) + "]", shadowTransforms[i]);
+        shaderPoint->setMat4Array("shadowMatrices[0]"_uniform, shadowTransforms.data(), 6);
 
         shaderPoint->setFloat("farPlane", farP);
         shaderPoint->setVec3("lightPos", lightPos);
@@ -228,33 +223,15 @@ void ShadowRenderer::RenderShadows(Scene &scene)
         m_Shadow.BindFBO_Point(pIdx);
         glClear(GL_DEPTH_BUFFER_BIT);
 
-        auto view = scene.registry.view<TransformComponent, MeshRendererComponent>();
-        for (auto obj : view)
+        for (const RenderQueueItem &item : queue.GetItems())
         {
-            auto [tObj, rObj] = view.get<TransformComponent, MeshRendererComponent>(obj);
-            if (rObj.model)
+            entt::entity obj = item.entity;
+            if (item.model)
             {
-                shaderPoint->setMat4("model", tObj.GetWorldModelMatrix(scene.registry));
-                if (scene.registry.all_of<AnimationComponent>(obj))
-                {
-                    auto &anim = scene.registry.get<AnimationComponent>(obj);
-                    if (anim.animator)
-                    {
-                        auto transforms = anim.animator->GetFinalBoneMatrices();
-                        for (int j = 0; j < transforms.size() && j < 100; ++j)
-                            shaderPoint->setMat4("finalBonesMatrices[" + std::to_string(j) + "]", transforms[j]);
-                        shaderPoint->setBool("hasAnimation", true);
-                    }
-                    else
-                    {
-                        shaderPoint->setBool("hasAnimation", false);
-                    }
-                }
-                else
-                {
-                    shaderPoint->setBool("hasAnimation", false);
-                }
-                rObj.model->Draw(*shaderPoint);
+                auto &tObj = scene.registry.get<TransformComponent>(obj);
+                shaderPoint->setMat4("model"_uniform, tObj.GetWorldMatrix());
+                ApplySkinning(shaderPoint, scene, obj);
+                item.model->Draw(*shaderPoint);
             }
         }
 
@@ -321,75 +298,23 @@ void ShadowRenderer::RenderShadows(Scene &scene)
         m_Shadow.BindFBO_Spot(sIdx);
         glClear(GL_DEPTH_BUFFER_BIT);
 
-        shaderSpot->setMat4("lightSpaceMatrix", m_LightSpaceMatrixSpot[sIdx]);
-
-        auto meshView = scene.registry.view<TransformComponent, MeshRendererComponent>();
-        for (auto obj : meshView)
-        {
-            auto [tObj, rObj] = meshView.get<TransformComponent, MeshRendererComponent>(obj);
-
-            if (!rObj.model || !rObj.castShadow)
-                continue;
+        shaderSpot->setMat4("lightSpaceMatrix"_uniform, m_LightSpaceMatrixSpot[sIdx]);
 
-            glm::mat4 modelMatrix = tObj.GetWorldModelMatrix(scene.registry);
-            glm::vec3 min = rObj.model->AABBmin;
-            glm::vec3 max = rObj.model->AABBmax;
+        CullShadowCasters(queue, spatialTree, m_ShadowFrustumCullingEnabled ? &lightFrustum : nullptr, camPos);
 
-            glm::vec3 center = (min + max) * 0.5f;
-            glm::vec3 extent = (max - min) * 0.5f;
-            glm::vec3 worldCenter = glm::vec3(modelMatrix * glm::vec4(center, 1.0f));
-
-            glm::mat3 rot = glm::mat3(modelMatrix);
-            glm::vec3 worldExtent = glm::vec3(
-                std::abs(rot[0][0]) * extent.x + std::abs(rot[1][0]) * extent.y + std::abs(rot[2][0]) * extent.z,
-                std::abs(rot[0][1]) * extent.x + std::abs(rot[1][1]) * extent.y + std::abs(rot[2][1]) * extent.z,
-                std::abs(rot[0][2]) * extent.x + std::abs(rot[1][2]) * extent.y + std::abs(rot[2][2]) * extent.z);
-
-            glm::vec3 worldMin = worldCenter - worldExtent;
-            glm::vec3 worldMax = worldCenter + worldExtent;
-
-            if (m_ShadowDistanceCullingSq > 0.0f)
-            {
-                float dx = (std::max)(worldMin.x - camPos.x, (std::max)(0.0f, camPos.x - worldMax.x));
-                float dy = (std::max)(worldMin.y - camPos.y, (std::max)(0.0f, camPos.y - worldMax.y));
-                float dz = (std::max)(worldMin.z - camPos.z, (std::max)(0.0f, camPos.z - worldMax.z));
-                
-                float distSq = dx*dx + dy*dy + dz*dz;
-                
-                if (distSq > m_ShadowDistanceCullingSq)
-                    continue;
-            }
-
-            if (m_ShadowFrustumCullingEnabled)
-            {
-                if (!lightFrustum.IsBoxVisible(worldMin, worldMax))
-                    continue;
-            }
+        const auto &items = queue.GetItems();
+        Culling::ForEachVisible(m_Visibility, [&](size_t index)
+        {
+            const RenderQueueItem &item = items[index];
+            entt::entity obj = item.entity;
+            glm::mat4 modelMatrix = scene.registry.get<TransformComponent>(obj).GetWorldMatrix();
 
-            shaderSpot->setMat4("model", modelMatrix);
+            shaderSpot->setMat4("model"_uniform, modelMatrix);
 
-            if (scene.registry.all_of<AnimationComponent>(obj))
-            {
-                auto &anim = scene.registry.get<AnimationComponent>(obj);
-                if (anim.animator)
-                {
-                    auto transforms = anim.animator->GetFinalBoneMatrices();
-                    for (int j = 0; j < transforms.size() && j < 100; ++j)
-                        shaderSpot->setMat4("finalBonesMatrices[" + std::to_string(j) + "]", transforms[j]);
-                    shaderSpot->setBool("hasAnimation", true);
-                }
-                else
-                {
-                    shaderSpot->setBool("hasAnimation", false);
-                }
-            }
-            else
-            {
-                shaderSpot->setBool("hasAnimation", false);
-            }
+            ApplySkinning(shaderSpot, scene, obj);
 
-            rObj.model->Draw(*shaderSpot);
-        }
+            item.model->Draw(*shaderSpot);
+        });
 
         sIdx++;
     }
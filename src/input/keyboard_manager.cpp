@@ -7,11 +7,15 @@ KeyboardManager::KeyboardManager(GLFWwindow *window)
 
 bool KeyboardManager::GetKey(int key) const
 {
+    if (!m_Window)
+        return false;
     return glfwGetKey(m_Window, key) == GLFW_PRESS;
 }
 
 bool KeyboardManager::GetKeyUp(int key) const
 {
+    if (!m_Window)
+        return true;
     return glfwGetKey(m_Window, key) == GLFW_RELEASE;
 }
 
@@ -104,6 +104,8 @@ void MouseManager::EndFrame()
 
 void MouseManager::SetCursorMode(CursorMode mode)
 {
+    // Kept even without a window (headless runs), so GetCursorMode still reports what was asked for
+    m_Mode = mode;
     if (!m_Window)
         return;
 
@@ -124,8 +126,6 @@ void MouseManager::SetCursorMode(CursorMode mode)
         m_FirstMouse = true;
         break;
     }
-
-    m_Mode = mode;
 }
 
 CursorMode MouseManager::GetCursorMode() const
@@ -152,8 +152,9 @@ float MouseManager::GetLastX() const
 {
     if (m_Mode == CursorMode::LockedCenter || m_Mode == CursorMode::LockedHiddenCenter)
     {
-        int w, h;
-        glfwGetWindowSize(m_Window, &w, &h);
+        int w = m_WindowWidth, h = m_WindowHeight;
+        if (m_Window)
+            glfwGetWindowSize(m_Window, &w, &h);
         return static_cast<float>(w) / 2.0f;
     }
     return static_cast<float>(m_LastX);
@@ -163,8 +164,9 @@ float MouseManager::GetLastY() const
 {
     if (m_Mode == CursorMode::LockedCenter || m_Mode == CursorMode::LockedHiddenCenter)
     {
-        int w, h;
-        glfwGetWindowSize(m_Window, &w, &h);
+        int w = m_WindowWidth, h = m_WindowHeight;
+        if (m_Window)
+            glfwGetWindowSize(m_Window, &w, &h);
         return static_cast<float>(h) / 2.0f;
     }
     return static_cast<float>(m_LastY);
@@ -1,15 +1,23 @@
 #include <physic/physic_world.h>
+#include <physic/physics_task_scheduler.h>
+#include <utils/thread_pool.h>
 #include <set>
 #include <utils/logger.h>
+#include <utils/profiler.h>
+
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h>
+#include <BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h>
 
 PhysicsWorld::PhysicsWorld()
 {
+#if BT_THREADSAFE
+    // Bullet numbers threads in order of first use and expects the main thread to be 0
+    btGetCurrentThreadIndex();
+#endif
+
     collisionConfig = std::make_unique<btDefaultCollisionConfiguration>();
-    dispatcher = std::make_unique<btCollisionDispatcher>(collisionConfig.get());
     overlappingPairCache = std::make_unique<btDbvtBroadphase>();
-    solver = std::make_unique<btSequentialImpulseConstraintSolver>();
-    dynamicsWorld = std::make_unique<btDiscreteDynamicsWorld>(
-        dispatcher.get(), overlappingPairCache.get(), solver.get(), collisionConfig.get());
+    CreateWorld(nullptr);
     dynamicsWorld->setGravity(btVector3(0, -9.81f, 0));
 
     debugDrawer = std::make_unique<DebugDrawer>();
@@ -17,10 +25,117 @@ PhysicsWorld::PhysicsWorld()
     dynamicsWorld->setDebugDrawer(debugDrawer.get());
 }
 
+void PhysicsWorld::CreateWorld(ThreadPool *pool)
+{
+    if (pool)
+    {
+        m_TaskScheduler = std::make_unique<PhysicsTaskScheduler>(*pool);
+        btSetTaskScheduler(m_TaskScheduler.get());
+
+        dispatcher = std::make_unique<btCollisionDispatcherMt>(collisionConfig.get());
+        solverPool = std::make_unique<btConstraintSolverPoolMt>(m_TaskScheduler->getNumThreads());
+        dynamicsWorld = std::make_unique<btDiscreteDynamicsWorldMt>(
+            dispatcher.get(), overlappingPairCache.get(), solverPool.get(), nullptr, collisionConfig.get());
+    }
+    else
+    {
+        dispatcher = std::make_unique<btCollisionDispatcher>(collisionConfig.get());
+        solver = std::make_unique<btSequentialImpulseConstraintSolver>();
+        dynamicsWorld = std::make_unique<btDiscreteDynamicsWorld>(
+            dispatcher.get(), overlappingPairCache.get(), solver.get(), collisionConfig.get());
+    }
+}
+
+void PhysicsWorld::SetParallel(ThreadPool *pool)
+{
+    WaitForStep();
+
+    if (pool && pool->GetWorkerCount() == 0)
+    {
+        LOGGER_WARN("PhysicsWorld") << "Parallel physics requested but the thread pool has no workers; staying serial";
+        pool = nullptr;
+    }
+#if !BT_THREADSAFE
+    if (pool)
+    {
+        LOGGER_WARN("PhysicsWorld") << "Parallel physics needs Bullet built with BT_THREADSAFE=1 (AXIS_BULLET_THREADSAFE); staying serial";
+        pool = nullptr;
+    }
+#endif
+    if ((pool != nullptr) == IsParallel())
+        return;
+
+    struct WorldObject
+    {
+        btCollisionObject *object;
+        int group;
+        int mask;
+    };
+    struct WorldConstraint
+    {
+        btTypedConstraint *constraint;
+        bool disableCollisions;
+    };
+
+    // Detach everything; removing objects also drops their pairs and manifolds from the old dispatcher
+    std::vector<WorldConstraint> constraints;
+    for (int i = dynamicsWorld->getNumConstraints() - 1; i >= 0; --i)
+    {
+        btTypedConstraint *constraint = dynamicsWorld->getConstraint(i);
+        bool disableCollisions = !constraint->getRigidBodyA().checkCollideWithOverride(&constraint->getRigidBodyB());
+        constraints.push_back({constraint, disableCollisions});
+        dynamicsWorld->removeConstraint(constraint);
+    }
+
+    std::vector<WorldObject> objects;
+    objects.reserve(dynamicsWorld->getNumCollisionObjects());
+    btCollisionObjectArray &objectArray = dynamicsWorld->getCollisionObjectArray();
+    for (int i = 0; i < objectArray.size(); ++i)
+    {
+        btBroadphaseProxy *proxy = objectArray[i]->getBroadphaseHandle();
+        objects.push_back({objectArray[i], proxy ? proxy->m_collisionFilterGroup : int(btBroadphaseProxy::DefaultFilter),
+                           proxy ? proxy->m_collisionFilterMask : int(btBroadphaseProxy::AllFilter)});
+    }
+    for (int i = static_cast<int>(objects.size()) - 1; i >= 0; --i)
+        dynamicsWorld->removeCollisionObject(objects[i].object);
+
+    btContactSolverInfo solverInfo = dynamicsWorld->getSolverInfo();
+    btVector3 gravity = dynamicsWorld->getGravity();
+
+    dynamicsWorld.reset();
+    solver.reset();
+    solverPool.reset();
+    dispatcher.reset();
+    if (m_TaskScheduler)
+    {
+        btSetTaskScheduler(nullptr);
+        m_TaskScheduler.reset();
+    }
+
+    CreateWorld(pool);
+    dynamicsWorld->getSolverInfo() = solverInfo;
+    dynamicsWorld->setGravity(gravity);
+    dynamicsWorld->setDebugDrawer(debugDrawer.get());
+
+    for (const WorldObject &entry : objects)
+    {
+        if (btRigidBody *body = btRigidBody::upcast(entry.object))
+            dynamicsWorld->addRigidBody(body, entry.group, entry.mask);
+        else
+            dynamicsWorld->addCollisionObject(entry.object, entry.group, entry.mask);
+    }
+    for (auto it = constraints.rbegin(); it != constraints.rend(); ++it)
+        dynamicsWorld->addConstraint(it->constraint, it->disableCollisions);
+
+    LOGGER_INFO("PhysicsWorld") << "Physics world is now " << (pool ? "parallel" : "serial")
+                                << (pool ? " (" + std::to_string(pool->GetThreadCount()) + " threads)" : std::string());
+}
+
 void PhysicsWorld::SetMode(int mode)
 {
     if (!dynamicsWorld)
         return;
+    WaitForStep();
 
     auto& solverInfo = dynamicsWorld->getSolverInfo();
 
@@ -76,17 +191,87 @@ void PhysicsWorld::SetMode(int mode)
 
 PhysicsWorld::~PhysicsWorld()
 {
+    if (m_StepThread.joinable())
+    {
+        WaitForStep();
+        {
+            std::lock_guard<std::mutex> lock(m_StepMutex);
+            m_StepStopping = true;
+        }
+        m_StepWake.notify_one();
+        m_StepThread.join();
+    }
+
     Clear();
+
+    dynamicsWorld.reset();
+    if (m_TaskScheduler)
+        btSetTaskScheduler(nullptr);
 }
 
 void PhysicsWorld::Update(float dt)
 {
+    AXIS_PROFILE_SCOPE("PhysicsWorld::Update");
     // Use fixed timestep for stability and performance control
     dynamicsWorld->stepSimulation(dt, m_maxSubSteps, m_timeStep);
 }
 
+void PhysicsWorld::BeginStep(float dt)
+{
+    WaitForStep();
+
+    if (!m_StepThread.joinable())
+        m_StepThread = std::thread(&PhysicsWorld::StepThreadLoop, this);
+
+    {
+        std::lock_guard<std::mutex> lock(m_StepMutex);
+        m_StepDt = dt;
+        m_StepPending = true;
+    }
+    m_StepInFlight = true;
+    m_StepWake.notify_one();
+}
+
+void PhysicsWorld::WaitForStep()
+{
+    if (!m_StepInFlight)
+        return;
+
+    AXIS_PROFILE_SCOPE("PhysicsWorld::WaitForStep");
+    std::unique_lock<std::mutex> lock(m_StepMutex);
+    m_StepDone.wait(lock, [this]()
+                    { return !m_StepPending; });
+    m_StepInFlight = false;
+}
+
+void PhysicsWorld::StepThreadLoop()
+{
+    AXIS_PROFILE_THREAD("Physics");
+    for (;;)
+    {
+        float dt;
+        {
+            std::unique_lock<std::mutex> lock(m_StepMutex);
+            m_StepWake.wait(lock, [this]()
+                            { return m_StepPending || m_StepStopping; });
+            if (m_StepStopping)
+                return;
+            dt = m_StepDt;
+        }
+
+        Update(dt);
+
+        {
+            std::lock_guard<std::mutex> lock(m_StepMutex);
+            m_StepPending = false;
+        }
+        m_StepDone.notify_one();
+    }
+}
+
 void PhysicsWorld::Clear()
 {
+    WaitForStep();
 
     for (int i = dynamicsWorld->getNumConstraints() - 1; i >= 0; i--)
     {
@@ -100,12 +285,17 @@ void PhysicsWorld::Clear()
         btCollisionObject* obj = dynamicsWorld->getCollisionObjectArray()[i];
         
         btRigidBody* body = btRigidBody::upcast(obj);
+        dynamicsWorld->removeCollisionObject(obj);
+        if (body && m_BodyPool.Owns(body))
+        {
+            m_BodyPool.Destroy(body);
+            continue;
+        }
+
         if (body && body->getMotionState())
         {
             delete body->getMotionState();
         }
-        
-        dynamicsWorld->removeCollisionObject(obj);
         delete obj;
     }
 
@@ -115,22 +305,29 @@ void PhysicsWorld::Clear()
         delete shape;
     }
     m_collisionShapes.clear();
+    m_ShapeCache.Clear();
+    m_PoseChanges.Clear();
 }
 
-btDiscreteDynamicsWorld *PhysicsWorld::GetWorld() { return dynamicsWorld.get(); }
+btDiscreteDynamicsWorld *PhysicsWorld::GetWorld()
+{
+    WaitForStep();
+    return dynamicsWorld.get();
+}
 
 btRigidBody *PhysicsWorld::CreateRigidBody(float mass, const btTransform &startTransform, btCollisionShape *shape)
 {
-    m_collisionShapes.push_back(shape);
+    WaitForStep();
+    if (!m_ShapeCache.Owns(shape))
+        m_collisionShapes.push_back(shape);
 
     bool isDynamic = (mass != 0.f);
     btVector3 localInertia(0, 0, 0);
     if (isDynamic)
         shape->calculateLocalInertia(mass, localInertia);
 
-    btDefaultMotionState *myMotionState = new btDefaultMotionState(startTransform);
-    btRigidBody::btRigidBodyConstructionInfo rbInfo(mass, myMotionState, shape, localInertia);
-    btRigidBody *body = new btRigidBody(rbInfo);
+    btRigidBody::btRigidBodyConstructionInfo rbInfo(mass, nullptr, shape, localInertia);
+    btRigidBody *body = m_BodyPool.Create(rbInfo, startTransform, m_PoseChanges);
     
     body->setSleepingThresholds(m_linearSleepingThreshold, m_angularSleepingThreshold);
 
@@ -138,6 +335,29 @@ btRigidBody *PhysicsWorld::CreateRigidBody(float mass, const btTransform &startT
     return body;
 }
 
+void PhysicsWorld::DestroyRigidBody(btRigidBody *body)
+{
+    if (!body)
+        return;
+
+    WaitForStep();
+    dynamicsWorld->removeRigidBody(body);
+    if (m_BodyPool.Owns(body))
+    {
+        m_BodyPool.Destroy(body);
+        return;
+    }
+
+    delete body->getMotionState();
+    delete body;
+}
+
+PhysicsChangeList &PhysicsWorld::GetPoseChanges()
+{
+    WaitForStep();
+    return m_PoseChanges;
+}
+
 void PhysicsWorld::RegisterShape(btCollisionShape* shape)
 {
     if (shape) {
@@ -147,10 +367,12 @@ void PhysicsWorld::RegisterShape(btCollisionShape* shape)
 
 void PhysicsWorld::AddConstraint(btTypedConstraint* constraint, bool disableCollisionsBetweenLinkedBodies)
 {
+    WaitForStep();
     dynamicsWorld->addConstraint(constraint, disableCollisionsBetweenLinkedBodies);
 }
 
 void PhysicsWorld::RemoveConstraint(btTypedConstraint* constraint)
 {
+    WaitForStep();
     dynamicsWorld->removeConstraint(constraint);
 }
\ No newline at end of file
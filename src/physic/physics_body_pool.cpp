@@ -0,0 +1,53 @@
+#include <physic/physics_body_pool.h>
+
+#include <new>
+
+btRigidBody *PhysicsBodyPool::Create(const btRigidBody::btRigidBodyConstructionInfo &info, const btTransform &startTransform, PhysicsChangeList &changes)
+{
+    if (!m_FreeList)
+    {
+        m_Blocks.emplace_back(new Slot[SLOTS_PER_BLOCK]);
+        Slot *block = m_Blocks.back().get();
+        // Hand slots out in address order
+        for (size_t i = SLOTS_PER_BLOCK; i-- > 0;)
+        {
+            block[i].nextFree = m_FreeList;
+            m_FreeList = &block[i];
+        }
+    }
+
+    Slot *slot = m_FreeList;
+    m_FreeList = slot->nextFree;
+    ++m_Live;
+
+    PhysicsMotionState *motionState = new (slot->motionState) PhysicsMotionState(startTransform, changes);
+    btRigidBody::btRigidBodyConstructionInfo pooledInfo = info;
+    pooledInfo.m_motionState = motionState;
+    btRigidBody *body = new (slot->body) btRigidBody(pooledInfo);
+    motionState->SetBody(body);
+    return body;
+}
+
+void PhysicsBodyPool::Destroy(btRigidBody *body)
+{
+    Slot *slot = reinterpret_cast<Slot *>(reinterpret_cast<unsigned char *>(body) - offsetof(Slot, body));
+
+    body->~btRigidBody();
+    std::launder(reinterpret_cast<PhysicsMotionState *>(slot->motionState))->~PhysicsMotionState();
+
+    slot->nextFree = m_FreeList;
+    m_FreeList = slot;
+    --m_Live;
+}
+
+bool PhysicsBodyPool::Owns(const btRigidBody *body) const
+{
+    const unsigned char *address = reinterpret_cast<const unsigned char *>(body);
+    for (const std::unique_ptr<Slot[]> &block : m_Blocks)
+    {
+        const unsigned char *begin = reinterpret_cast<const unsigned char *>(block.get());
+        if (address >= begin && address < begin + sizeof(Slot) * SLOTS_PER_BLOCK)
+            return true;
+    }
+    return false;
+}
@@ -3,130 +3,221 @@
 #include <physic/physic_world.h>
 #include <ecs/component.h>
 #include <script/scriptable.h>
+#include <utils/profiler.h>
+
+#include <algorithm>
+
+namespace
+{
+    // btCollisionObject::m_userIndex3 of bodies whose entity has a ScriptComponent
+    constexpr int CONTACT_LISTENER = 1;
+    constexpr float CONTACT_DISTANCE = 0.1f;
+    constexpr size_t MIN_PAIR_CAPACITY = 64;
+}
+
+CollisionPairTable::Entry &CollisionPairTable::FindOrInsert(uint64_t key, bool &inserted)
+{
+    // Keep the load factor at or below one half so probe runs stay short
+    if ((m_Size + 1) * 2 > m_Entries.size())
+        Grow();
+
+    const size_t mask = m_Entries.size() - 1;
+    for (size_t i = Home(key);; i = (i + 1) & mask)
+    {
+        Entry &entry = m_Entries[i];
+        if (entry.key == key)
+        {
+            inserted = false;
+            return entry;
+        }
+        if (entry.key == EMPTY)
+        {
+            entry = Entry();
+            entry.key = key;
+            ++m_Size;
+            inserted = true;
+            return entry;
+        }
+    }
+}
+
+void CollisionPairTable::Remove(uint64_t key)
+{
+    if (m_Entries.empty())
+        return;
+
+    const size_t mask = m_Entries.size() - 1;
+    size_t hole = Home(key);
+    while (m_Entries[hole].key != key)
+    {
+        if (m_Entries[hole].key == EMPTY)
+            return;
+        hole = (hole + 1) & mask;
+    }
+
+    // Backward-shift deletion: pull later entries of the run into the hole so lookups never need tombstones
+    for (size_t next = (hole + 1) & mask; m_Entries[next].key != EMPTY; next = (next + 1) & mask)
+    {
+        size_t home = Home(m_Entries[next].key);
+        bool stays = (hole <= next) ? (hole < home && home <= next) : (hole < home || home <= next);
+        if (stays)
+            continue;
+        m_Entries[hole] = m_Entries[next];
+        hole = next;
+    }
+    m_Entries[hole] = Entry();
+    --m_Size;
+}
+
+void CollisionPairTable::Clear()
+{
+    std::fill(m_Entries.begin(), m_Entries.end(), Entry());
+    m_Size = 0;
+}
+
+void CollisionPairTable::Grow()
+{
+    std::vector<Entry> old;
+    old.swap(m_Entries);
+    m_Entries.assign((std::max)(MIN_PAIR_CAPACITY, old.size() * 2), Entry());
+    m_Size = 0;
+
+    for (const Entry &entry : old)
+    {
+        if (entry.key == EMPTY)
+            continue;
+        bool inserted;
+        FindOrInsert(entry.key, inserted) = entry;
+    }
+}
+
+size_t CollisionPairTable::Home(uint64_t key) const
+{
+    uint64_t hash = key * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(hash ^ (hash >> 32)) & (m_Entries.size() - 1);
+}
 
 PhysicsCollisionDispatcher::PhysicsCollisionDispatcher(Scene& scene, PhysicsWorld& physics)
     : m_Scene(scene), m_Physics(physics)
 {
+    m_Scene.registry.on_construct<ScriptComponent>().connect<&PhysicsCollisionDispatcher::OnScriptsChanged>(this);
+    m_Scene.registry.on_destroy<ScriptComponent>().connect<&PhysicsCollisionDispatcher::OnScriptsChanged>(this);
+    m_Scene.registry.on_construct<RigidBodyComponent>().connect<&PhysicsCollisionDispatcher::OnScriptsChanged>(this);
 }
 
 PhysicsCollisionDispatcher::~PhysicsCollisionDispatcher()
 {
+    m_Scene.registry.on_construct<ScriptComponent>().disconnect<&PhysicsCollisionDispatcher::OnScriptsChanged>(this);
+    m_Scene.registry.on_destroy<ScriptComponent>().disconnect<&PhysicsCollisionDispatcher::OnScriptsChanged>(this);
+    m_Scene.registry.on_construct<RigidBodyComponent>().disconnect<&PhysicsCollisionDispatcher::OnScriptsChanged>(this);
+}
+
+void PhysicsCollisionDispatcher::UpdateListeners()
+{
+    for (auto [entity, rb] : m_Scene.registry.view<RigidBodyComponent>().each())
+    {
+        if (rb.body)
+            rb.body->setUserIndex3(m_Scene.registry.all_of<ScriptComponent>(entity) ? CONTACT_LISTENER : 0);
+    }
+    m_ListenersDirty = false;
 }
 
 void PhysicsCollisionDispatcher::DispatchEvents()
 {
+    AXIS_PROFILE_SCOPE("PhysicsCollisionDispatcher::DispatchEvents");
     btDiscreteDynamicsWorld *world = m_Physics.GetWorld();
     if (!world) return;
 
-    int numManifolds = world->getDispatcher()->getNumManifolds();
+    if (m_ListenersDirty)
+        UpdateListeners();
 
-    std::unordered_set<CollisionPair, CollisionPairHash> currentCollisions;
-    currentCollisions.reserve(numManifolds);
+    ++m_Generation;
+    m_Events.clear();
 
+    btDispatcher *dispatcher = world->getDispatcher();
+    int numManifolds = dispatcher->getNumManifolds();
     for (int i = 0; i < numManifolds; i++)
     {
-        btPersistentManifold *contactManifold = world->getDispatcher()->getManifoldByIndexInternal(i);
+        btPersistentManifold *contactManifold = dispatcher->getManifoldByIndexInternal(i);
         const btCollisionObject *obA = contactManifold->getBody0();
         const btCollisionObject *obB = contactManifold->getBody1();
 
+        // Nobody to tell: skip before touching contacts or the registry
+        if (obA->getUserIndex3() != CONTACT_LISTENER && obB->getUserIndex3() != CONTACT_LISTENER)
+            continue;
+
         bool hasCollision = false;
         for (int j = 0; j < contactManifold->getNumContacts(); j++)
         {
-            if (contactManifold->getContactPoint(j).getDistance() < 0.1f)
+            if (contactManifold->getContactPoint(j).getDistance() < CONTACT_DISTANCE)
             {
                 hasCollision = true;
                 break;
             }
         }
+        if (!hasCollision)
+            continue;
+
+        entt::entity eA = (entt::entity)(uintptr_t)obA->getUserPointer();
+        entt::entity eB = (entt::entity)(uintptr_t)obB->getUserPointer();
+        if (!m_Scene.registry.valid(eA) || !m_Scene.registry.valid(eB))
+            continue;
+        if (eA > eB)
+            std::swap(eA, eB);
+
+        bool inserted;
+        CollisionPairTable::Entry &pair = m_Pairs.FindOrInsert(CollisionPairTable::MakeKey(eA, eB), inserted);
+        // Compound pairs can span several manifolds; report the pair once
+        if (pair.generation == m_Generation)
+            continue;
+
+        pair.generation = m_Generation;
+        pair.trigger = (obA->getCollisionFlags() & btCollisionObject::CF_NO_CONTACT_RESPONSE) ||
+                       (obB->getCollisionFlags() & btCollisionObject::CF_NO_CONTACT_RESPONSE);
+        m_Events.push_back({eA, eB, inserted ? CollisionEventType::Enter : CollisionEventType::Stay, pair.trigger});
+    }
 
-        if (hasCollision)
-        {
-            entt::entity eA = (entt::entity)(uintptr_t)obA->getUserPointer();
-            entt::entity eB = (entt::entity)(uintptr_t)obB->getUserPointer();
+    m_Separated.clear();
+    for (const CollisionPairTable::Entry &pair : m_Pairs.GetEntries())
+    {
+        if (pair.key == CollisionPairTable::EMPTY || pair.generation == m_Generation)
+            continue;
 
-            if (m_Scene.registry.valid(eA) && m_Scene.registry.valid(eB))
-            {
-                if (eA > eB)
-                    std::swap(eA, eB);
-
-                currentCollisions.insert({eA, eB});
-
-                bool isTrigger = (obA->getCollisionFlags() & btCollisionObject::CF_NO_CONTACT_RESPONSE) ||
-                                 (obB->getCollisionFlags() & btCollisionObject::CF_NO_CONTACT_RESPONSE);
-
-                bool isStay = m_activeCollisions.count({eA, eB}) > 0;
-
-                auto Notify = [&](entt::entity target, entt::entity other, bool trigger, bool stay)
-                {
-                    if (m_Scene.registry.all_of<ScriptComponent>(target))
-                    {
-                        auto &s = m_Scene.registry.get<ScriptComponent>(target);
-                        if (s.instance)
-                        {
-                            if (trigger)
-                            {
-                                if (!stay)
-                                    s.instance->OnTriggerEnter(other);
-                                else
-                                    s.instance->OnTriggerStay(other);
-                            }
-                            else
-                            {
-                                if (!stay)
-                                    s.instance->OnCollisionEnter(other);
-                                else
-                                    s.instance->OnCollisionStay(other);
-                            }
-                        }
-                    }
-                };
-
-                Notify(eA, eB, isTrigger, isStay);
-                Notify(eB, eA, isTrigger, isStay);
-            }
-        }
+        entt::entity eA = static_cast<entt::entity>(static_cast<uint32_t>(pair.key >> 32));
+        entt::entity eB = static_cast<entt::entity>(static_cast<uint32_t>(pair.key));
+        m_Events.push_back({eA, eB, CollisionEventType::Exit, pair.trigger});
+        m_Separated.push_back(pair.key);
     }
+    for (uint64_t key : m_Separated)
+        m_Pairs.Remove(key);
 
-    for (const auto &pair : m_activeCollisions)
+    for (const CollisionEvent &event : m_Events)
     {
-        if (currentCollisions.count(pair) == 0)
-        {
-            entt::entity eA = pair.a;
-            entt::entity eB = pair.b;
+        Deliver(event, event.a, event.b);
+        Deliver(event, event.b, event.a);
+    }
+}
 
-            bool isTrigger = false;
-            if (m_Scene.registry.valid(eA) && m_Scene.registry.all_of<RigidBodyComponent>(eA))
-            {
-                if (auto *body = m_Scene.registry.get<RigidBodyComponent>(eA).body)
-                    if (body->getCollisionFlags() & btCollisionObject::CF_NO_CONTACT_RESPONSE)
-                        isTrigger = true;
-            }
-            if (!isTrigger && m_Scene.registry.valid(eB) && m_Scene.registry.all_of<RigidBodyComponent>(eB))
-            {
-                if (auto *body = m_Scene.registry.get<RigidBodyComponent>(eB).body)
-                    if (body->getCollisionFlags() & btCollisionObject::CF_NO_CONTACT_RESPONSE)
-                        isTrigger = true;
-            }
+void PhysicsCollisionDispatcher::Deliver(const CollisionEvent &event, entt::entity target, entt::entity other)
+{
+    if (!m_Scene.registry.valid(target))
+        return;
 
-            auto NotifyExit = [&](entt::entity target, entt::entity other, bool trigger)
-            {
-                if (m_Scene.registry.valid(target) && m_Scene.registry.all_of<ScriptComponent>(target))
-                {
-                    auto &s = m_Scene.registry.get<ScriptComponent>(target);
-                    if (s.instance)
-                    {
-                        if (trigger)
-                            s.instance->OnTriggerExit(other);
-                        else
-                            s.instance->OnCollisionExit(other);
-                    }
-                }
-            };
-
-            NotifyExit(eA, eB, isTrigger);
-            NotifyExit(eB, eA, isTrigger);
-        }
-    }
+    auto *script = m_Scene.registry.try_get<ScriptComponent>(target);
+    if (!script || !script->instance)
+        return;
 
-    m_activeCollisions = currentCollisions;
+    Scriptable *instance = script->instance;
+    switch (event.type)
+    {
+    case CollisionEventType::Enter:
+        event.trigger ? instance->OnTriggerEnter(other) : instance->OnCollisionEnter(other);
+        break;
+    case CollisionEventType::Stay:
+        event.trigger ? instance->OnTriggerStay(other) : instance->OnCollisionStay(other);
+        break;
+    case CollisionEventType::Exit:
+        event.trigger ? instance->OnTriggerExit(other) : instance->OnCollisionExit(other);
+        break;
+    }
 }
@@ -3,171 +3,154 @@
 #include <utils/bullet_glm_helpers.h>
 #include <iostream>
 
-void PhysicsLoader::LoadRigidBody(Scene &scene, entt::entity entity, std::stringstream &ss, PhysicsWorld &physics, std::ifstream &file)
+void PhysicsLoader::LoadRigidBody(Scene &scene, entt::entity entity, SceneTokens &tokens, PhysicsWorld &physics, SceneLineReader &lines)
 {
-    std::string type;
-    float mass;
-    ss >> type >> mass;
+    CreateRigidBody(scene, entity, ParseRigidBody(tokens, lines), physics);
+}
 
-    auto &trans = scene.registry.get<TransformComponent>(entity);
-    auto &rb = scene.registry.emplace<RigidBodyComponent>(entity);
+RigidBodyDesc PhysicsLoader::ParseRigidBody(SceneTokens &tokens, SceneLineReader &lines)
+{
+    RigidBodyDesc desc;
+    std::string_view type = tokens.Next();
+    tokens.Next(desc.mass);
 
-    btCollisionShape *finalShape = nullptr;
     if (type == "COMPOUND")
     {
-        btCompoundShape *compound = new btCompoundShape();
-        std::string subLine;
+        desc.shape = RigidBodyShapeType::Compound;
+        std::string_view subLine;
 
-        while (std::getline(file, subLine))
+        while (lines.NextLine(subLine))
         {
-            std::stringstream subSS(subLine);
-            std::string subCmd;
-            subSS >> subCmd;
+            SceneTokens subTokens(subLine);
+            std::string_view subCmd = subTokens.Next();
 
             if (subCmd == "END_RIGIDBODY")
                 break;
 
             if (subCmd == "SHAPE")
             {
-                std::string shapeType;
-                float lx, ly, lz, lrx, lry, lrz;
-                subSS >> shapeType >> lx >> ly >> lz >> lrx >> lry >> lrz;
-
-                btTransform localTrans;
-                localTrans.setIdentity();
-                localTrans.setOrigin(btVector3(lx, ly, lz));
-                btQuaternion localRot;
-                localRot.setEuler(glm::radians(lry), glm::radians(lrx), glm::radians(lrz));
-                localTrans.setRotation(localRot);
-
-                btCollisionShape *childShape = nullptr;
+                RigidBodyChildDesc child;
+                std::string_view shapeType = subTokens.Next();
+                subTokens.Read(child.position.x, child.position.y, child.position.z,
+                               child.eulerDegrees.x, child.eulerDegrees.y, child.eulerDegrees.z);
 
                 if (shapeType == "BOX")
                 {
-                    float x, y, z;
-                    subSS >> x >> y >> z;
-                    childShape = new btBoxShape(btVector3(x, y, z));
+                    child.shape = RigidBodyShapeType::Box;
+                    subTokens.Read(child.size.x, child.size.y, child.size.z);
                 }
                 else if (shapeType == "SPHERE")
                 {
-                    float r;
-                    subSS >> r;
-                    childShape = new btSphereShape(r);
+                    child.shape = RigidBodyShapeType::Sphere;
+                    subTokens.Next(child.size.x);
                 }
                 else if (shapeType == "CAPSULE")
                 {
-                    float r, h;
-                    subSS >> r >> h;
-                    childShape = new btCapsuleShape(r, h);
+                    child.shape = RigidBodyShapeType::Capsule;
+                    subTokens.Read(child.size.x, child.size.y);
                 }
 
-                if (childShape)
+                if (child.shape != RigidBodyShapeType::None)
                 {
-                    compound->addChildShape(localTrans, childShape);
-                    physics.RegisterShape(childShape);
+                    desc.children.push_back(child);
                 }
             }
         }
-        finalShape = compound;
     }
     else if (type == "CAPSULE")
     {
-        float r, h;
-        ss >> r >> h;
-        finalShape = new btCapsuleShape(r, h);
+        desc.shape = RigidBodyShapeType::Capsule;
+        tokens.Read(desc.size.x, desc.size.y);
     }
     else if (type == "BOX")
     {
-        float x, y, z;
-        ss >> x >> y >> z;
-        finalShape = new btBoxShape(btVector3(x, y, z));
+        desc.shape = RigidBodyShapeType::Box;
+        tokens.Read(desc.size.x, desc.size.y, desc.size.z);
     }
 
-    glm::vec3 centerOffset(0.0f);
-    glm::vec3 rotFactor(1.0f);
-    glm::vec3 posFactor(1.0f);
-    bool hasRotFactor = false;
-    bool hasPosFactor = false;
-    float restitution = 0.0f;
-    std::string bodyType = "UNKNOWN";
-    std::string nextToken;
+    std::string_view nextToken;
 
-    while (ss >> nextToken)
+    while (!(nextToken = tokens.Next()).empty())
     {
         if (nextToken == "OFFSET")
         {
-            float ox, oy, oz;
-            ss >> ox >> oy >> oz;
-            centerOffset = glm::vec3(ox, oy, oz);
+            tokens.Read(desc.centerOffset.x, desc.centerOffset.y, desc.centerOffset.z);
         }
         else if (nextToken == "RESTITUTION")
         {
-            ss >> restitution;
+            tokens.Next(desc.restitution);
         }
         else if (nextToken == "ROT_FACTOR" || nextToken == "LOCK_ANGULAR")
         {
-            float x, y, z;
-            ss >> x >> y >> z;
-            rb.angularFactor = glm::vec3(x, y, z);
-            hasRotFactor = true;
+            float x = 0.0f, y = 0.0f, z = 0.0f;
+            tokens.Read(x, y, z);
+            desc.angularFactor = glm::vec3(x, y, z);
+            desc.hasRotFactor = true;
         }
         else if (nextToken == "POS_FACTOR" || nextToken == "LOCK_LINEAR")
         {
-            float x, y, z;
-            ss >> x >> y >> z;
-            rb.linearFactor = glm::vec3(x, y, z);
-            hasPosFactor = true;
+            float x = 0.0f, y = 0.0f, z = 0.0f;
+            tokens.Read(x, y, z);
+            desc.linearFactor = glm::vec3(x, y, z);
         }
         else if (nextToken == "PARENT_MATTER" || nextToken == "IS_PARENT_MATTER")
         {
-            rb.isParentMatter = true;
+            desc.isParentMatter = true;
         }
         else if (nextToken == "CHILDREN_MATTER" || nextToken == "IS_CHILDREN_MATTER")
         {
-            rb.isChildrenMatter = true;
+            desc.isChildrenMatter = true;
         }
         else if (nextToken == "STATIC")
         {
-            bodyType = "STATIC";
+            desc.motion = RigidBodyMotionType::Static;
         }
         else if (nextToken == "DYNAMIC")
         {
-            bodyType = "DYNAMIC";
+            desc.motion = RigidBodyMotionType::Dynamic;
         }
         else if (nextToken == "KINEMATIC")
         {
-            bodyType = "KINEMATIC";
+            desc.motion = RigidBodyMotionType::Kinematic;
         }
         else if (nextToken == "ATTACH_TO_PARENT")
         {
-            rb.isAttachedToParent = true;
+            desc.isAttachedToParent = true;
         }
     }
 
-    if (finalShape && glm::length(centerOffset) > 0.001f)
-    {
-        btCompoundShape *compound = new btCompoundShape();
-        btTransform localTrans;
-        localTrans.setIdentity();
-        localTrans.setOrigin(BulletGLMHelpers::convert(centerOffset));
-        compound->addChildShape(localTrans, finalShape);
-        finalShape = compound;
-        physics.RegisterShape(finalShape);
-    }
+    return desc;
+}
+
+void PhysicsLoader::CreateRigidBody(Scene &scene, entt::entity entity, const RigidBodyDesc &desc, PhysicsWorld &physics)
+{
+    auto &trans = scene.registry.get<TransformComponent>(entity);
+    auto &rb = scene.registry.get_or_emplace<RigidBodyComponent>(entity);
+
+    rb.angularFactor = desc.angularFactor;
+    rb.linearFactor = desc.linearFactor;
+    rb.isParentMatter = desc.isParentMatter;
+    rb.isChildrenMatter = desc.isChildrenMatter;
+    rb.isAttachedToParent = desc.isAttachedToParent;
+    rb.world = &physics;
+
+    btCollisionShape *finalShape = GetShape(desc, physics.GetShapeCache());
 
     if (finalShape)
     {
-        if (bodyType == "UNKNOWN")
+        float mass = desc.mass;
+        RigidBodyMotionType motion = desc.motion;
+        if (motion == RigidBodyMotionType::Unknown)
         {
             if (mass > 0.0f)
-                bodyType = "DYNAMIC";
+                motion = RigidBodyMotionType::Dynamic;
             else
-                bodyType = "STATIC";
+                motion = RigidBodyMotionType::Static;
         }
 
-        if (bodyType == "STATIC")
+        if (motion == RigidBodyMotionType::Static)
             mass = 0.0f;
-        if (bodyType == "KINEMATIC")
+        if (motion == RigidBodyMotionType::Kinematic)
             mass = 0.0f;
 
         btTransform transform;
@@ -179,7 +162,7 @@ void PhysicsLoader::LoadRigidBody(Scene &scene, entt::entity entity, std::string
 
         if (rb.body)
         {
-            if (bodyType == "KINEMATIC")
+            if (motion == RigidBodyMotionType::Kinematic)
             {
                 rb.body->setCollisionFlags(rb.body->getCollisionFlags() | btCollisionObject::CF_KINEMATIC_OBJECT);
                 rb.body->setActivationState(DISABLE_DEACTIVATION);
@@ -187,20 +170,71 @@ void PhysicsLoader::LoadRigidBody(Scene &scene, entt::entity entity, std::string
 
             rb.body->setUserPointer((void *)(uintptr_t)entity);
 
-            if (type == "CAPSULE" || type == "PLAYER")
+            if (desc.shape == RigidBodyShapeType::Capsule)
             {
                  // Default capsule lock rotation, but allow override
-                 if (!hasRotFactor)
+                 if (!desc.hasRotFactor)
                     rb.angularFactor = glm::vec3(0, 1, 0);
             }
 
             rb.body->setAngularFactor(BulletGLMHelpers::convert(rb.angularFactor));
             rb.body->setLinearFactor(BulletGLMHelpers::convert(rb.linearFactor));
 
-            if (restitution > 0.0f)
+            if (desc.restitution > 0.0f)
             {
-                rb.body->setRestitution(restitution);
+                rb.body->setRestitution(desc.restitution);
             }
         }
     }
 }
+
+btCollisionShape *PhysicsLoader::GetShape(const RigidBodyDesc &desc, PhysicsShapeCache &shapes)
+{
+    // Identical parameters share one shape (bulk-spawned scenes repeat the same few)
+    btCollisionShape *finalShape = nullptr;
+    if (desc.shape == RigidBodyShapeType::Compound)
+    {
+        std::vector<PhysicsShapeCache::ChildShape> children;
+        children.reserve(desc.children.size());
+
+        for (const RigidBodyChildDesc &child : desc.children)
+        {
+            btTransform localTrans;
+            localTrans.setIdentity();
+            localTrans.setOrigin(BulletGLMHelpers::convert(child.position));
+            btQuaternion localRot;
+            localRot.setEuler(glm::radians(child.eulerDegrees.y), glm::radians(child.eulerDegrees.x), glm::radians(child.eulerDegrees.z));
+            localTrans.setRotation(localRot);
+
+            btCollisionShape *childShape = nullptr;
+
+            if (child.shape == RigidBodyShapeType::Box)
+                childShape = shapes.GetBox(child.size);
+            else if (child.shape == RigidBodyShapeType::Sphere)
+                childShape = shapes.GetSphere(child.size.x);
+            else if (child.shape == RigidBodyShapeType::Capsule)
+                childShape = shapes.GetCapsule(child.size.x, child.size.y);
+
+            if (childShape)
+            {
+                children.emplace_back(localTrans, childShape);
+            }
+        }
+        finalShape = shapes.GetCompound(children);
+    }
+    else if (desc.shape == RigidBodyShapeType::Capsule)
+    {
+        finalShape = shapes.GetCapsule(desc.size.x, desc.size.y);
+    }
+    else if (desc.shape == RigidBodyShapeType::Box)
+    {
+        finalShape = shapes.GetBox(desc.size);
+    }
+
+    if (finalShape && glm::length(desc.centerOffset) > 0.001f)
+    {
+        finalShape = shapes.GetOffset(finalShape, desc.centerOffset);
+    }
+
+    return finalShape;
+}
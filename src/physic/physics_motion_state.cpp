@@ -0,0 +1,40 @@
+#include <physic/physics_motion_state.h>
+#include <utils/bullet_glm_helpers.h>
+
+void PhysicsChangeList::Record(PhysicsMotionState &state, const btTransform &worldTransform)
+{
+    if (state.m_Generation != m_Generation)
+    {
+        state.m_Generation = m_Generation;
+        state.m_Slot = static_cast<uint32_t>(m_Changes.size());
+        m_Changes.emplace_back();
+    }
+
+    PhysicsPoseChange &change = m_Changes[state.m_Slot];
+    change.entity = static_cast<entt::entity>(reinterpret_cast<uintptr_t>(state.m_Body->getUserPointer()));
+    change.body = state.m_Body;
+    change.position = BulletGLMHelpers::convert(worldTransform.getOrigin());
+    change.rotation = BulletGLMHelpers::convert(worldTransform.getRotation());
+}
+
+void PhysicsChangeList::Clear()
+{
+    m_Changes.clear();
+    // Invalidates every motion state's slot without touching them
+    ++m_Generation;
+}
+
+PhysicsMotionState::PhysicsMotionState(const btTransform &startTransform, PhysicsChangeList &changes)
+    : btDefaultMotionState(startTransform),
+      m_Changes(changes)
+{
+}
+
+void PhysicsMotionState::setWorldTransform(const btTransform &worldTransform)
+{
+    btDefaultMotionState::setWorldTransform(worldTransform);
+
+    // Kinematic bodies are written from their transforms (SyncToPhysics), not the other way round
+    if (m_Body && !m_Body->isStaticOrKinematicObject())
+        m_Changes.Record(*this, worldTransform);
+}
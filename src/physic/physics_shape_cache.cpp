@@ -0,0 +1,123 @@
+#include <physic/physics_shape_cache.h>
+#include <utils/bullet_glm_helpers.h>
+
+namespace
+{
+    // Keys are the shape kind followed by the raw bytes of its parameters: exact-match sharing only
+    template <typename T>
+    void AppendKey(std::string &key, const T &value)
+    {
+        key.append(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    void AppendKey(std::string &key, const btTransform &transform)
+    {
+        const btVector3 &origin = transform.getOrigin();
+        btQuaternion rotation = transform.getRotation();
+        const float values[7] = {float(origin.x()), float(origin.y()), float(origin.z()),
+                                 float(rotation.x()), float(rotation.y()), float(rotation.z()), float(rotation.w())};
+        AppendKey(key, values);
+    }
+}
+
+btCollisionShape *PhysicsShapeCache::GetBox(const glm::vec3 &halfExtents)
+{
+    std::string key(1, 'B');
+    AppendKey(key, halfExtents);
+    if (btCollisionShape *shape = Find(key))
+        return shape;
+    return Insert(std::move(key), new btBoxShape(BulletGLMHelpers::convert(halfExtents)));
+}
+
+btCollisionShape *PhysicsShapeCache::GetSphere(float radius)
+{
+    std::string key(1, 'S');
+    AppendKey(key, radius);
+    if (btCollisionShape *shape = Find(key))
+        return shape;
+    return Insert(std::move(key), new btSphereShape(radius));
+}
+
+btCollisionShape *PhysicsShapeCache::GetCapsule(float radius, float height)
+{
+    std::string key(1, 'C');
+    AppendKey(key, radius);
+    AppendKey(key, height);
+    if (btCollisionShape *shape = Find(key))
+        return shape;
+    return Insert(std::move(key), new btCapsuleShape(radius, height));
+}
+
+btCollisionShape *PhysicsShapeCache::GetCompound(const std::vector<ChildShape> &children)
+{
+    std::string key(1, 'M');
+    for (const ChildShape &child : children)
+    {
+        AppendKey(key, child.first);
+        AppendKey(key, child.second);
+    }
+    if (btCollisionShape *shape = Find(key))
+        return shape;
+
+    btCompoundShape *compound = new btCompoundShape(true, static_cast<int>(children.size()));
+    for (const ChildShape &child : children)
+        compound->addChildShape(child.first, child.second);
+    return Insert(std::move(key), compound);
+}
+
+btCollisionShape *PhysicsShapeCache::GetOffset(btCollisionShape *shape, const glm::vec3 &offset)
+{
+    btTransform local;
+    local.setIdentity();
+    local.setOrigin(BulletGLMHelpers::convert(offset));
+    return GetCompound({{local, shape}});
+}
+
+bool PhysicsShapeCache::Owns(const btCollisionShape *shape) const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Owned.count(shape) != 0;
+}
+
+size_t PhysicsShapeCache::GetUniqueCount() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Shapes.size();
+}
+
+size_t PhysicsShapeCache::GetRequestCount() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Requests;
+}
+
+void PhysicsShapeCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Shapes.clear();
+    m_Owned.clear();
+    m_Requests = 0;
+}
+
+btCollisionShape *PhysicsShapeCache::Find(const std::string &key)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    ++m_Requests;
+    auto it = m_Shapes.find(key);
+    return it != m_Shapes.end() ? it->second.get() : nullptr;
+}
+
+btCollisionShape *PhysicsShapeCache::Insert(std::string key, btCollisionShape *shape)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    auto [it, inserted] = m_Shapes.try_emplace(std::move(key));
+    if (!inserted)
+    {
+        // Another thread built the same shape between our Find and here
+        delete shape;
+        return it->second.get();
+    }
+    it->second.reset(shape);
+    m_Owned.insert(shape);
+    return shape;
+}
@@ -0,0 +1,46 @@
+#include <physic/physics_task_scheduler.h>
+#include <utils/thread_pool.h>
+
+#include <algorithm>
+#include <mutex>
+
+PhysicsTaskScheduler::PhysicsTaskScheduler(ThreadPool &pool)
+    : btITaskScheduler("AxisThreadPool"),
+      m_Pool(pool)
+{
+}
+
+int PhysicsTaskScheduler::getMaxNumThreads() const
+{
+    // One more than the pool runs: the main thread is Bullet's thread 0, and a pipelined step is
+    // driven from PhysicsWorld's step thread, which also takes an index
+    return (std::min)(m_Pool.GetThreadCount() + 1, static_cast<int>(BT_MAX_THREAD_COUNT));
+}
+
+int PhysicsTaskScheduler::getNumThreads() const
+{
+    return getMaxNumThreads();
+}
+
+void PhysicsTaskScheduler::setNumThreads(int)
+{
+    // The pool is sized once by its owner
+}
+
+void PhysicsTaskScheduler::parallelFor(int iBegin, int iEnd, int grainSize, const btIParallelForBody &body)
+{
+    m_Pool.ParallelFor(iBegin, iEnd, grainSize, [&body](int begin, int end)
+                       { body.forLoop(begin, end); });
+}
+
+btScalar PhysicsTaskScheduler::parallelSum(int iBegin, int iEnd, int grainSize, const btIParallelSumBody &body)
+{
+    std::mutex sumMutex;
+    btScalar sum = 0;
+    m_Pool.ParallelFor(iBegin, iEnd, grainSize, [&](int begin, int end)
+                       {
+                           btScalar partial = body.sumLoop(begin, end);
+                           std::lock_guard<std::mutex> lock(sumMutex);
+                           sum += partial; });
+    return sum;
+}
@@ -6,13 +6,22 @@
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/matrix_decompose.hpp>
 
+namespace
+{
+    constexpr uint32_t NEVER_PUSHED = ~0u;
+}
+
 PhysicsTransformSync::PhysicsTransformSync(Scene &scene, PhysicsWorld &physics)
     : m_Scene(scene), m_Physics(physics)
 {
+    m_Scene.registry.on_construct<RigidBodyComponent>().connect<&PhysicsTransformSync::OnBodiesChanged>(this);
+    m_Scene.registry.on_destroy<RigidBodyComponent>().connect<&PhysicsTransformSync::OnBodiesChanged>(this);
 }
 
 PhysicsTransformSync::~PhysicsTransformSync()
 {
+    m_Scene.registry.on_construct<RigidBodyComponent>().disconnect<&PhysicsTransformSync::OnBodiesChanged>(this);
+    m_Scene.registry.on_destroy<RigidBodyComponent>().disconnect<&PhysicsTransformSync::OnBodiesChanged>(this);
 }
 
 void PhysicsTransformSync::Init()
@@ -20,130 +29,204 @@ void PhysicsTransformSync::Init()
     if (m_initialized)
         return;
 
-    m_simulationQuery.Update(m_Scene.registry);
+    Rebuild();
     m_initialized = true;
 }
 
-glm::mat4 PhysicsTransformSync::GetCachedWorldMatrix(entt::entity entity)
+void PhysicsTransformSync::Rebuild()
 {
-    auto it = m_worldMatrixCache.find(entity);
-    if (it != m_worldMatrixCache.end())
-        return it->second;
-
-    glm::mat4 result;
-    if (m_Scene.registry.all_of<TransformComponent>(entity))
+    // Bodies are created after their component is emplaced, so this runs lazily at the next sync
+    m_DrivenEntities.clear();
+    m_DrivenVersions.clear();
+    auto view = m_Scene.registry.view<RigidBodyComponent, TransformComponent>();
+    for (auto entity : view)
     {
-        const auto &tc = m_Scene.registry.get<TransformComponent>(entity);
-        glm::mat4 local = tc.GetLocalModelMatrix();
-
-        if (m_Scene.registry.valid(tc.parent))
+        const auto &rb = view.get<RigidBodyComponent>(entity);
+        if (rb.body && rb.body->isStaticOrKinematicObject())
         {
-            glm::mat4 parentWorld = GetCachedWorldMatrix(tc.parent);
-            result = parentWorld * local;
+            m_DrivenEntities.push_back(entity);
+            m_DrivenVersions.push_back(NEVER_PUSHED);
         }
-        else
-        {
-            result = local;
-        }
-    }
-    else
-    {
-        result = glm::mat4(1.0f);
     }
 
-    m_worldMatrixCache[entity] = result;
-    return result;
+    m_Stats.bodies = static_cast<int>(m_Scene.registry.storage<RigidBodyComponent>().size());
+    m_NeedsRebuild = false;
 }
 
 void PhysicsTransformSync::SyncToPhysics()
 {
-    m_simulationQuery.Update(m_Scene.registry);
-    m_worldMatrixCache.clear();
-
-    const auto &entities = m_simulationQuery.GetEntities();
+    if (m_NeedsRebuild)
+        Rebuild();
 
-    for (auto entity : entities)
+    m_Stats.toPhysics = 0;
+    for (size_t i = 0; i < m_DrivenEntities.size(); ++i)
     {
+        entt::entity entity = m_DrivenEntities[i];
         auto &rb = m_Scene.registry.get<RigidBodyComponent>(entity);
         auto &transform = m_Scene.registry.get<TransformComponent>(entity);
 
-        if (!rb.body)
+        // Resolved by the TransformSystem pass that runs ahead of each physics step
+        if (!rb.body || !m_Scene.registry.valid(transform.parent) || transform.GetWorldVersion() == m_DrivenVersions[i])
             continue;
 
-        bool isDynamic = !rb.body->isStaticOrKinematicObject();
-        bool isKinematic = rb.body->isKinematicObject();
-        bool hasParent = m_Scene.registry.valid(transform.parent);
+        m_DrivenVersions[i] = transform.GetWorldVersion();
+        ++m_Stats.toPhysics;
+
+        const glm::mat4 &worldMatrix = transform.GetWorldMatrix();
+        glm::vec3 worldPos = glm::vec3(worldMatrix[3]);
+        glm::quat worldRot = glm::quat_cast(worldMatrix);
 
-        if ((!isDynamic || isKinematic) && hasParent)
+        btTransform tr;
+        tr.setIdentity();
+        tr.setOrigin(BulletGLMHelpers::convert(worldPos));
+        tr.setRotation(BulletGLMHelpers::convert(worldRot));
+
+        rb.body->setWorldTransform(tr);
+        if (rb.body->getMotionState())
         {
-            glm::mat4 worldMatrix = GetCachedWorldMatrix(entity);
-            glm::vec3 worldPos = glm::vec3(worldMatrix[3]);
-            glm::quat worldRot = glm::quat_cast(worldMatrix);
-
-            btTransform tr;
-            tr.setIdentity();
-            tr.setOrigin(BulletGLMHelpers::convert(worldPos));
-            tr.setRotation(BulletGLMHelpers::convert(worldRot));
-
-            rb.body->setWorldTransform(tr);
-            if (rb.body->getMotionState())
-            {
-                rb.body->getMotionState()->setWorldTransform(tr);
-            }
+            rb.body->getMotionState()->setWorldTransform(tr);
         }
     }
 }
 
 void PhysicsTransformSync::SyncFromPhysics()
 {
-    const auto &entities = m_simulationQuery.GetEntities();
+    PhysicsChangeList &changes = m_Physics.GetPoseChanges();
+    m_Stats.fromPhysics = 0;
 
-    for (auto entity : entities)
+    for (const PhysicsPoseChange &change : changes.GetChanges())
     {
-        auto &rb = m_Scene.registry.get<RigidBodyComponent>(entity);
-        auto &transform = m_Scene.registry.get<TransformComponent>(entity);
+        if (!m_Scene.registry.valid(change.entity))
+            continue;
+        auto *rb = m_Scene.registry.try_get<RigidBodyComponent>(change.entity);
+        auto *transform = m_Scene.registry.try_get<TransformComponent>(change.entity);
+        // The body may have been destroyed, and its entity id reused, since the step
+        if (!rb || !transform || rb->body != change.body)
+            continue;
+
+        WriteWorldPose(*transform, *rb, change.position, change.rotation);
+        ++m_Stats.fromPhysics;
+    }
+    changes.Clear();
+}
+
+void PhysicsTransformSync::CaptureSnapshot()
+{
+    PhysicsChangeList &changes = m_Physics.GetPoseChanges();
+    m_Stats.fromPhysics = 0;
+
+    // Bodies that were blending hold their current pose unless the step moved them again
+    for (entt::entity entity : m_MovingEntities)
+    {
+        if (auto *rb = m_Scene.registry.try_get<RigidBodyComponent>(entity))
+        {
+            rb->snapshot.previousPosition = rb->snapshot.currentPosition;
+            rb->snapshot.previousRotation = rb->snapshot.currentRotation;
+            rb->snapshot.moving = false;
+        }
+    }
+
+    for (const PhysicsPoseChange &change : changes.GetChanges())
+    {
+        if (!m_Scene.registry.valid(change.entity))
+            continue;
+        auto *rb = m_Scene.registry.try_get<RigidBodyComponent>(change.entity);
+        if (!rb || rb->body != change.body)
+            continue;
+
+        RigidBodySnapshot &snapshot = rb->snapshot;
+        if (!snapshot.tracked)
+        {
+            // At rest until now, so previous already equals current
+            snapshot.tracked = true;
+            m_MovingEntities.push_back(change.entity);
+        }
+        snapshot.currentPosition = change.position;
+        snapshot.currentRotation = change.rotation;
+        if (!snapshot.valid)
+        {
+            snapshot.previousPosition = snapshot.currentPosition;
+            snapshot.previousRotation = snapshot.currentRotation;
+            snapshot.valid = true;
+        }
+        snapshot.moving = true;
+        ++m_Stats.fromPhysics;
+    }
+    changes.Clear();
+
+    // Drop bodies that came to rest, leaving them exactly at their final pose
+    size_t kept = 0;
+    for (entt::entity entity : m_MovingEntities)
+    {
+        if (!m_Scene.registry.valid(entity))
+            continue;
+        auto *rb = m_Scene.registry.try_get<RigidBodyComponent>(entity);
+        auto *transform = m_Scene.registry.try_get<TransformComponent>(entity);
+        if (!rb || !transform)
+            continue;
+
+        if (rb->snapshot.moving)
+        {
+            m_MovingEntities[kept++] = entity;
+            continue;
+        }
+        rb->snapshot.tracked = false;
+        WriteWorldPose(*transform, *rb, rb->snapshot.currentPosition, rb->snapshot.currentRotation);
+    }
+    m_MovingEntities.resize(kept);
+}
 
-        if (!rb.body)
+void PhysicsTransformSync::ApplySnapshot(float alpha)
+{
+    alpha = glm::clamp(alpha, 0.0f, 1.0f);
+
+    for (entt::entity entity : m_MovingEntities)
+    {
+        if (!m_Scene.registry.valid(entity))
             continue;
+        auto *rb = m_Scene.registry.try_get<RigidBodyComponent>(entity);
+        auto *transform = m_Scene.registry.try_get<TransformComponent>(entity);
+        if (!rb || !transform)
+            continue;
+
+        const RigidBodySnapshot &snapshot = rb->snapshot;
+        glm::vec3 position = glm::mix(snapshot.previousPosition, snapshot.currentPosition, alpha);
+        glm::quat rotation = glm::slerp(snapshot.previousRotation, snapshot.currentRotation, alpha);
+        WriteWorldPose(*transform, *rb, position, rotation);
+    }
+}
 
-        bool isDynamic = !rb.body->isStaticOrKinematicObject();
-        bool hasParent = m_Scene.registry.valid(transform.parent);
+void PhysicsTransformSync::ResetSnapshots()
+{
+    for (auto [entity, rb] : m_Scene.registry.view<RigidBodyComponent>().each())
+        rb.snapshot = RigidBodySnapshot();
+    m_MovingEntities.clear();
+}
 
-        if (isDynamic && rb.body->isActive())
+void PhysicsTransformSync::WriteWorldPose(TransformComponent &transform, const RigidBodyComponent &rb, const glm::vec3 &worldPos, const glm::quat &worldRot)
+{
+    if (m_Scene.registry.valid(transform.parent) && rb.isParentMatter)
+    {
+        if (m_Scene.registry.all_of<TransformComponent>(transform.parent))
         {
-            btTransform trans;
-            if (rb.body->getMotionState())
-                rb.body->getMotionState()->getWorldTransform(trans);
-            else
-                trans = rb.body->getWorldTransform();
-
-            glm::vec3 worldPos = BulletGLMHelpers::convert(trans.getOrigin());
-            glm::quat worldRot = BulletGLMHelpers::convert(trans.getRotation());
-
-            if (hasParent && rb.isParentMatter)
-            {
-                if (m_Scene.registry.all_of<TransformComponent>(transform.parent))
-                {
-                    glm::mat4 parentWorldMatrix = GetCachedWorldMatrix(transform.parent);
-                    glm::mat4 validWorldMatrix = glm::translate(glm::mat4(1.0f), worldPos) * glm::mat4_cast(worldRot);
-                    glm::mat4 localMatrix = glm::inverse(parentWorldMatrix) * validWorldMatrix;
-
-                    glm::vec3 s, t, skew;
-                    glm::quat r;
-                    glm::vec4 perspective;
-                    glm::decompose(localMatrix, s, r, t, skew, perspective);
-
-                    transform.position = t;
-                    transform.rotation = r;
-                }
-            }
-            else
-            {
-                transform.position = worldPos;
-                transform.rotation = worldRot;
-            }
+            const glm::mat4 &parentWorldMatrix = m_Scene.registry.get<TransformComponent>(transform.parent).GetWorldMatrix();
+            glm::mat4 validWorldMatrix = glm::translate(glm::mat4(1.0f), worldPos) * glm::mat4_cast(worldRot);
+            glm::mat4 localMatrix = glm::inverse(parentWorldMatrix) * validWorldMatrix;
+
+            glm::vec3 s, t, skew;
+            glm::quat r;
+            glm::vec4 perspective;
+            glm::decompose(localMatrix, s, r, t, skew, perspective);
+
+            transform.position = t;
+            transform.rotation = r;
         }
     }
+    else
+    {
+        transform.position = worldPos;
+        transform.rotation = worldRot;
+    }
 }
 
 void PhysicsTransformSync::SyncTransformToPhysics(entt::entity entity)
@@ -160,6 +243,9 @@ void PhysicsTransformSync::SyncTransformToPhysics(entt::entity entity)
     if (!rb.body)
         return;
 
+    m_Physics.WaitForStep();
+    rb.snapshot.valid = false; // teleport: don't blend from the old pose
+
     glm::mat4 worldMatrix = transform.GetWorldModelMatrix(m_Scene.registry);
     glm::vec3 position = glm::vec3(worldMatrix[3]);
     glm::quat rotation = glm::quat_cast(worldMatrix);
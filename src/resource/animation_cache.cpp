@@ -11,7 +11,7 @@ AnimationCache::~AnimationCache()
     Clear();
 }
 
-void AnimationCache::LoadAnimation(const std::string& name, const std::string& path, Model* model)
+void AnimationCache::LoadAnimation(const std::string& name, const std::string& path, Model* model, const ClipCompressionSettings* compression)
 {
     if (!model)
     {
@@ -19,7 +19,21 @@ void AnimationCache::LoadAnimation(const std::string& name, const std::string& p
         return;
     }
     
-    m_Animations[name] = std::make_unique<Animation>(FileSystem::getPath(path), model);
+    auto animation = std::make_unique<Animation>(FileSystem::getPath(path), model);
+    if (compression)
+    {
+        animation->Compress(*compression);
+        const ClipCompressionReport& report = animation->GetCompressionReport();
+        float ratio = report.compressedBytes > 0 ? static_cast<float>(report.rawBytes) / report.compressedBytes : 0.0f;
+        LOGGER_INFO("AnimationCache") << "Compressed animation: " << name
+                                      << " | " << report.rawBytes / 1024.0f << " KB -> " << report.compressedBytes / 1024.0f << " KB (" << ratio << "x)"
+                                      << " | keys " << report.rawKeys << " -> " << report.keptKeys
+                                      << " | max error pos " << report.maxPositionError
+                                      << " rot " << report.maxRotationError << " rad"
+                                      << " scale " << report.maxScaleError;
+    }
+
+    m_Animations[name] = std::move(animation);
     LOGGER_INFO("AnimationCache") << "Loaded animation: " << name;
 }
 
@@ -32,7 +46,42 @@ Animation* AnimationCache::GetAnimation(const std::string& name)
     return nullptr;
 }
 
+void AnimationCache::BakeAnimation(const std::string& name, Model* model, const std::vector<std::string>& clipNames, float framesPerSecond)
+{
+    if (!model)
+    {
+        LOGGER_ERROR("AnimationCache") << "Model is null for baked animation: " << name;
+        return;
+    }
+
+    auto baked = std::make_unique<BakedAnimation>(model->GetBoneCount());
+    for (const std::string& clipName : clipNames)
+    {
+        if (Animation* clip = GetAnimation(clipName))
+            baked->AddClip(clipName, *clip, framesPerSecond);
+    }
+
+    if (baked->GetClipCount() == 0)
+    {
+        LOGGER_ERROR("AnimationCache") << "No clips to bake for: " << name;
+        return;
+    }
+
+    m_BakedAnimations[name] = std::move(baked);
+}
+
+BakedAnimation* AnimationCache::GetBakedAnimation(const std::string& name)
+{
+    auto it = m_BakedAnimations.find(name);
+    if (it != m_BakedAnimations.end())
+        return it->second.get();
+
+    LOGGER_WARN("AnimationCache") << "Baked animation not found: " << name;
+    return nullptr;
+}
+
 void AnimationCache::Clear()
 {
+    m_BakedAnimations.clear();
     m_Animations.clear();
 }
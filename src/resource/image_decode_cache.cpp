@@ -0,0 +1,76 @@
+#include <resource/image_decode_cache.h>
+
+ImageDecodeCache &ImageDecodeCache::Instance()
+{
+    static ImageDecodeCache instance;
+    return instance;
+}
+
+ImageDecodeCache::Handle ImageDecodeCache::Decode(const std::string &key, const std::function<bool(DecodedImage &)> &decode, bool *decoded)
+{
+    if (decoded)
+        *decoded = false;
+
+    std::promise<Handle> promise;
+    std::shared_future<Handle> pending;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        ++m_Stats.requests;
+
+        Entry &entry = m_Entries[key];
+        if (Handle image = entry.image.lock())
+            return image;
+        if (entry.pending.valid())
+            pending = entry.pending;
+        else
+            entry.pending = promise.get_future().share();
+    }
+
+    if (pending.valid())
+        return pending.get();
+
+    // Decoded outside the lock; other keys keep going and this key's requesters wait on the promise
+    auto image = std::make_shared<DecodedImage>();
+    Handle result;
+    try
+    {
+        if (decode(*image))
+            result = std::move(image);
+    }
+    catch (...)
+    {
+        // Waiters must still be released; a throwing decoder counts as a failed one
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        ++m_Stats.decodes;
+
+        Entry &entry = m_Entries[key];
+        entry.image = result;
+        entry.pending = {};
+    }
+    promise.set_value(result);
+
+    if (decoded)
+        *decoded = true;
+    return result;
+}
+
+void ImageDecodeCache::Trim()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    for (auto it = m_Entries.begin(); it != m_Entries.end();)
+    {
+        if (!it->second.pending.valid() && it->second.image.expired())
+            it = m_Entries.erase(it);
+        else
+            ++it;
+    }
+}
+
+ImageDecodeCache::Stats ImageDecodeCache::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Stats;
+}
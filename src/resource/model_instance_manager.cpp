@@ -38,6 +38,25 @@ Model* ModelInstanceManager::GetOrLoadModel(const std::string& name, const std::
     return model;
 }
 
+Model* ModelInstanceManager::AddModel(const std::string& name, Model* model)
+{
+    auto it = m_ModelPools.find(name);
+    if (it != m_ModelPools.end())
+    {
+        delete model;
+        it->second.refCount++;
+        return it->second.model;
+    }
+
+    ModelPool pool;
+    pool.model = model;
+    pool.refCount = 1;
+    m_ModelPools[name] = pool;
+
+    LOGGER_DEBUG("ModelInstanceManager") << "Added model '" << name << "'";
+    return model;
+}
+
 void ModelInstanceManager::AddInstance(const std::string& modelPath, const glm::mat4& transform, entt::entity entity)
 {
     auto it = m_ModelPools.find(modelPath);
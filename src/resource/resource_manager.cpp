@@ -74,7 +74,15 @@ void ResourceManager::LoadModel(const std::string &name, const std::string &path
     }
 }
 
-void ResourceManager::LoadAnimation(const std::string &name, const std::string &path, const std::string &modelName)
+void ResourceManager::LoadModel(const std::string &name, ModelImportData &&data, bool isStatic)
+{
+    // Like the synchronous path, a failed import still registers an empty model
+    m_ModelInstanceManager.AddModel(name, new Model(std::move(data)));
+    m_ModelPaths[name] = {name, isStatic};
+    LOGGER_INFO("ResourceManager") << "Loaded model: " << name;
+}
+
+void ResourceManager::LoadAnimation(const std::string &name, const std::string &path, const std::string &modelName, const ClipCompressionSettings *compression)
 {
     auto it = m_ModelPaths.find(modelName);
     if (it != m_ModelPaths.end())
@@ -83,7 +91,7 @@ void ResourceManager::LoadAnimation(const std::string &name, const std::string &
         if (model)
         {
             LOGGER_DEBUG("ResourceManager") << "Loading animation: " << name << " for model " << modelName;
-            m_AnimationCache.LoadAnimation(name, path, model);
+            m_AnimationCache.LoadAnimation(name, path, model, compression);
         }
     }
     else
@@ -92,6 +100,19 @@ void ResourceManager::LoadAnimation(const std::string &name, const std::string &
     }
 }
 
+void ResourceManager::BakeAnimation(const std::string &name, const std::string &modelName, const std::vector<std::string> &clipNames, float framesPerSecond)
+{
+    auto it = m_ModelPaths.find(modelName);
+    if (it == m_ModelPaths.end())
+    {
+        LOGGER_ERROR("ResourceManager") << "Model not found for baked animation: " << modelName;
+        return;
+    }
+
+    Model *model = m_ModelInstanceManager.GetOrLoadModel(modelName, it->second.path, it->second.isStatic);
+    m_AnimationCache.BakeAnimation(name, model, clipNames, framesPerSecond);
+}
+
 void ResourceManager::LoadFont(const std::string &name, const std::string &path, unsigned int fontSize)
 {
     m_FontCache.LoadFont(name, path, fontSize);
@@ -143,6 +164,11 @@ Animation *ResourceManager::GetAnimation(const std::string &name)
     return m_AnimationCache.GetAnimation(name);
 }
 
+BakedAnimation *ResourceManager::GetBakedAnimation(const std::string &name)
+{
+    return m_AnimationCache.GetBakedAnimation(name);
+}
+
 Font *ResourceManager::GetFont(const std::string &name)
 {
     return m_FontCache.GetFont(name);
@@ -4,10 +4,10 @@
 #include <utils/filesystem.h>
 #include <iostream>
 
-void ComponentLoader::LoadRenderer(Scene& scene, entt::entity entity, std::stringstream& ss, ResourceManager& res)
+void ComponentLoader::LoadRenderer(Scene& scene, entt::entity entity, SceneTokens& tokens, ResourceManager& res)
 {
     std::string modelName, shaderName;
-    ss >> modelName >> shaderName;
+    tokens.Read(modelName, shaderName);
     auto &r = scene.registry.emplace<MeshRendererComponent>(entity);
     r.model = res.GetModel(modelName);
     r.shader = res.GetShader(shaderName);
@@ -38,6 +38,30 @@ void ComponentLoader::LoadAnimator(Scene& scene, entt::entity entity, std::strin
     a.animator->SetUpdateRate(rate);
 }
 
+void ComponentLoader::LoadBakedAnimator(Scene& scene, entt::entity entity, std::stringstream& ss, ResourceManager& res)
+{
+    std::string bakedName, clipName;
+    ss >> bakedName >> clipName;
+
+    BakedAnimation *baked = res.GetBakedAnimation(bakedName);
+    if (!baked)
+        return;
+
+    int clip = baked->FindClip(clipName);
+    if (clip < 0)
+    {
+        LOGGER_WARN("ComponentLoader") << "Clip " << clipName << " is not baked into " << bakedName;
+        clip = 0;
+    }
+
+    auto &b = scene.registry.emplace<BakedAnimationComponent>(entity);
+    b.baked = baked;
+    b.clip = clip;
+
+    if (ss >> b.speed)
+        ss >> b.time;
+}
+
 void ComponentLoader::LoadLightDir(Scene& scene, entt::entity entity, std::stringstream& ss)
 {
     float r, g, b, i;
@@ -279,20 +303,25 @@ void ComponentLoader::LoadParticleEmitter(Scene& scene, entt::entity entity, std
     }
 }
 
-void ComponentLoader::LoadMaterial(Scene& scene, entt::entity entity, std::stringstream& ss)
+void ComponentLoader::LoadMaterial(Scene& scene, entt::entity entity, SceneTokens& tokens)
+{
+    scene.registry.emplace<MaterialComponent>(entity, ParseMaterial(tokens));
+}
+
+MaterialComponent ComponentLoader::ParseMaterial(SceneTokens& tokens)
 {
     std::string typeStr;
-    ss >> typeStr;
+    tokens.Next(typeStr);
 
     MaterialComponent mat;
 
     if (typeStr == "PBR")
     {
         mat.type = MaterialType::PBR;
-        ss >> mat.roughness >> mat.metallic >> mat.ao;
+        tokens.Read(mat.roughness, mat.metallic, mat.ao);
 
         float er = 0.0f, eg = 0.0f, eb = 0.0f;
-        if (ss >> er >> eg >> eb)
+        if (tokens.Read(er, eg, eb))
         {
             mat.emission = glm::vec3(er, eg, eb);
         }
@@ -301,17 +330,17 @@ void ComponentLoader::LoadMaterial(Scene& scene, entt::entity entity, std::strin
     {
         mat.type = MaterialType::PHONG;
         float r = 0.5f, g = 0.5f, b = 0.5f;
-        ss >> mat.shininess >> r >> g >> b;
+        tokens.Read(mat.shininess, r, g, b);
         mat.specular = glm::vec3(r, g, b);
 
         float er = 0.0f, eg = 0.0f, eb = 0.0f;
-        if (ss >> er >> eg >> eb)
+        if (tokens.Read(er, eg, eb))
         {
             mat.emission = glm::vec3(er, eg, eb);
         }
 
         float ar = 1.0f, ag = 1.0f, ab = 1.0f;
-        if (ss >> ar >> ag >> ab)
+        if (tokens.Read(ar, ag, ab))
         {
             mat.ambient = glm::vec3(ar, ag, ab);
         }
@@ -324,18 +353,18 @@ void ComponentLoader::LoadMaterial(Scene& scene, entt::entity entity, std::strin
             mat.shininess = std::stof(typeStr);
 
             float r = 0.5f, g = 0.5f, b = 0.5f;
-            if (ss >> r >> g >> b)
+            if (tokens.Read(r, g, b))
             {
                 mat.specular = glm::vec3(r, g, b);
             }
         }
         catch (...)
         {
-            LOGGER_WARN("ComponentLoader") << "Invalid MATERIAL format for entity " << (int)entity;
+            LOGGER_WARN("ComponentLoader") << "Invalid MATERIAL format: " << typeStr;
         }
     }
 
-    scene.registry.emplace<MaterialComponent>(entity, mat);
+    return mat;
 }
 
 void ComponentLoader::LoadCamera(Scene& scene, entt::entity entity, std::stringstream& ss)
@@ -0,0 +1,283 @@
+#include <scene/dynamic_aabb_tree.h>
+
+int32_t DynamicAABBTree::AllocateNode()
+{
+    if (m_FreeList == NULL_NODE)
+    {
+        m_Nodes.emplace_back();
+        return static_cast<int32_t>(m_Nodes.size() - 1);
+    }
+
+    int32_t nodeId = m_FreeList;
+    m_FreeList = m_Nodes[nodeId].parent;
+    m_Nodes[nodeId] = Node();
+    return nodeId;
+}
+
+void DynamicAABBTree::FreeNode(int32_t nodeId)
+{
+    Node &node = m_Nodes[nodeId];
+    node.parent = m_FreeList;
+    node.child1 = NULL_NODE;
+    node.child2 = NULL_NODE;
+    node.height = -1;
+    node.entity = entt::null;
+    m_FreeList = nodeId;
+}
+
+int32_t DynamicAABBTree::CreateProxy(const glm::vec3 &min, const glm::vec3 &max, entt::entity entity, uint32_t userData)
+{
+    int32_t proxyId = AllocateNode();
+    Node &node = m_Nodes[proxyId];
+    node.min = min - glm::vec3(m_Margin);
+    node.max = max + glm::vec3(m_Margin);
+    node.height = 0;
+    node.entity = entity;
+    node.userData = userData;
+
+    InsertLeaf(proxyId);
+    ++m_ProxyCount;
+    return proxyId;
+}
+
+void DynamicAABBTree::DestroyProxy(int32_t proxyId)
+{
+    RemoveLeaf(proxyId);
+    FreeNode(proxyId);
+    --m_ProxyCount;
+}
+
+bool DynamicAABBTree::MoveProxy(int32_t proxyId, const glm::vec3 &min, const glm::vec3 &max)
+{
+    Node &node = m_Nodes[proxyId];
+    if (glm::all(glm::lessThanEqual(node.min, min)) && glm::all(glm::greaterThanEqual(node.max, max)))
+        return false;
+
+    RemoveLeaf(proxyId);
+
+    Node &moved = m_Nodes[proxyId];
+    moved.min = min - glm::vec3(m_Margin);
+    moved.max = max + glm::vec3(m_Margin);
+
+    InsertLeaf(proxyId);
+    return true;
+}
+
+void DynamicAABBTree::Clear()
+{
+    m_Nodes.clear();
+    m_Root = NULL_NODE;
+    m_FreeList = NULL_NODE;
+    m_ProxyCount = 0;
+}
+
+void DynamicAABBTree::Refit(int32_t nodeId)
+{
+    Node &node = m_Nodes[nodeId];
+    const Node &child1 = m_Nodes[node.child1];
+    const Node &child2 = m_Nodes[node.child2];
+    node.min = glm::min(child1.min, child2.min);
+    node.max = glm::max(child1.max, child2.max);
+    node.height = 1 + (std::max)(child1.height, child2.height);
+}
+
+void DynamicAABBTree::InsertLeaf(int32_t leaf)
+{
+    if (m_Root == NULL_NODE)
+    {
+        m_Root = leaf;
+        m_Nodes[leaf].parent = NULL_NODE;
+        return;
+    }
+
+    glm::vec3 leafMin = m_Nodes[leaf].min;
+    glm::vec3 leafMax = m_Nodes[leaf].max;
+
+    // Descend towards the sibling with the lowest surface-area cost
+    int32_t index = m_Root;
+    while (!m_Nodes[index].IsLeaf())
+    {
+        const Node &node = m_Nodes[index];
+
+        float area = SurfaceArea(node.min, node.max);
+        float combinedArea = SurfaceArea(glm::min(node.min, leafMin), glm::max(node.max, leafMax));
+
+        float cost = 2.0f * combinedArea;
+        float inheritanceCost = 2.0f * (combinedArea - area);
+
+        auto childCost = [&](int32_t childId)
+        {
+            const Node &child = m_Nodes[childId];
+            float unionArea = SurfaceArea(glm::min(child.min, leafMin), glm::max(child.max, leafMax));
+            if (child.IsLeaf())
+                return unionArea + inheritanceCost;
+            return unionArea - SurfaceArea(child.min, child.max) + inheritanceCost;
+        };
+
+        float cost1 = childCost(node.child1);
+        float cost2 = childCost(node.child2);
+
+        if (cost < cost1 && cost < cost2)
+            break;
+
+        index = cost1 < cost2 ? node.child1 : node.child2;
+    }
+
+    int32_t sibling = index;
+    int32_t oldParent = m_Nodes[sibling].parent;
+    int32_t newParent = AllocateNode();
+
+    Node &parentNode = m_Nodes[newParent];
+    parentNode.parent = oldParent;
+    parentNode.min = glm::min(m_Nodes[sibling].min, leafMin);
+    parentNode.max = glm::max(m_Nodes[sibling].max, leafMax);
+    parentNode.height = m_Nodes[sibling].height + 1;
+    parentNode.child1 = sibling;
+    parentNode.child2 = leaf;
+
+    if (oldParent != NULL_NODE)
+    {
+        if (m_Nodes[oldParent].child1 == sibling)
+            m_Nodes[oldParent].child1 = newParent;
+        else
+            m_Nodes[oldParent].child2 = newParent;
+    }
+    else
+    {
+        m_Root = newParent;
+    }
+
+    m_Nodes[sibling].parent = newParent;
+    m_Nodes[leaf].parent = newParent;
+
+    index = m_Nodes[leaf].parent;
+    while (index != NULL_NODE)
+    {
+        index = Balance(index);
+        Refit(index);
+        index = m_Nodes[index].parent;
+    }
+}
+
+void DynamicAABBTree::RemoveLeaf(int32_t leaf)
+{
+    if (leaf == m_Root)
+    {
+        m_Root = NULL_NODE;
+        return;
+    }
+
+    int32_t parent = m_Nodes[leaf].parent;
+    int32_t grandParent = m_Nodes[parent].parent;
+    int32_t sibling = m_Nodes[parent].child1 == leaf ? m_Nodes[parent].child2 : m_Nodes[parent].child1;
+
+    if (grandParent != NULL_NODE)
+    {
+        if (m_Nodes[grandParent].child1 == parent)
+            m_Nodes[grandParent].child1 = sibling;
+        else
+            m_Nodes[grandParent].child2 = sibling;
+        m_Nodes[sibling].parent = grandParent;
+        FreeNode(parent);
+
+        int32_t index = grandParent;
+        while (index != NULL_NODE)
+        {
+            index = Balance(index);
+            Refit(index);
+            index = m_Nodes[index].parent;
+        }
+    }
+    else
+    {
+        m_Root = sibling;
+        m_Nodes[sibling].parent = NULL_NODE;
+        FreeNode(parent);
+    }
+}
+
+// Rotates the taller grandchild up when A's subtrees differ in height by more than one.
+// Returns the node now occupying A's position.
+int32_t DynamicAABBTree::Balance(int32_t iA)
+{
+    Node &A = m_Nodes[iA];
+    if (A.IsLeaf() || A.height < 2)
+        return iA;
+
+    int32_t iB = A.child1;
+    int32_t iC = A.child2;
+    Node &B = m_Nodes[iB];
+    Node &C = m_Nodes[iC];
+
+    int32_t balance = C.height - B.height;
+
+    auto replaceInParent = [&](int32_t oldChild, int32_t newChild, int32_t parent)
+    {
+        if (parent == NULL_NODE)
+            m_Root = newChild;
+        else if (m_Nodes[parent].child1 == oldChild)
+            m_Nodes[parent].child1 = newChild;
+        else
+            m_Nodes[parent].child2 = newChild;
+    };
+
+    if (balance > 1)
+    {
+        int32_t iF = C.child1;
+        int32_t iG = C.child2;
+        Node &F = m_Nodes[iF];
+        Node &G = m_Nodes[iG];
+
+        C.child1 = iA;
+        C.parent = A.parent;
+        A.parent = iC;
+        replaceInParent(iA, iC, C.parent);
+
+        if (F.height > G.height)
+        {
+            C.child2 = iF;
+            A.child2 = iG;
+            G.parent = iA;
+        }
+        else
+        {
+            C.child2 = iG;
+            A.child2 = iF;
+            F.parent = iA;
+        }
+        Refit(iA);
+        Refit(iC);
+        return iC;
+    }
+
+    if (balance < -1)
+    {
+        int32_t iD = B.child1;
+        int32_t iE = B.child2;
+        Node &D = m_Nodes[iD];
+        Node &E = m_Nodes[iE];
+
+        B.child1 = iA;
+        B.parent = A.parent;
+        A.parent = iB;
+        replaceInParent(iA, iB, B.parent);
+
+        if (D.height > E.height)
+        {
+            B.child2 = iD;
+            A.child1 = iE;
+            E.parent = iA;
+        }
+        else
+        {
+            B.child2 = iE;
+            A.child1 = iD;
+            D.parent = iA;
+        }
+        Refit(iA);
+        Refit(iB);
+        return iB;
+    }
+
+    return iA;
+}
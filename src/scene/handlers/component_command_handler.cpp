@@ -12,9 +12,9 @@
 
 namespace SceneHandlers
 {
-    void ComponentCommandHandler::HandleRenderer(std::stringstream &ss, Scene &scene, entt::entity entity, ResourceManager &res)
+    void ComponentCommandHandler::HandleRenderer(SceneTokens &tokens, Scene &scene, entt::entity entity, ResourceManager &res)
     {
-        ComponentLoader::LoadRenderer(scene, entity, ss, res);
+        ComponentLoader::LoadRenderer(scene, entity, tokens, res);
     }
 
     void ComponentCommandHandler::HandleAnimator(std::stringstream &ss, Scene &scene, entt::entity entity, ResourceManager &res)
@@ -22,9 +22,14 @@ namespace SceneHandlers
         ComponentLoader::LoadAnimator(scene, entity, ss, res);
     }
 
-    void ComponentCommandHandler::HandleMaterial(std::stringstream &ss, Scene &scene, entt::entity entity)
+    void ComponentCommandHandler::HandleBakedAnimator(std::stringstream &ss, Scene &scene, entt::entity entity, ResourceManager &res)
     {
-        ComponentLoader::LoadMaterial(scene, entity, ss);
+        ComponentLoader::LoadBakedAnimator(scene, entity, ss, res);
+    }
+
+    void ComponentCommandHandler::HandleMaterial(SceneTokens &tokens, Scene &scene, entt::entity entity)
+    {
+        ComponentLoader::LoadMaterial(scene, entity, tokens);
     }
 
     void ComponentCommandHandler::HandleVideoMap(std::stringstream &ss, Scene &scene, entt::entity entity)
@@ -148,10 +153,10 @@ namespace SceneHandlers
     }
 
     // Physics
-    void ComponentCommandHandler::HandleRigidBody(std::stringstream &ss, Scene &scene, entt::entity entity,
-                                                  PhysicsWorld &phys, std::ifstream &file)
+    void ComponentCommandHandler::HandleRigidBody(SceneTokens &tokens, Scene &scene, entt::entity entity,
+                                                  PhysicsWorld &phys, SceneLineReader &lines)
     {
-        PhysicsLoader::LoadRigidBody(scene, entity, ss, phys, file);
+        PhysicsLoader::LoadRigidBody(scene, entity, tokens, phys, lines);
     }
 
     // UI
@@ -7,28 +7,32 @@
 
 namespace SceneHandlers
 {
-    entt::entity EntityCommandHandler::HandleNewEntity(std::stringstream& ss, Scene& scene)
+    entt::entity EntityCommandHandler::HandleNewEntity(SceneTokens& tokens, Scene& scene)
     {
         entt::entity entity = scene.createEntity();
         
         std::string entityName = "unnamed";
         std::string entityTag = "default";
         
-        if (ss >> entityName)
+        if (tokens.Next(entityName))
         {
-            ss >> entityTag;
+            tokens.Next(entityTag);
         }
         
         scene.registry.emplace<InfoComponent>(entity, entityName, entityTag);
         return entity;
     }
 
-    void EntityCommandHandler::HandleTransform(std::stringstream& ss, Scene& scene, entt::entity entity)
+    void EntityCommandHandler::HandleTransform(SceneTokens& tokens, Scene& scene, entt::entity entity)
     {
-        float x, y, z, rx, ry, rz, sx, sy, sz;
-        ss >> x >> y >> z >> rx >> ry >> rz >> sx >> sy >> sz;
+        ReadTransform(tokens, scene.registry.get_or_emplace<TransformComponent>(entity));
+    }
+
+    void EntityCommandHandler::ReadTransform(SceneTokens& tokens, TransformComponent& t)
+    {
+        float x = 0.0f, y = 0.0f, z = 0.0f, rx = 0.0f, ry = 0.0f, rz = 0.0f, sx = 1.0f, sy = 1.0f, sz = 1.0f;
+        tokens.Read(x, y, z, rx, ry, rz, sx, sy, sz);
         
-        auto& t = scene.registry.get_or_emplace<TransformComponent>(entity);
         t.position = glm::vec3(x, y, z);
         t.rotation = glm::quat(glm::radians(glm::vec3(rx, ry, rz)));
         t.scale = glm::vec3(sx, sy, sz);
@@ -39,18 +43,7 @@ namespace SceneHandlers
         std::string parentName;
         ss >> parentName;
 
-        entt::entity parentEntity = entt::null;
-        auto view = scene.registry.view<InfoComponent>();
-        
-        for (auto e : view)
-        {
-            const auto& info = view.get<InfoComponent>(e);
-            if (info.name == parentName)
-            {
-                parentEntity = e;
-                break;
-            }
-        }
+        entt::entity parentEntity = scene.FindByName(parentName);
 
         if (parentEntity != entt::null)
         {
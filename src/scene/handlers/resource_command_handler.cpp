@@ -25,9 +25,39 @@ namespace SceneHandlers
     {
         std::string name, modelName, path;
         ss >> name >> modelName >> path;
+
+        // LOAD_ANIMATION <name> <model> <path> [COMPRESSED [pos_tol rot_tol scale_tol]]
+        std::string option;
+        if (ss >> option && option == "COMPRESSED")
+        {
+            ClipCompressionSettings settings;
+            float posTol, rotTol, scaleTol;
+            if (ss >> posTol >> rotTol >> scaleTol)
+            {
+                settings.positionTolerance = posTol;
+                settings.rotationTolerance = rotTol;
+                settings.scaleTolerance = scaleTol;
+            }
+            res.LoadAnimation(name, path, modelName, &settings);
+            return;
+        }
         res.LoadAnimation(name, path, modelName);
     }
 
+    void ResourceCommandHandler::HandleBakeAnimation(std::stringstream& ss, ResourceManager& res)
+    {
+        std::string name, modelName;
+        float fps = 30.0f;
+        ss >> name >> modelName >> fps;
+
+        std::vector<std::string> clips;
+        std::string clip;
+        while (ss >> clip)
+            clips.push_back(clip);
+
+        res.BakeAnimation(name, modelName, clips, fps);
+    }
+
     void ResourceCommandHandler::HandleLoadFont(std::stringstream& ss, ResourceManager& res)
     {
         std::string name, path;
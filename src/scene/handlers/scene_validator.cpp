@@ -20,21 +20,11 @@ namespace SceneHandlers
         if (deferredChildren.empty())
             return;
 
-        auto view = scene.registry.view<InfoComponent>();
         for (const auto &[parentEntity, childNames] : deferredChildren)
         {
             for (const auto &childName : childNames)
             {
-                entt::entity childEntity = entt::null;
-                for (auto entity : view)
-                {
-                    if (view.get<InfoComponent>(entity).name == childName)
-                    {
-                        childEntity = entity;
-                        break;
-                    }
-                }
-
+                entt::entity childEntity = scene.FindByName(childName);
                 if (childEntity != entt::null)
                 {
                     if (scene.registry.all_of<TransformComponent>(childEntity) &&
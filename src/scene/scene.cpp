@@ -48,9 +48,9 @@ void Scene::destroyEntity(entt::entity entity, SceneManager *manager)
     {
         if (rb->body)
         {
+            // Without the manager the body stays in the world until PhysicsWorld::Clear frees it
             if (manager)
-                manager->GetPhysicsWorld().GetWorld()->removeRigidBody(rb->body);
-            delete rb->body;
+                manager->GetPhysicsWorld().DestroyRigidBody(rb->body);
             rb->body = nullptr;
         }
     }
@@ -147,6 +147,94 @@ void Scene::SetActiveSkybox(entt::entity entity)
     }
 }
 
+entt::entity Scene::FindByName(std::string_view name) const
+{
+    return m_NameIndex.FindByName(name);
+}
+
+std::vector<entt::entity> Scene::FindByTag(std::string_view tag) const
+{
+    return m_NameIndex.FindAllByTag(tag);
+}
+
+void Scene::RenameEntity(entt::entity entity, const std::string &name)
+{
+    if (registry.valid(entity) && registry.all_of<InfoComponent>(entity))
+        registry.patch<InfoComponent>(entity, [&](InfoComponent &info) { info.name = name; });
+}
+
+void Scene::SetEntityTag(entt::entity entity, const std::string &tag)
+{
+    if (registry.valid(entity) && registry.all_of<InfoComponent>(entity))
+        registry.patch<InfoComponent>(entity, [&](InfoComponent &info) { info.tag = tag; });
+}
+
+std::vector<entt::entity> Scene::QueryBox(const glm::vec3 &min, const glm::vec3 &max) const
+{
+    std::vector<entt::entity> result;
+    m_SpatialTree.QueryBox(min, max, [&](int32_t proxyId)
+    {
+        entt::entity entity = m_SpatialTree.GetEntity(proxyId);
+        if (const auto *bounds = registry.try_get<WorldBoundsComponent>(entity))
+        {
+            if (glm::all(glm::lessThanEqual(bounds->min, max)) && glm::all(glm::greaterThanEqual(bounds->max, min)))
+                result.push_back(entity);
+        }
+        return true;
+    });
+    return result;
+}
+
+std::vector<entt::entity> Scene::QuerySphere(const glm::vec3 &center, float radius) const
+{
+    std::vector<entt::entity> result;
+    m_SpatialTree.QuerySphere(center, radius, [&](int32_t proxyId)
+    {
+        entt::entity entity = m_SpatialTree.GetEntity(proxyId);
+        if (const auto *bounds = registry.try_get<WorldBoundsComponent>(entity))
+        {
+            glm::vec3 closest = glm::clamp(center, bounds->min, bounds->max);
+            glm::vec3 d = closest - center;
+            if (glm::dot(d, d) <= radius * radius)
+                result.push_back(entity);
+        }
+        return true;
+    });
+    return result;
+}
+
+bool Scene::Raycast(const glm::vec3 &origin, const glm::vec3 &direction, float maxDistance, SceneRaycastHit &hit) const
+{
+    float length = glm::length(direction);
+    if (length <= 0.0f)
+        return false;
+
+    glm::vec3 dir = direction / length;
+    glm::vec3 invDir = 1.0f / dir;
+    hit = SceneRaycastHit();
+    float best = maxDistance;
+
+    m_SpatialTree.Raycast(origin, dir, maxDistance, [&](int32_t proxyId, float)
+    {
+        entt::entity entity = m_SpatialTree.GetEntity(proxyId);
+        const auto *bounds = registry.try_get<WorldBoundsComponent>(entity);
+        if (!bounds)
+            return best;
+
+        float entry, exit;
+        if (DynamicAABBTree::IntersectRay(origin, invDir, bounds->min, bounds->max, entry, exit) && entry < best)
+        {
+            best = entry;
+            hit.entity = entity;
+            hit.distance = entry;
+            hit.point = origin + dir * entry;
+        }
+        return best;
+    });
+
+    return hit.entity != entt::null;
+}
+
 void Scene::InitializeManagers()
 {
     lightManager = std::make_unique<LightManager>(*this);
@@ -0,0 +1,283 @@
+#include <scene/scene_cooker.h>
+#include <scene/cooked_scene_format.h>
+#include <scene/scene_tokenizer.h>
+#include <scene/component_loader.h>
+#include <scene/handlers/entity_command_handler.h>
+#include <physic/physics_loader.h>
+#include <ecs/component.h>
+#include <utils/mapped_file.h>
+#include <utils/logger.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    class StringTable
+    {
+    public:
+        uint32_t Intern(std::string_view text)
+        {
+            auto [it, inserted] = m_Ids.try_emplace(std::string(text), static_cast<uint32_t>(m_Refs.size()));
+            if (inserted)
+            {
+                m_Refs.push_back({static_cast<uint32_t>(m_Data.size()), static_cast<uint32_t>(text.size())});
+                m_Data.append(text);
+            }
+            return it->second;
+        }
+
+        const std::vector<CookedScene::StringRef> &GetRefs() const { return m_Refs; }
+        const std::string &GetData() const { return m_Data; }
+
+    private:
+        std::unordered_map<std::string, uint32_t> m_Ids;
+        std::vector<CookedScene::StringRef> m_Refs;
+        std::string m_Data;
+    };
+
+    bool IsResourceCommand(SceneCommand command)
+    {
+        switch (command)
+        {
+        case SceneCommand::LOAD_SHADER:
+        case SceneCommand::LOAD_MODEL:
+        case SceneCommand::LOAD_STATIC_MODEL:
+        case SceneCommand::LOAD_ANIMATION:
+        case SceneCommand::BAKE_ANIMATION:
+        case SceneCommand::LOAD_FONT:
+        case SceneCommand::LOAD_SOUND:
+        case SceneCommand::LOAD_SKYBOX:
+        case SceneCommand::LOAD_PARTICLE:
+        case SceneCommand::CONFIG:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    template <typename Record>
+    void AppendSection(std::string &blob, CookedScene::Section &section, const std::vector<Record> &records)
+    {
+        section.offset = static_cast<uint32_t>(blob.size());
+        section.count = static_cast<uint32_t>(records.size());
+        blob.append(reinterpret_cast<const char *>(records.data()), records.size() * sizeof(Record));
+    }
+
+    // Index of the entity's record in one of the per-component arrays; a repeated command overwrites it
+    template <typename Record>
+    Record &SlotFor(std::vector<Record> &records, std::vector<uint32_t> &slots, uint32_t entity, const char *command, int line)
+    {
+        if (slots.size() <= entity)
+            slots.resize(entity + 1, CookedScene::NO_ENTITY);
+
+        if (slots[entity] != CookedScene::NO_ENTITY)
+        {
+            LOGGER_WARN("SceneCooker") << "Line " << line << ": second " << command << " for one entity, keeping the last";
+            return records[slots[entity]];
+        }
+
+        slots[entity] = static_cast<uint32_t>(records.size());
+        return records.emplace_back();
+    }
+}
+
+bool SceneCooker::Cook(const std::string &scenePath, const std::string &outPath, SceneCookStats *stats)
+{
+    MappedFile file;
+    if (!file.Open(scenePath))
+    {
+        LOGGER_ERROR("SceneCooker") << "Could not open scene file: " << scenePath;
+        return false;
+    }
+
+    std::string blob;
+    CookText(file.View(), blob, stats);
+
+    std::ofstream out(outPath, std::ios::binary | std::ios::trunc);
+    if (!out.is_open() || !out.write(blob.data(), static_cast<std::streamsize>(blob.size())))
+    {
+        LOGGER_ERROR("SceneCooker") << "Could not write cooked scene: " << outPath;
+        return false;
+    }
+    return true;
+}
+
+void SceneCooker::CookText(std::string_view text, std::string &blob, SceneCookStats *stats)
+{
+    StringTable strings;
+    std::vector<CookedScene::Command> resources;
+    std::vector<CookedScene::Entity> entities;
+    std::vector<CookedScene::Transform> transforms;
+    std::vector<CookedScene::Renderer> renderers;
+    std::vector<CookedScene::Material> materials;
+    std::vector<CookedScene::Body> bodies;
+    std::vector<CookedScene::BodyChild> bodyChildren;
+    std::vector<CookedScene::Command> commands;
+    std::vector<uint32_t> transformSlots, rendererSlots, materialSlots, bodySlots;
+
+    uint32_t currentEntity = CookedScene::NO_ENTITY;
+
+    SceneLineReader lines(text);
+    std::string_view line;
+    while (lines.NextLine(line))
+    {
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        SceneTokens tokens(line);
+        SceneCommand command = LookupSceneCommand(tokens.Next());
+        if (command == SceneCommand::Unknown)
+            continue;
+
+        const int lineNumber = lines.GetLineNumber();
+        const bool packed = command == SceneCommand::TRANSFORM || command == SceneCommand::RENDERER ||
+                            command == SceneCommand::MATERIAL || command == SceneCommand::RIGIDBODY;
+        if (packed && currentEntity == CookedScene::NO_ENTITY)
+        {
+            LOGGER_WARN("SceneCooker") << "Line " << lineNumber << ": " << GetSceneCommandName(command) << " before any NEW_ENTITY, skipped";
+            if (command == SceneCommand::RIGIDBODY)
+                PhysicsLoader::ParseRigidBody(tokens, lines); // still step over a COMPOUND block
+            continue;
+        }
+
+        switch (command)
+        {
+        case SceneCommand::NEW_ENTITY:
+        {
+            std::string_view name = tokens.Next();
+            std::string_view tag = name.empty() ? std::string_view() : tokens.Next();
+            currentEntity = static_cast<uint32_t>(entities.size());
+            entities.push_back({strings.Intern(name.empty() ? "unnamed" : name), strings.Intern(tag.empty() ? "default" : tag)});
+            break;
+        }
+        case SceneCommand::TRANSFORM:
+        {
+            TransformComponent transform;
+            SceneHandlers::EntityCommandHandler::ReadTransform(tokens, transform);
+            auto &record = SlotFor(transforms, transformSlots, currentEntity, "TRANSFORM", lineNumber);
+            record.entity = currentEntity;
+            record.position = transform.position;
+            record.rotation = transform.rotation;
+            record.scale = transform.scale;
+            break;
+        }
+        case SceneCommand::RENDERER:
+        {
+            std::string_view model = tokens.Next();
+            std::string_view shader = tokens.Next();
+            auto &record = SlotFor(renderers, rendererSlots, currentEntity, "RENDERER", lineNumber);
+            record.entity = currentEntity;
+            record.model = strings.Intern(model);
+            record.shader = strings.Intern(shader);
+            break;
+        }
+        case SceneCommand::MATERIAL:
+        {
+            MaterialComponent mat = ComponentLoader::ParseMaterial(tokens);
+            auto &record = SlotFor(materials, materialSlots, currentEntity, "MATERIAL", lineNumber);
+            record.entity = currentEntity;
+            record.type = static_cast<uint32_t>(mat.type);
+            record.roughness = mat.roughness;
+            record.opacity = mat.opacity;
+            record.emission = mat.emission;
+            record.shininess = mat.shininess;
+            record.specular = mat.specular;
+            record.ambient = mat.ambient;
+            record.metallic = mat.metallic;
+            record.ao = mat.ao;
+            record.uvScale = mat.uvScale;
+            record.uvOffset = mat.uvOffset;
+            break;
+        }
+        case SceneCommand::RIGIDBODY:
+        {
+            RigidBodyDesc desc = PhysicsLoader::ParseRigidBody(tokens, lines);
+            auto &record = SlotFor(bodies, bodySlots, currentEntity, "RIGIDBODY", lineNumber);
+            record = {};
+            record.entity = currentEntity;
+            record.shape = static_cast<uint8_t>(desc.shape);
+            record.motion = static_cast<uint8_t>(desc.motion);
+            record.flags = static_cast<uint8_t>((desc.hasRotFactor ? CookedScene::BODY_HAS_ROT_FACTOR : 0) |
+                           (desc.isParentMatter ? CookedScene::BODY_PARENT_MATTER : 0) |
+                           (desc.isChildrenMatter ? CookedScene::BODY_CHILDREN_MATTER : 0) |
+                           (desc.isAttachedToParent ? CookedScene::BODY_ATTACH_TO_PARENT : 0));
+            record.size = desc.size;
+            record.mass = desc.mass;
+            record.centerOffset = desc.centerOffset;
+            record.restitution = desc.restitution;
+            record.angularFactor = desc.angularFactor;
+            record.linearFactor = desc.linearFactor;
+            record.firstChild = static_cast<uint32_t>(bodyChildren.size());
+            record.childCount = static_cast<uint32_t>(desc.children.size());
+            for (const RigidBodyChildDesc &child : desc.children)
+                bodyChildren.push_back({static_cast<uint32_t>(child.shape), child.size, child.position, child.eulerDegrees});
+            break;
+        }
+        default:
+        {
+            CookedScene::Command record{currentEntity, strings.Intern(tokens.Rest()), static_cast<uint32_t>(command)};
+            if (IsResourceCommand(command))
+            {
+                record.entity = CookedScene::NO_ENTITY;
+                resources.push_back(record);
+            }
+            else
+            {
+                commands.push_back(record);
+            }
+            break;
+        }
+        }
+    }
+
+    CookedScene::Header header{};
+    std::memcpy(header.magic, CookedScene::MAGIC, sizeof(header.magic));
+    header.version = CookedScene::VERSION;
+
+    blob.assign(sizeof(header), '\0');
+    AppendSection(blob, header.strings, strings.GetRefs());
+    AppendSection(blob, header.resources, resources);
+    AppendSection(blob, header.entities, entities);
+    AppendSection(blob, header.transforms, transforms);
+    AppendSection(blob, header.renderers, renderers);
+    AppendSection(blob, header.materials, materials);
+    AppendSection(blob, header.bodies, bodies);
+    AppendSection(blob, header.bodyChildren, bodyChildren);
+    AppendSection(blob, header.commands, commands);
+    header.stringData.offset = static_cast<uint32_t>(blob.size());
+    header.stringData.count = static_cast<uint32_t>(strings.GetData().size());
+    blob.append(strings.GetData());
+    header.fileSize = static_cast<uint32_t>(blob.size());
+    std::memcpy(blob.data(), &header, sizeof(header));
+
+    if (stats)
+    {
+        stats->entities = entities.size();
+        stats->transforms = transforms.size();
+        stats->renderers = renderers.size();
+        stats->materials = materials.size();
+        stats->bodies = bodies.size();
+        stats->commands = resources.size() + commands.size();
+        stats->strings = strings.GetRefs().size();
+        stats->bytes = blob.size();
+    }
+}
+
+std::string SceneCooker::GetCookedPath(const std::string &scenePath)
+{
+    return std::filesystem::path(scenePath).replace_extension(CookedScene::EXTENSION).string();
+}
+
+bool SceneCooker::IsCookedUpToDate(const std::string &scenePath, const std::string &cookedPath)
+{
+    std::error_code error;
+    auto cookedTime = std::filesystem::last_write_time(cookedPath, error);
+    if (error)
+        return false;
+    auto sourceTime = std::filesystem::last_write_time(scenePath, error);
+    return !error && cookedTime >= sourceTime;
+}
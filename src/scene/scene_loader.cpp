@@ -1,5 +1,6 @@
 #include <scene/scene_loader.h>
 #include <utils/logger.h>
+#include <utils/profiler.h>
 #include <scene/scene.h>
 #include <app/application.h>
 #include <script/script_registry.h>
@@ -8,6 +9,9 @@
 #include <physic/physics_loader.h>
 #include <scene/component_loader.h>
 #include <app/config_loader.h>
+#include <utils/mapped_file.h>
+#include <scene/scene_tokenizer.h>
+#include <scene/scene_cooker.h>
 
 #include <scene/handlers/resource_command_handler.h>
 #include <scene/handlers/entity_command_handler.h>
@@ -15,93 +19,192 @@
 #include <scene/handlers/scene_validator.h>
 
 #include <iostream>
-#include <fstream>
 #include <sstream>
 #include <map>
-#include <unordered_map>
-#include <functional>
 
 std::vector<entt::entity> SceneLoader::Load(const std::string &filePath, Scene &scene, ResourceManager &res, PhysicsWorld &phys, SoundManager &sound, Application *app)
 {
+    AXIS_PROFILE_SCOPE("SceneLoader::Load");
     std::string fullPath = FileSystem::getPath(filePath);
-    std::ifstream file(fullPath);
+    std::string cookedPath = SceneCooker::GetCookedPath(fullPath);
+    MappedFile file;
 
-    if (!file.is_open())
+    if (cookedPath != fullPath && SceneCooker::IsCookedUpToDate(fullPath, cookedPath) && file.Open(cookedPath))
+    {
+        if (IsCookedScene(file.View()))
+            LOGGER_INFO("SceneLoader") << "Using cooked scene: " << cookedPath;
+        else
+            file.Close();
+    }
+
+    if (!file.IsOpen() && !file.Open(fullPath))
     {
         LOGGER_ERROR("SceneLoader") << "Could not open scene file: " << fullPath;
         return {};
     }
 
     std::vector<entt::entity> loadedEntities;
-    std::map<entt::entity, std::vector<std::string>> deferredChildren;
-    entt::entity currentEntity = entt::null;
+    SceneLoadContext context{scene, res, phys, sound, app};
 
-    using HandlerFunc = std::function<void(std::stringstream&)>;
-    std::unordered_map<std::string, HandlerFunc> dispatchMap;
+    if (IsCookedScene(file.View()))
+    {
+        AXIS_PROFILE_SCOPE("SceneLoader::LoadCooked");
+        if (!LoadCooked(file.View(), context, loadedEntities))
+        {
+            // A stale or damaged sibling falls back to its text source
+            if (cookedPath == fullPath || !file.Open(fullPath) || IsCookedScene(file.View()))
+                return {};
+            LOGGER_WARN("SceneLoader") << "Re-run scene_cook for " << fullPath << "; parsing the text instead";
+            LoadText(file.View(), context, loadedEntities);
+        }
+    }
+    else
+    {
+        AXIS_PROFILE_SCOPE("SceneLoader::Parse");
+        LoadText(file.View(), context, loadedEntities);
+    }
 
-    // Resource loading commands
-    dispatchMap["LOAD_SHADER"] = [&](std::stringstream& ss) { SceneHandlers::ResourceCommandHandler::HandleLoadShader(ss, res); };
-    dispatchMap["LOAD_MODEL"] = [&](std::stringstream& ss) { SceneHandlers::ResourceCommandHandler::HandleLoadModel(ss, res, false); };
-    dispatchMap["LOAD_STATIC_MODEL"] = [&](std::stringstream& ss) { SceneHandlers::ResourceCommandHandler::HandleLoadModel(ss, res, true); };
-    dispatchMap["LOAD_ANIMATION"] = [&](std::stringstream& ss) { SceneHandlers::ResourceCommandHandler::HandleLoadAnimation(ss, res); };
-    dispatchMap["LOAD_FONT"] = [&](std::stringstream& ss) { SceneHandlers::ResourceCommandHandler::HandleLoadFont(ss, res); };
-    dispatchMap["LOAD_SOUND"] = [&](std::stringstream& ss) { SceneHandlers::ResourceCommandHandler::HandleLoadSound(ss, res, sound); };
-    dispatchMap["LOAD_SKYBOX"] = [&](std::stringstream& ss) { SceneHandlers::ResourceCommandHandler::HandleLoadSkybox(ss, res); };
-    dispatchMap["LOAD_PARTICLE"] = [&](std::stringstream& ss) { SceneHandlers::ResourceCommandHandler::HandleLoadParticle(ss, res); };
+    FinishLoad(fullPath, context, loadedEntities);
+    return loadedEntities;
+}
 
-    // Entity commands
-    dispatchMap["NEW_ENTITY"] = [&](std::stringstream& ss) { 
-        currentEntity = SceneHandlers::EntityCommandHandler::HandleNewEntity(ss, scene);
-        loadedEntities.push_back(currentEntity);
-    };
-    dispatchMap["TRANSFORM"] = [&](std::stringstream& ss) { SceneHandlers::EntityCommandHandler::HandleTransform(ss, scene, currentEntity); };
-    dispatchMap["PARENT"] = [&](std::stringstream& ss) { SceneHandlers::EntityCommandHandler::HandleParent(ss, scene, currentEntity); };
-    dispatchMap["CHILDREN"] = [&](std::stringstream& ss) { SceneHandlers::EntityCommandHandler::HandleChildren(ss, currentEntity, deferredChildren); };
+void SceneLoader::FinishLoad(const std::string &fullPath, SceneLoadContext &context, const std::vector<entt::entity> &loadedEntities)
+{
+    Scene &scene = context.scene;
+    PhysicsWorld &phys = context.phys;
+    {
+        AXIS_PROFILE_SCOPE("SceneLoader::Validate");
+        SceneHandlers::SceneValidator::ValidateParentChildRelationships(scene, context.deferredChildren);
+        SceneHandlers::SceneValidator::ValidateLights(scene);
+        SceneHandlers::SceneValidator::ValidatePhysicsSync(scene, phys);
 
-    // Component commands
-    dispatchMap["RENDERER"] = [&](std::stringstream& ss) { SceneHandlers::ComponentCommandHandler::HandleRenderer(ss, scene, currentEntity, res); };
-    dispatchMap["ANIMATOR"] = [&](std::stringstream& ss) { SceneHandlers::ComponentCommandHandler::HandleAnimator(ss, scene, currentEntity, res); };
-    dispatchMap["MATERIAL"] = [&](std::stringstream& ss) { SceneHandlers::ComponentCommandHandler::HandleMaterial(ss, scene, currentEntity); };
-    dispatchMap["VIDEO_MAP"] = [&](std::stringstream& ss) { SceneHandlers::ComponentCommandHandler::HandleVideoMap(ss, scene, currentEntity); };
-    dispatchMap["CAMERA"] = [&](std::stringstream& ss) { SceneHandlers::ComponentCommandHandler::HandleCamera(ss, scene, currentEntity); };
-    dispatchMap["RIGIDBODY"] = [&](std::stringstream& ss) { SceneHandlers::ComponentCommandHandler::HandleRigidBody(ss, scene, currentEntity, phys, file); };
-    dispatchMap["LIGHT_DIR"] = [&](std::stringstream& ss) { SceneHandlers::ComponentCommandHandler::HandleDirectionalLight(ss, scene, currentEntity); };
-    dispatchMap["LIGHT_POINT"] = [&](std::stringstream& ss) { SceneHandlers::ComponentCommandHandler::HandlePointLight(ss, scene, currentEntity); };
-    dispatchMap["LIGHT_SPOT"] = [&](std::stringstream& ss) { SceneHandlers::ComponentCommandHandler::HandleSpotLight(ss, scene, currentEntity); };
-    dispatchMap["UI_TRANSFORM"] = [&](std::stringstream& ss) { SceneHandlers::ComponentCommandHandler::HandleUITransform(ss, scene, currentEntity); };
-    dispatchMap["UI_RENDERER"] = [&](std::stringstream& ss) { SceneHandlers::ComponentCommandHandler::HandleUIRenderer(ss, scene, currentEntity, res); };
-    dispatchMap["UI_TEXT"] = [&](std::stringstream& ss) { SceneHandlers::ComponentCommandHandler::HandleUIText(ss, scene, currentEntity, res); };
-    dispatchMap["UI_ANIMATION"] = [&](std::stringstream& ss) { SceneHandlers::ComponentCommandHandler::HandleUIAnimation(ss, scene, currentEntity); };
-    dispatchMap["SKYBOX_RENDERER"] = [&](std::stringstream& ss) { SceneHandlers::ComponentCommandHandler::HandleSkyboxRenderer(ss, scene, currentEntity, res); };
-    dispatchMap["SCRIPT"] = [&](std::stringstream& ss) { SceneHandlers::ComponentCommandHandler::HandleScript(ss, scene, currentEntity, app); };
-    dispatchMap["AUDIO_SOURCE"] = [&](std::stringstream& ss) { SceneHandlers::ComponentCommandHandler::HandleAudioSource(ss, scene, currentEntity); };
-    dispatchMap["VIDEO_PLAYER"] = [&](std::stringstream& ss) { SceneHandlers::ComponentCommandHandler::HandleVideoPlayer(ss, scene, currentEntity); };
-    dispatchMap["PARTICLE_EMITTER"] = [&](std::stringstream& ss) { SceneHandlers::ComponentCommandHandler::HandleParticleEmitter(ss, scene, currentEntity, res); };
-    dispatchMap["CONFIG"] = [&](std::stringstream& ss) { ConfigLoader::LoadConfig(ss, app); };
-
-    std::string line;
-    while (std::getline(file, line))
+        SceneHandlers::SceneValidator::ValidateCamera(scene, context.app);
+    }
+
+    LOGGER_INFO("SceneLoader") << "Finished parsing scene file: " << fullPath << ". loaded " << loadedEntities.size() << " entities.";
+    const PhysicsShapeCache &shapes = phys.GetShapeCache();
+    LOGGER_INFO("SceneLoader") << "Physics: " << phys.GetBodyCount() << " bodies, " << shapes.GetUniqueCount()
+                               << " unique shapes for " << shapes.GetRequestCount() << " shape requests";
+}
+
+bool SceneLoader::ReadCooked(const std::string &fullPath, std::string &blob)
+{
+    std::string cookedPath = SceneCooker::GetCookedPath(fullPath);
+    MappedFile file;
+
+    if (cookedPath != fullPath && SceneCooker::IsCookedUpToDate(fullPath, cookedPath) && file.Open(cookedPath))
+    {
+        if (IsValidCooked(file.View()))
+        {
+            blob.assign(file.View());
+            return true;
+        }
+        LOGGER_WARN("SceneLoader") << "Re-run scene_cook for " << fullPath << "; parsing the text instead";
+    }
+
+    if (!file.Open(fullPath))
+    {
+        LOGGER_ERROR("SceneLoader") << "Could not open scene file: " << fullPath;
+        return false;
+    }
+
+    if (IsCookedScene(file.View()))
+    {
+        // A cooked file passed directly has no text to fall back on
+        blob.assign(file.View());
+        return IsValidCooked(blob);
+    }
+
+    SceneCooker::CookText(file.View(), blob);
+    return true;
+}
+
+void SceneLoader::LoadText(std::string_view text, SceneLoadContext &context, std::vector<entt::entity> &loadedEntities)
+{
+    Scene &scene = context.scene;
+    entt::entity &currentEntity = context.currentEntity;
+
+    SceneLineReader lines(text);
+    std::string_view line;
+    while (lines.NextLine(line))
     {
         if (line.empty() || line[0] == '#')
             continue;
 
-        std::stringstream ss(line);
-        std::string command;
-        ss >> command;
+        SceneTokens tokens(line);
+        SceneCommand command = LookupSceneCommand(tokens.Next());
 
-        auto it = dispatchMap.find(command);
-        if (it != dispatchMap.end())
+        // Bulk commands read straight from the mapped line; the rest still take a stream
+        switch (command)
         {
-            it->second(ss);
+        case SceneCommand::Unknown:
+            break;
+        case SceneCommand::NEW_ENTITY:
+            currentEntity = SceneHandlers::EntityCommandHandler::HandleNewEntity(tokens, scene);
+            loadedEntities.push_back(currentEntity);
+            break;
+        case SceneCommand::TRANSFORM:
+            SceneHandlers::EntityCommandHandler::HandleTransform(tokens, scene, currentEntity);
+            break;
+        case SceneCommand::RENDERER:
+            SceneHandlers::ComponentCommandHandler::HandleRenderer(tokens, scene, currentEntity, context.res);
+            break;
+        case SceneCommand::MATERIAL:
+            SceneHandlers::ComponentCommandHandler::HandleMaterial(tokens, scene, currentEntity);
+            break;
+        case SceneCommand::RIGIDBODY:
+            SceneHandlers::ComponentCommandHandler::HandleRigidBody(tokens, scene, currentEntity, context.phys, lines);
+            break;
+        default:
+            RunStreamCommand(command, tokens.Rest(), context);
+            break;
         }
     }
+}
 
-    SceneHandlers::SceneValidator::ValidateParentChildRelationships(scene, deferredChildren);
-    SceneHandlers::SceneValidator::ValidateLights(scene);
-    SceneHandlers::SceneValidator::ValidatePhysicsSync(scene, phys);
+void SceneLoader::RunStreamCommand(SceneCommand command, std::string_view args, SceneLoadContext &context)
+{
+    Scene &scene = context.scene;
+    ResourceManager &res = context.res;
+    entt::entity currentEntity = context.currentEntity;
+    Application *app = context.app;
+
+    std::stringstream ss{std::string(args)};
+    switch (command)
+    {
+    // Resource loading commands
+    case SceneCommand::LOAD_SHADER: SceneHandlers::ResourceCommandHandler::HandleLoadShader(ss, res); break;
+    case SceneCommand::LOAD_MODEL: SceneHandlers::ResourceCommandHandler::HandleLoadModel(ss, res, false); break;
+    case SceneCommand::LOAD_STATIC_MODEL: SceneHandlers::ResourceCommandHandler::HandleLoadModel(ss, res, true); break;
+    case SceneCommand::LOAD_ANIMATION: SceneHandlers::ResourceCommandHandler::HandleLoadAnimation(ss, res); break;
+    case SceneCommand::BAKE_ANIMATION: SceneHandlers::ResourceCommandHandler::HandleBakeAnimation(ss, res); break;
+    case SceneCommand::LOAD_FONT: SceneHandlers::ResourceCommandHandler::HandleLoadFont(ss, res); break;
+    case SceneCommand::LOAD_SOUND: SceneHandlers::ResourceCommandHandler::HandleLoadSound(ss, res, context.sound); break;
+    case SceneCommand::LOAD_SKYBOX: SceneHandlers::ResourceCommandHandler::HandleLoadSkybox(ss, res); break;
+    case SceneCommand::LOAD_PARTICLE: SceneHandlers::ResourceCommandHandler::HandleLoadParticle(ss, res); break;
 
-    SceneHandlers::SceneValidator::ValidateCamera(scene, app);
+    // Entity commands
+    case SceneCommand::PARENT: SceneHandlers::EntityCommandHandler::HandleParent(ss, scene, currentEntity); break;
+    case SceneCommand::CHILDREN: SceneHandlers::EntityCommandHandler::HandleChildren(ss, currentEntity, context.deferredChildren); break;
 
-    LOGGER_INFO("SceneLoader") << "Finished parsing scene file: " << fullPath << ". loaded " << loadedEntities.size() << " entities.";
-    return loadedEntities;
+    // Component commands
+    case SceneCommand::ANIMATOR: SceneHandlers::ComponentCommandHandler::HandleAnimator(ss, scene, currentEntity, res); break;
+    case SceneCommand::BAKED_ANIMATOR: SceneHandlers::ComponentCommandHandler::HandleBakedAnimator(ss, scene, currentEntity, res); break;
+    case SceneCommand::VIDEO_MAP: SceneHandlers::ComponentCommandHandler::HandleVideoMap(ss, scene, currentEntity); break;
+    case SceneCommand::CAMERA: SceneHandlers::ComponentCommandHandler::HandleCamera(ss, scene, currentEntity); break;
+    case SceneCommand::LIGHT_DIR: SceneHandlers::ComponentCommandHandler::HandleDirectionalLight(ss, scene, currentEntity); break;
+    case SceneCommand::LIGHT_POINT: SceneHandlers::ComponentCommandHandler::HandlePointLight(ss, scene, currentEntity); break;
+    case SceneCommand::LIGHT_SPOT: SceneHandlers::ComponentCommandHandler::HandleSpotLight(ss, scene, currentEntity); break;
+    case SceneCommand::UI_TRANSFORM: SceneHandlers::ComponentCommandHandler::HandleUITransform(ss, scene, currentEntity); break;
+    case SceneCommand::UI_RENDERER: SceneHandlers::ComponentCommandHandler::HandleUIRenderer(ss, scene, currentEntity, res); break;
+    case SceneCommand::UI_TEXT: SceneHandlers::ComponentCommandHandler::HandleUIText(ss, scene, currentEntity, res); break;
+    case SceneCommand::UI_ANIMATION: SceneHandlers::ComponentCommandHandler::HandleUIAnimation(ss, scene, currentEntity); break;
+    case SceneCommand::SKYBOX_RENDERER: SceneHandlers::ComponentCommandHandler::HandleSkyboxRenderer(ss, scene, currentEntity, res); break;
+    case SceneCommand::SCRIPT: SceneHandlers::ComponentCommandHandler::HandleScript(ss, scene, currentEntity, app); break;
+    case SceneCommand::AUDIO_SOURCE: SceneHandlers::ComponentCommandHandler::HandleAudioSource(ss, scene, currentEntity); break;
+    case SceneCommand::VIDEO_PLAYER: SceneHandlers::ComponentCommandHandler::HandleVideoPlayer(ss, scene, currentEntity); break;
+    case SceneCommand::PARTICLE_EMITTER: SceneHandlers::ComponentCommandHandler::HandleParticleEmitter(ss, scene, currentEntity, res); break;
+    case SceneCommand::CONFIG: ConfigLoader::LoadConfig(ss, app); break;
+    default: break;
+    }
 }
@@ -0,0 +1,327 @@
+#include <scene/scene_loader.h>
+#include <scene/cooked_scene_format.h>
+#include <scene/scene.h>
+#include <ecs/component.h>
+#include <physic/physics_loader.h>
+#include <resource/resource_manager.h>
+#include <utils/logger.h>
+
+#include <cstring>
+#include <unordered_map>
+
+namespace
+{
+    template <typename Record>
+    const Record *SectionData(std::string_view blob, const CookedScene::Section &section)
+    {
+        return reinterpret_cast<const Record *>(blob.data() + section.offset);
+    }
+
+    bool SectionFits(std::string_view blob, const CookedScene::Section &section, size_t recordSize, size_t alignment)
+    {
+        return section.offset % alignment == 0 &&
+               static_cast<uint64_t>(section.offset) + static_cast<uint64_t>(section.count) * recordSize <= blob.size();
+    }
+
+    // Every index in the blob is checked up front so a damaged file is rejected before anything loads
+    bool ValidateCooked(std::string_view blob, const CookedScene::Header &header)
+    {
+        using namespace CookedScene;
+        if (header.fileSize != blob.size() ||
+            !SectionFits(blob, header.strings, sizeof(StringRef), 4) ||
+            !SectionFits(blob, header.resources, sizeof(Command), 4) ||
+            !SectionFits(blob, header.entities, sizeof(Entity), 4) ||
+            !SectionFits(blob, header.transforms, sizeof(Transform), 4) ||
+            !SectionFits(blob, header.renderers, sizeof(Renderer), 4) ||
+            !SectionFits(blob, header.materials, sizeof(Material), 4) ||
+            !SectionFits(blob, header.bodies, sizeof(Body), 4) ||
+            !SectionFits(blob, header.bodyChildren, sizeof(BodyChild), 4) ||
+            !SectionFits(blob, header.commands, sizeof(Command), 4) ||
+            !SectionFits(blob, header.stringData, 1, 1))
+            return false;
+
+        const uint32_t stringCount = header.strings.count;
+        const uint32_t entityCount = header.entities.count;
+        auto entityOk = [&](uint32_t entity)
+        { return entity < entityCount; };
+        auto stringOk = [&](uint32_t id)
+        { return id < stringCount; };
+
+        const StringRef *refs = SectionData<StringRef>(blob, header.strings);
+        for (uint32_t i = 0; i < stringCount; ++i)
+        {
+            if (static_cast<uint64_t>(refs[i].offset) + refs[i].length > header.stringData.count)
+                return false;
+        }
+
+        const Entity *entities = SectionData<Entity>(blob, header.entities);
+        for (uint32_t i = 0; i < entityCount; ++i)
+        {
+            if (!stringOk(entities[i].name) || !stringOk(entities[i].tag))
+                return false;
+        }
+
+        const Command *resources = SectionData<Command>(blob, header.resources);
+        for (uint32_t i = 0; i < header.resources.count; ++i)
+        {
+            if (!stringOk(resources[i].args))
+                return false;
+        }
+
+        const Command *commands = SectionData<Command>(blob, header.commands);
+        for (uint32_t i = 0; i < header.commands.count; ++i)
+        {
+            if (!stringOk(commands[i].args) || (commands[i].entity != NO_ENTITY && !entityOk(commands[i].entity)))
+                return false;
+        }
+
+        const Transform *transforms = SectionData<Transform>(blob, header.transforms);
+        for (uint32_t i = 0; i < header.transforms.count; ++i)
+        {
+            if (!entityOk(transforms[i].entity))
+                return false;
+        }
+
+        const Renderer *renderers = SectionData<Renderer>(blob, header.renderers);
+        for (uint32_t i = 0; i < header.renderers.count; ++i)
+        {
+            if (!entityOk(renderers[i].entity) || !stringOk(renderers[i].model) || !stringOk(renderers[i].shader))
+                return false;
+        }
+
+        const Material *materials = SectionData<Material>(blob, header.materials);
+        for (uint32_t i = 0; i < header.materials.count; ++i)
+        {
+            if (!entityOk(materials[i].entity))
+                return false;
+        }
+
+        const Body *bodies = SectionData<Body>(blob, header.bodies);
+        for (uint32_t i = 0; i < header.bodies.count; ++i)
+        {
+            if (!entityOk(bodies[i].entity) ||
+                static_cast<uint64_t>(bodies[i].firstChild) + bodies[i].childCount > header.bodyChildren.count)
+                return false;
+        }
+        return true;
+    }
+
+    void ReadBody(const CookedScene::Body &record, const CookedScene::BodyChild *children, RigidBodyDesc &desc)
+    {
+        using namespace CookedScene;
+        desc.shape = static_cast<RigidBodyShapeType>(record.shape);
+        desc.motion = static_cast<RigidBodyMotionType>(record.motion);
+        desc.size = record.size;
+        desc.mass = record.mass;
+        desc.centerOffset = record.centerOffset;
+        desc.restitution = record.restitution;
+        desc.angularFactor = record.angularFactor;
+        desc.linearFactor = record.linearFactor;
+        desc.hasRotFactor = (record.flags & BODY_HAS_ROT_FACTOR) != 0;
+        desc.isParentMatter = (record.flags & BODY_PARENT_MATTER) != 0;
+        desc.isChildrenMatter = (record.flags & BODY_CHILDREN_MATTER) != 0;
+        desc.isAttachedToParent = (record.flags & BODY_ATTACH_TO_PARENT) != 0;
+        desc.children.clear();
+        for (uint32_t c = 0; c < record.childCount; ++c)
+        {
+            const BodyChild &child = children[record.firstChild + c];
+            desc.children.push_back({static_cast<RigidBodyShapeType>(child.shape), child.size, child.position, child.eulerDegrees});
+        }
+    }
+
+    CookedScene::Header ReadHeader(std::string_view blob)
+    {
+        CookedScene::Header header;
+        std::memcpy(&header, blob.data(), sizeof(header));
+        return header;
+    }
+}
+
+bool SceneLoader::IsCookedScene(std::string_view data)
+{
+    return data.size() >= sizeof(CookedScene::Header) &&
+           std::memcmp(data.data(), CookedScene::MAGIC, sizeof(CookedScene::MAGIC)) == 0;
+}
+
+bool SceneLoader::IsValidCooked(std::string_view blob)
+{
+    if (!IsCookedScene(blob))
+        return false;
+
+    CookedScene::Header header = ReadHeader(blob);
+    if (header.version != CookedScene::VERSION)
+    {
+        LOGGER_ERROR("SceneLoader") << "Cooked scene has version " << header.version << ", this build reads " << CookedScene::VERSION;
+        return false;
+    }
+    if (!ValidateCooked(blob, header))
+    {
+        LOGGER_ERROR("SceneLoader") << "Cooked scene is truncated or damaged";
+        return false;
+    }
+    return true;
+}
+
+void SceneLoader::GetCookedResources(std::string_view blob, std::vector<std::pair<SceneCommand, std::string_view>> &resources)
+{
+    using namespace CookedScene;
+    Header header = ReadHeader(blob);
+    const StringRef *stringRefs = SectionData<StringRef>(blob, header.strings);
+    const char *stringData = blob.data() + header.stringData.offset;
+
+    const Command *records = SectionData<Command>(blob, header.resources);
+    resources.reserve(resources.size() + header.resources.count);
+    for (uint32_t i = 0; i < header.resources.count; ++i)
+    {
+        const StringRef &args = stringRefs[records[i].args];
+        resources.emplace_back(static_cast<SceneCommand>(records[i].command), std::string_view(stringData + args.offset, args.length));
+    }
+}
+
+size_t SceneLoader::BuildCookedShapes(std::string_view blob, PhysicsShapeCache &shapes)
+{
+    using namespace CookedScene;
+    Header header = ReadHeader(blob);
+    const Body *records = SectionData<Body>(blob, header.bodies);
+    const BodyChild *children = SectionData<BodyChild>(blob, header.bodyChildren);
+
+    RigidBodyDesc desc;
+    for (uint32_t i = 0; i < header.bodies.count; ++i)
+    {
+        ReadBody(records[i], children, desc);
+        PhysicsLoader::GetShape(desc, shapes);
+    }
+    return header.bodies.count;
+}
+
+bool SceneLoader::LoadCooked(std::string_view blob, SceneLoadContext &context, std::vector<entt::entity> &loadedEntities, bool replayResources)
+{
+    using namespace CookedScene;
+
+    if (!IsValidCooked(blob))
+        return false;
+    Header header = ReadHeader(blob);
+
+    const StringRef *stringRefs = SectionData<StringRef>(blob, header.strings);
+    const char *stringData = blob.data() + header.stringData.offset;
+    auto text = [&](uint32_t id)
+    { return std::string_view(stringData + stringRefs[id].offset, stringRefs[id].length); };
+
+    Scene &scene = context.scene;
+    entt::registry &registry = scene.registry;
+
+    const Command *resources = SectionData<Command>(blob, header.resources);
+    for (uint32_t i = 0; replayResources && i < header.resources.count; ++i)
+    {
+        RunStreamCommand(static_cast<SceneCommand>(resources[i].command), text(resources[i].args), context);
+    }
+
+    std::vector<entt::entity> entities(header.entities.count);
+    registry.create(entities.begin(), entities.end());
+
+    {
+        const Entity *records = SectionData<Entity>(blob, header.entities);
+        std::vector<InfoComponent> infos;
+        infos.reserve(entities.size());
+        for (uint32_t i = 0; i < header.entities.count; ++i)
+            infos.push_back({std::string(text(records[i].name)), std::string(text(records[i].tag))});
+        registry.insert<InfoComponent>(entities.begin(), entities.end(), infos.begin());
+    }
+
+    {
+        // Like Scene::createEntity, every entity gets a transform even without a TRANSFORM line
+        const Transform *records = SectionData<Transform>(blob, header.transforms);
+        std::vector<TransformComponent> transforms(entities.size());
+        for (uint32_t i = 0; i < header.transforms.count; ++i)
+        {
+            TransformComponent &transform = transforms[records[i].entity];
+            transform.position = records[i].position;
+            transform.rotation = records[i].rotation;
+            transform.scale = records[i].scale;
+        }
+        registry.insert<TransformComponent>(entities.begin(), entities.end(), transforms.begin());
+    }
+
+    {
+        // Each distinct name is resolved once; bulk scenes share a handful of models
+        std::unordered_map<uint32_t, Model *> models;
+        std::unordered_map<uint32_t, Shader *> shaders;
+        const Renderer *records = SectionData<Renderer>(blob, header.renderers);
+        std::vector<entt::entity> owners;
+        std::vector<MeshRendererComponent> renderers;
+        owners.reserve(header.renderers.count);
+        renderers.reserve(header.renderers.count);
+        for (uint32_t i = 0; i < header.renderers.count; ++i)
+        {
+            auto model = models.find(records[i].model);
+            if (model == models.end())
+                model = models.emplace(records[i].model, context.res.GetModel(std::string(text(records[i].model)))).first;
+            auto shader = shaders.find(records[i].shader);
+            if (shader == shaders.end())
+                shader = shaders.emplace(records[i].shader, context.res.GetShader(std::string(text(records[i].shader)))).first;
+
+            MeshRendererComponent renderer;
+            renderer.model = model->second;
+            renderer.shader = shader->second;
+            owners.push_back(entities[records[i].entity]);
+            renderers.push_back(renderer);
+        }
+        registry.insert<MeshRendererComponent>(owners.begin(), owners.end(), renderers.begin());
+    }
+
+    {
+        const Material *records = SectionData<Material>(blob, header.materials);
+        std::vector<entt::entity> owners;
+        std::vector<MaterialComponent> materials;
+        owners.reserve(header.materials.count);
+        materials.reserve(header.materials.count);
+        for (uint32_t i = 0; i < header.materials.count; ++i)
+        {
+            const Material &record = records[i];
+            MaterialComponent mat;
+            mat.type = static_cast<MaterialType>(record.type);
+            mat.roughness = record.roughness;
+            mat.opacity = record.opacity;
+            mat.emission = record.emission;
+            mat.shininess = record.shininess;
+            mat.specular = record.specular;
+            mat.ambient = record.ambient;
+            mat.metallic = record.metallic;
+            mat.ao = record.ao;
+            mat.uvScale = record.uvScale;
+            mat.uvOffset = record.uvOffset;
+            owners.push_back(entities[record.entity]);
+            materials.push_back(mat);
+        }
+        registry.insert<MaterialComponent>(owners.begin(), owners.end(), materials.begin());
+    }
+
+    {
+        const Body *records = SectionData<Body>(blob, header.bodies);
+        const BodyChild *children = SectionData<BodyChild>(blob, header.bodyChildren);
+        std::vector<entt::entity> owners;
+        owners.reserve(header.bodies.count);
+        for (uint32_t i = 0; i < header.bodies.count; ++i)
+            owners.push_back(entities[records[i].entity]);
+        registry.insert<RigidBodyComponent>(owners.begin(), owners.end());
+
+        // Bullet objects are still made one at a time, from the shape cache and body pool
+        RigidBodyDesc desc;
+        for (uint32_t i = 0; i < header.bodies.count; ++i)
+        {
+            ReadBody(records[i], children, desc);
+            PhysicsLoader::CreateRigidBody(scene, owners[i], desc, context.phys);
+        }
+    }
+
+    // Scripts, lights, cameras and hierarchy last, so they see every packed component
+    const Command *commands = SectionData<Command>(blob, header.commands);
+    for (uint32_t i = 0; i < header.commands.count; ++i)
+    {
+        context.currentEntity = commands[i].entity == NO_ENTITY ? entt::null : entities[commands[i].entity];
+        RunStreamCommand(static_cast<SceneCommand>(commands[i].command), text(commands[i].args), context);
+    }
+
+    loadedEntities = std::move(entities);
+    return true;
+}
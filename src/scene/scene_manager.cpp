@@ -9,7 +9,13 @@
 #include <map>
 
 SceneManager::SceneManager(Scene &scene, ResourceManager &res, PhysicsWorld &phys, SoundManager &sound, Application *app)
-    : m_Scene(scene), m_Resources(res), m_Physics(phys), m_SoundManager(sound), m_App(app) {}
+    : m_Scene(scene), m_Resources(res), m_Physics(phys), m_SoundManager(sound), m_App(app),
+      m_Stream(std::make_unique<SceneStream>(scene, res, phys, sound, app)) {}
+
+SceneManager::~SceneManager()
+{
+    m_Stream->Cancel();
+}
 
 void SceneManager::LoadScene(const std::string &filePath)
 {
@@ -54,11 +60,19 @@ void SceneManager::ChangeScene(const std::string &filePath)
 void SceneManager::ClearAllScenes()
 {
     LOGGER_INFO("SceneManager") << "Clearing all scenes...";
+    // Its workers may still be filling the physics shape cache
+    bool cancelled = m_Stream->IsActive();
+    if (cancelled)
+        m_Stream->Cancel();
     m_Scene.registry.clear();
 
     m_Physics.Clear();
 
     m_LoadedScenes.clear();
+
+    // Lets the StateMachine take down a loading state it pushed for the cancelled load
+    if (cancelled)
+        ReportProgress();
 }
 
 void SceneManager::QueueLoadScene(const std::string &path)
@@ -73,8 +87,30 @@ void SceneManager::UpdatePendingScene()
     if (m_isPending)
     {
         ClearAllScenes();
-        LoadScene(m_pendingPath);
+        m_Stream->Begin(m_pendingPath);
         m_isPending = false;
         m_pendingPath = "";
     }
-}
\ No newline at end of file
+
+    if (!m_Stream->IsActive())
+        return;
+
+    m_Stream->Update(m_StreamBudget);
+
+    const SceneLoadProgress &progress = m_Stream->GetProgress();
+    if (progress.stage == SceneLoadStage::Done)
+    {
+        m_LoadedScenes[progress.path] = m_Stream->GetEntities();
+        LOGGER_INFO("SceneManager") << "Scene loaded successfully: " << progress.path << " (" << m_Stream->GetEntities().size() << " entities)";
+    }
+    ReportProgress();
+}
+
+void SceneManager::ReportProgress()
+{
+    const SceneLoadProgress &progress = m_Stream->GetProgress();
+    if (m_ProgressCallback)
+        m_ProgressCallback(progress);
+    if (m_App)
+        m_App->GetStateMachine().OnSceneLoadProgress(progress);
+}
@@ -0,0 +1,126 @@
+#include <scene/scene_name_index.h>
+#include <ecs/component.h>
+
+namespace
+{
+    const std::vector<entt::entity> EMPTY_BUCKET;
+}
+
+SceneNameIndex::SceneNameIndex(entt::registry &registry)
+    : m_Registry(registry)
+{
+    m_Registry.on_construct<InfoComponent>().connect<&SceneNameIndex::OnConstruct>(this);
+    m_Registry.on_destroy<InfoComponent>().connect<&SceneNameIndex::OnDestroy>(this);
+    m_Registry.on_update<InfoComponent>().connect<&SceneNameIndex::OnUpdate>(this);
+
+    for (auto entity : m_Registry.view<InfoComponent>())
+        Add(m_Registry, entity);
+}
+
+SceneNameIndex::~SceneNameIndex()
+{
+    m_Registry.on_construct<InfoComponent>().disconnect<&SceneNameIndex::OnConstruct>(this);
+    m_Registry.on_destroy<InfoComponent>().disconnect<&SceneNameIndex::OnDestroy>(this);
+    m_Registry.on_update<InfoComponent>().disconnect<&SceneNameIndex::OnUpdate>(this);
+}
+
+entt::entity SceneNameIndex::FindByName(std::string_view name) const
+{
+    const auto &bucket = m_Names.Find(name);
+    return bucket.empty() ? entt::null : bucket.back();
+}
+
+const std::vector<entt::entity> &SceneNameIndex::FindAllByName(std::string_view name) const
+{
+    return m_Names.Find(name);
+}
+
+const std::vector<entt::entity> &SceneNameIndex::FindAllByTag(std::string_view tag) const
+{
+    return m_Tags.Find(tag);
+}
+
+void SceneNameIndex::OnConstruct(entt::registry &registry, entt::entity entity)
+{
+    Add(registry, entity);
+}
+
+void SceneNameIndex::OnDestroy(entt::registry &, entt::entity entity)
+{
+    Remove(entity);
+}
+
+void SceneNameIndex::OnUpdate(entt::registry &registry, entt::entity entity)
+{
+    Remove(entity);
+    Add(registry, entity);
+}
+
+void SceneNameIndex::Add(entt::registry &registry, entt::entity entity)
+{
+    const auto &info = registry.get<InfoComponent>(entity);
+
+    Entry entry;
+    entry.name = m_Names.Intern(info.name);
+    entry.tag = m_Tags.Intern(info.tag);
+    entry.namePos = Push(m_Names, entry.name, entity);
+    entry.tagPos = Push(m_Tags, entry.tag, entity);
+    m_Entries[entity] = entry;
+}
+
+void SceneNameIndex::Remove(entt::entity entity)
+{
+    auto it = m_Entries.find(entity);
+    if (it == m_Entries.end())
+        return;
+
+    Entry entry = it->second;
+    m_Entries.erase(it);
+    Erase(m_Names, entry.name, entry.namePos, true);
+    Erase(m_Tags, entry.tag, entry.tagPos, false);
+
+    // A cleared scene drops the strings interned by the previous one
+    if (m_Entries.empty())
+    {
+        m_Names = Table();
+        m_Tags = Table();
+    }
+}
+
+uint32_t SceneNameIndex::Push(Table &table, uint32_t id, entt::entity entity)
+{
+    auto &bucket = table.buckets[id];
+    bucket.push_back(entity);
+    return static_cast<uint32_t>(bucket.size() - 1);
+}
+
+void SceneNameIndex::Erase(Table &table, uint32_t id, uint32_t pos, bool isName)
+{
+    // Buckets stay in insertion order so back() is the newest; later entries shift down one slot
+    auto &bucket = table.buckets[id];
+    bucket.erase(bucket.begin() + pos);
+
+    for (size_t i = pos; i < bucket.size(); ++i)
+    {
+        Entry &shifted = m_Entries.at(bucket[i]);
+        (isName ? shifted.namePos : shifted.tagPos) = static_cast<uint32_t>(i);
+    }
+}
+
+uint32_t SceneNameIndex::Table::Intern(std::string_view text)
+{
+    auto it = ids.find(text);
+    if (it != ids.end())
+        return it->second;
+
+    uint32_t id = static_cast<uint32_t>(buckets.size());
+    ids.emplace(std::string(text), id);
+    buckets.emplace_back();
+    return id;
+}
+
+const std::vector<entt::entity> &SceneNameIndex::Table::Find(std::string_view text) const
+{
+    auto it = ids.find(text);
+    return it != ids.end() ? buckets[it->second] : EMPTY_BUCKET;
+}
@@ -0,0 +1,264 @@
+#include <scene/scene_stream.h>
+#include <scene/scene.h>
+#include <resource/resource_manager.h>
+#include <physic/physic_world.h>
+#include <utils/filesystem.h>
+#include <utils/logger.h>
+#include <utils/profiler.h>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <unordered_set>
+
+namespace
+{
+    template <typename T>
+    bool IsReady(const std::future<T> &future)
+    {
+        return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+}
+
+SceneStream::SceneStream(Scene &scene, ResourceManager &res, PhysicsWorld &phys, SoundManager &sound, Application *app)
+    : m_Scene(scene), m_Resources(res), m_Physics(phys), m_Sound(sound), m_App(app)
+{
+    m_MaxWorkers = static_cast<int>((std::max)(2u, std::thread::hardware_concurrency()) - 1);
+}
+
+SceneStream::~SceneStream()
+{
+    Cancel();
+}
+
+void SceneStream::Begin(const std::string &filePath)
+{
+    Cancel();
+
+    m_Active = true;
+    m_FullPath = FileSystem::getPath(filePath);
+    m_Progress = SceneLoadProgress();
+    m_Progress.path = filePath;
+
+    PhysicsShapeCache *shapes = &m_Physics.GetShapeCache();
+    std::string fullPath = m_FullPath;
+    m_Parse = std::async(std::launch::async, [fullPath, shapes]() -> Parsed
+    {
+        AXIS_PROFILE_SCOPE("SceneStream::Parse");
+        Parsed parsed;
+        parsed.ok = SceneLoader::ReadCooked(fullPath, parsed.blob);
+        // Bodies made on the main thread later find their shapes already cached
+        if (parsed.ok)
+            SceneLoader::BuildCookedShapes(parsed.blob, *shapes);
+        return parsed;
+    });
+
+    LOGGER_INFO("SceneStream") << "Streaming scene: " << m_FullPath;
+}
+
+void SceneStream::Cancel()
+{
+    if (m_Parse.valid())
+        m_Parse.wait();
+
+    for (ModelJob &job : m_Jobs)
+    {
+        if (job.started && !job.collected)
+            job.data = job.import.get();
+        Model::ReleaseImages(job.data);
+    }
+
+    m_Parse = {};
+    m_Parsed = Parsed();
+    m_Jobs.clear();
+    m_Steps.clear();
+    m_NextStep = 0;
+    m_Entities.clear();
+    if (m_Active)
+        m_Progress.stage = SceneLoadStage::Cancelled;
+    m_Active = false;
+}
+
+bool SceneStream::Update(float budgetMs)
+{
+    if (!m_Active)
+        return false;
+
+    AXIS_PROFILE_SCOPE("SceneStream::Update");
+    auto start = std::chrono::steady_clock::now();
+
+    if (m_Progress.stage == SceneLoadStage::Parsing)
+    {
+        if (!IsReady(m_Parse))
+            return true;
+        OnParsed();
+        if (!m_Active)
+            return false;
+    }
+
+    PollImports();
+
+    bool first = true;
+    while (m_Active)
+    {
+        double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if (!first && elapsed >= budgetMs)
+            break;
+        if (!RunStep())
+            break;
+        first = false;
+    }
+    return m_Active;
+}
+
+void SceneStream::OnParsed()
+{
+    m_Parsed = m_Parse.get();
+    if (!m_Parsed.ok)
+    {
+        LOGGER_ERROR("SceneStream") << "Could not load scene: " << m_FullPath;
+        m_Progress.stage = SceneLoadStage::Failed;
+        m_Active = false;
+        return;
+    }
+
+    std::vector<std::pair<SceneCommand, std::string_view>> resources;
+    SceneLoader::GetCookedResources(m_Parsed.blob, resources);
+
+    // A model gets an import job the first time its name appears; repeats, and names already
+    // loaded, replay like any other line and just take a reference
+    std::unordered_set<std::string> importing;
+    m_Steps.reserve(resources.size());
+    for (const auto &[command, args] : resources)
+    {
+        ResourceStep step{command, args};
+        if (command == SceneCommand::LOAD_MODEL || command == SceneCommand::LOAD_STATIC_MODEL)
+        {
+            SceneTokens tokens(args);
+            std::string name, path;
+            tokens.Read(name, path);
+            if (!tokens.Failed() && !m_Resources.HasModel(name) && importing.insert(name).second)
+            {
+                ModelJob job;
+                job.name = name;
+                job.path = FileSystem::getPath(path);
+                job.isStatic = command == SceneCommand::LOAD_STATIC_MODEL;
+                step.job = static_cast<int>(m_Jobs.size());
+                m_Jobs.push_back(std::move(job));
+            }
+        }
+        m_Steps.push_back(step);
+    }
+
+    // One unit per resource line, per finished import and for instantiation
+    m_Progress.totalSteps = static_cast<int>(m_Steps.size() + m_Jobs.size()) + 1;
+    m_Progress.stage = SceneLoadStage::Loading;
+}
+
+void SceneStream::PollImports()
+{
+    int running = 0;
+    for (ModelJob &job : m_Jobs)
+    {
+        if (job.started && !job.finished && IsReady(job.import))
+        {
+            job.finished = true;
+            ++m_Progress.completedSteps;
+        }
+        if (job.started && !job.finished)
+            ++running;
+    }
+
+    // Jobs start in file order, so the one the main thread waits on next is never starved
+    for (ModelJob &job : m_Jobs)
+    {
+        if (running >= m_MaxWorkers)
+            break;
+        if (job.started)
+            continue;
+
+        std::string path = job.path;
+        bool isStatic = job.isStatic;
+        job.import = std::async(std::launch::async, [path, isStatic]()
+        {
+            AXIS_PROFILE_SCOPE("SceneStream::ImportModel");
+            ModelImportData data;
+            Model::Import(path, isStatic, data);
+            return data;
+        });
+        job.started = true;
+        ++running;
+    }
+}
+
+bool SceneStream::RunStep()
+{
+    if (m_NextStep == m_Steps.size())
+    {
+        Instantiate();
+        return true;
+    }
+
+    const ResourceStep &step = m_Steps[m_NextStep];
+    if (step.job < 0)
+    {
+        SceneLoadContext context{m_Scene, m_Resources, m_Physics, m_Sound, m_App};
+        SceneLoader::RunStreamCommand(step.command, step.args, context);
+        ++m_NextStep;
+        ++m_Progress.completedSteps;
+        return true;
+    }
+
+    ModelJob &job = m_Jobs[step.job];
+    if (!job.collected)
+    {
+        if (!job.started || !IsReady(job.import))
+            return false;
+        if (!job.finished)
+        {
+            job.finished = true;
+            ++m_Progress.completedSteps;
+        }
+        job.data = job.import.get();
+        job.collected = true;
+    }
+
+    // Texture uploads are the heaviest part of a model, so each one is its own step
+    while (job.nextImage < job.data.images.size())
+    {
+        ModelImage &image = job.data.images[job.nextImage++];
+        if (!image.fallback)
+        {
+            Model::UploadImage(image);
+            return true;
+        }
+    }
+
+    m_Resources.LoadModel(job.name, std::move(job.data), job.isStatic);
+    job.data = ModelImportData();
+    ++m_NextStep;
+    ++m_Progress.completedSteps;
+    return true;
+}
+
+void SceneStream::Instantiate()
+{
+    AXIS_PROFILE_SCOPE("SceneStream::Instantiate");
+    m_Progress.stage = SceneLoadStage::Instantiating;
+
+    SceneLoadContext context{m_Scene, m_Resources, m_Physics, m_Sound, m_App};
+    if (!SceneLoader::LoadCooked(m_Parsed.blob, context, m_Entities, false))
+    {
+        m_Progress.stage = SceneLoadStage::Failed;
+        m_Active = false;
+        return;
+    }
+    SceneLoader::FinishLoad(m_FullPath, context, m_Entities);
+
+    ++m_Progress.completedSteps;
+    m_Progress.stage = SceneLoadStage::Done;
+    m_Parsed = Parsed();
+    m_Jobs.clear();
+    m_Steps.clear();
+    m_Active = false;
+}
@@ -0,0 +1,138 @@
+#include <scene/scene_tokenizer.h>
+
+#include <charconv>
+
+namespace
+{
+    constexpr uint32_t HashToken(std::string_view token)
+    {
+        uint32_t hash = 2166136261u;
+        for (char c : token)
+        {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    constexpr bool IsSpace(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+    }
+}
+
+SceneCommand LookupSceneCommand(std::string_view token)
+{
+    // Two keywords hashing alike would be a duplicate case label, so collisions can't slip in
+    switch (HashToken(token))
+    {
+#define AXIS_SCENE_COMMAND_CASE(name) \
+    case HashToken(#name):            \
+        return token == #name ? SceneCommand::name : SceneCommand::Unknown;
+        AXIS_SCENE_COMMANDS(AXIS_SCENE_COMMAND_CASE)
+#undef AXIS_SCENE_COMMAND_CASE
+    default:
+        return SceneCommand::Unknown;
+    }
+}
+
+const char *GetSceneCommandName(SceneCommand command)
+{
+    switch (command)
+    {
+#define AXIS_SCENE_COMMAND_NAME(name) \
+    case SceneCommand::name:          \
+        return #name;
+        AXIS_SCENE_COMMANDS(AXIS_SCENE_COMMAND_NAME)
+#undef AXIS_SCENE_COMMAND_NAME
+    default:
+        return "UNKNOWN";
+    }
+}
+
+bool SceneLineReader::NextLine(std::string_view &line)
+{
+    if (m_Rest.empty())
+        return false;
+
+    size_t end = m_Rest.find('\n');
+    if (end == std::string_view::npos)
+    {
+        line = m_Rest;
+        m_Rest = {};
+    }
+    else
+    {
+        line = m_Rest.substr(0, end);
+        m_Rest.remove_prefix(end + 1);
+    }
+
+    if (!line.empty() && line.back() == '\r')
+        line.remove_suffix(1);
+    ++m_LineNumber;
+    return true;
+}
+
+std::string_view SceneTokens::Next()
+{
+    if (m_Failed)
+        return {};
+
+    size_t begin = 0;
+    while (begin < m_Rest.size() && IsSpace(m_Rest[begin]))
+        ++begin;
+    size_t end = begin;
+    while (end < m_Rest.size() && !IsSpace(m_Rest[end]))
+        ++end;
+
+    std::string_view token = m_Rest.substr(begin, end - begin);
+    m_Rest.remove_prefix(end);
+    return token;
+}
+
+bool SceneTokens::Next(std::string &value)
+{
+    std::string_view token = Next();
+    if (token.empty())
+    {
+        m_Failed = true;
+        return false;
+    }
+    value.assign(token);
+    return true;
+}
+
+bool SceneTokens::Next(float &value)
+{
+    std::string_view token = Next();
+    // from_chars rejects the leading '+' that stream extraction accepts
+    if (!token.empty() && token.front() == '+')
+        token.remove_prefix(1);
+
+    float parsed = 0.0f;
+    auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), parsed);
+    if (token.empty() || ec != std::errc() || ptr == token.data())
+    {
+        m_Failed = true;
+        return false;
+    }
+    value = parsed;
+    return true;
+}
+
+bool SceneTokens::Next(int &value)
+{
+    std::string_view token = Next();
+    if (!token.empty() && token.front() == '+')
+        token.remove_prefix(1);
+
+    int parsed = 0;
+    auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), parsed);
+    if (token.empty() || ec != std::errc() || ptr == token.data())
+    {
+        m_Failed = true;
+        return false;
+    }
+    value = parsed;
+    return true;
+}
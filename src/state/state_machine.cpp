@@ -54,3 +54,28 @@ void StateMachine::Render()
     if (State *s = GetCurrentState())
         s->OnRender();
 }
+
+void StateMachine::OnSceneLoadProgress(const SceneLoadProgress &progress)
+{
+    if (!m_Loading && !progress.IsFinished())
+    {
+        m_Loading = true;
+        if (m_LoadingFactory)
+        {
+            PushState(m_LoadingFactory());
+            m_LoadingState = GetCurrentState();
+        }
+    }
+
+    if (State *s = GetCurrentState())
+        s->OnLoadProgress(progress);
+
+    if (progress.IsFinished())
+    {
+        // Only pop our own state, in case the loading screen already changed it
+        if (m_LoadingState && GetCurrentState() == m_LoadingState)
+            PopState();
+        m_LoadingState = nullptr;
+        m_Loading = false;
+    }
+}
@@ -0,0 +1,108 @@
+#include <utils/mapped_file.h>
+
+#include <fstream>
+#include <iterator>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+bool MappedFile::Open(const std::string &path)
+{
+    Close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER size;
+    if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+    {
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping)
+        {
+            void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            // The view keeps the mapping and the file alive
+            CloseHandle(mapping);
+            if (view)
+            {
+                CloseHandle(file);
+                m_Mapping = view;
+                m_Data = static_cast<const char *>(view);
+                m_Size = static_cast<size_t>(size.QuadPart);
+                m_Open = true;
+                return true;
+            }
+        }
+    }
+    CloseHandle(file);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat info;
+    if (::fstat(fd, &info) == 0 && info.st_size > 0)
+    {
+        void *view = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (view != MAP_FAILED)
+        {
+            ::madvise(view, static_cast<size_t>(info.st_size), MADV_SEQUENTIAL);
+            ::close(fd); // the mapping keeps the file alive
+            m_Mapping = view;
+            m_Data = static_cast<const char *>(view);
+            m_Size = static_cast<size_t>(info.st_size);
+            m_Open = true;
+            return true;
+        }
+    }
+    ::close(fd);
+#endif
+
+    // Empty files can't be mapped, and some filesystems refuse to; read those instead
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream.is_open())
+        return false;
+
+    m_Buffer.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    m_Data = m_Buffer.data();
+    m_Size = m_Buffer.size();
+    m_Open = true;
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (m_Mapping)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(m_Mapping);
+#else
+        ::munmap(m_Mapping, m_Size);
+#endif
+        m_Mapping = nullptr;
+    }
+
+    m_Buffer.clear();
+    m_Buffer.shrink_to_fit();
+    m_Data = nullptr;
+    m_Size = 0;
+    m_Open = false;
+}
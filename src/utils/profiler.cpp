@@ -0,0 +1,211 @@
+#include <utils/profiler.h>
+
+#if AXIS_PROFILER_ENABLED
+
+#include <utils/logger.h>
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+    constexpr uint64_t RING_CAPACITY = 1u << 16;
+
+    // One ring per thread; only the owning thread writes, the exporter reads behind writeIndex.
+    struct ThreadBuffer
+    {
+        std::unique_ptr<Profiler::Zone[]> zones = std::make_unique<Profiler::Zone[]>(RING_CAPACITY);
+        std::atomic<uint64_t> writeIndex{0};
+        uint32_t threadId = 0;
+        uint32_t depth = 0;
+        std::string name;
+    };
+
+    std::mutex s_RegistryMutex;
+    // Buffers are never freed: worker threads (std::execution pools, Bullet) may outlive any owner
+    std::vector<std::unique_ptr<ThreadBuffer>> s_Buffers;
+    thread_local ThreadBuffer *t_Buffer = nullptr;
+
+    struct CaptureState
+    {
+        bool pending = false;
+        int framesRequested = 0;
+        int framesLeft = 0;
+        uint64_t startNs = 0;
+        std::string path;
+        std::vector<uint64_t> frameMarks;
+    };
+
+    CaptureState s_Capture;
+
+    ThreadBuffer &GetThreadBuffer()
+    {
+        if (!t_Buffer)
+        {
+            std::lock_guard<std::mutex> lock(s_RegistryMutex);
+            auto buffer = std::make_unique<ThreadBuffer>();
+            buffer->threadId = static_cast<uint32_t>(s_Buffers.size() + 1);
+            buffer->name = buffer->threadId == 1 ? "Main" : "Worker " + std::to_string(buffer->threadId - 1);
+            t_Buffer = buffer.get();
+            s_Buffers.push_back(std::move(buffer));
+        }
+        return *t_Buffer;
+    }
+
+    void WriteEscaped(std::ostream &os, const char *text)
+    {
+        for (const char *c = text; *c; ++c)
+        {
+            if (*c == '"' || *c == '\\')
+                os << '\\';
+            os << *c;
+        }
+    }
+}
+
+Profiler::ScopedZone::ScopedZone(const char *name)
+    : m_Name(name)
+{
+    ++GetThreadBuffer().depth;
+    m_Start = NowNs();
+}
+
+Profiler::ScopedZone::~ScopedZone()
+{
+    uint64_t end = NowNs();
+    ThreadBuffer &buffer = *t_Buffer;
+    --buffer.depth;
+
+    uint64_t index = buffer.writeIndex.load(std::memory_order_relaxed);
+    buffer.zones[index & (RING_CAPACITY - 1)] = {m_Name, m_Start, end, buffer.depth};
+    buffer.writeIndex.store(index + 1, std::memory_order_release);
+}
+
+uint64_t Profiler::NowNs()
+{
+    using namespace std::chrono;
+    return static_cast<uint64_t>(duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
+void Profiler::SetThreadName(const char *name)
+{
+    ThreadBuffer &buffer = GetThreadBuffer();
+    std::lock_guard<std::mutex> lock(s_RegistryMutex);
+    buffer.name = name;
+}
+
+void Profiler::MarkFrame()
+{
+    uint64_t now = NowNs();
+
+    if (s_Capture.pending)
+    {
+        s_Capture.pending = false;
+        s_Capture.framesLeft = s_Capture.framesRequested;
+        s_Capture.startNs = now;
+        s_Capture.frameMarks.assign(1, now);
+        return;
+    }
+
+    if (s_Capture.framesLeft <= 0)
+        return;
+
+    s_Capture.frameMarks.push_back(now);
+    if (--s_Capture.framesLeft == 0)
+        WriteChromeTrace(s_Capture.path, s_Capture.startNs, now);
+}
+
+void Profiler::RequestCapture(int frames, const std::string &path)
+{
+    if (frames <= 0)
+        return;
+
+    s_Capture.pending = true;
+    s_Capture.framesRequested = frames;
+    s_Capture.path = path;
+    LOGGER_INFO("Profiler") << "Capturing " << frames << " frames to " << path;
+}
+
+bool Profiler::IsCapturing()
+{
+    return s_Capture.pending || s_Capture.framesLeft > 0;
+}
+
+bool Profiler::WriteChromeTrace(const std::string &path, uint64_t startNs, uint64_t endNs)
+{
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open())
+    {
+        LOGGER_ERROR("Profiler") << "Could not open trace file: " << path;
+        return false;
+    }
+
+    file << std::fixed << std::setprecision(3);
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+    bool first = true;
+    auto separator = [&]()
+    {
+        if (!first)
+            file << ",\n";
+        first = false;
+    };
+    auto micros = [&](uint64_t ns)
+    { return static_cast<double>(ns - startNs) / 1000.0; };
+
+    size_t zoneCount = 0;
+    std::lock_guard<std::mutex> lock(s_RegistryMutex);
+
+    for (const auto &buffer : s_Buffers)
+    {
+        separator();
+        file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadId
+             << ",\"args\":{\"name\":\"";
+        WriteEscaped(file, buffer->name.c_str());
+        file << "\"}}";
+
+        uint64_t end = buffer->writeIndex.load(std::memory_order_acquire);
+        uint64_t begin = end > RING_CAPACITY ? end - RING_CAPACITY : 0;
+
+        for (uint64_t i = begin; i < end; ++i)
+        {
+            const Zone &zone = buffer->zones[i & (RING_CAPACITY - 1)];
+            if (zone.startNs < startNs || zone.endNs > endNs)
+                continue;
+
+            separator();
+            file << "{\"name\":\"";
+            WriteEscaped(file, zone.name);
+            file << "\",\"cat\":\"axis\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadId
+                 << ",\"ts\":" << micros(zone.startNs) << ",\"dur\":" << (zone.endNs - zone.startNs) / 1000.0
+                 << ",\"args\":{\"depth\":" << zone.depth << "}}";
+            ++zoneCount;
+        }
+    }
+
+    for (size_t i = 1; i < s_Capture.frameMarks.size(); ++i)
+    {
+        uint64_t frameStart = s_Capture.frameMarks[i - 1];
+        uint64_t frameEnd = s_Capture.frameMarks[i];
+        if (frameStart < startNs || frameEnd > endNs)
+            continue;
+
+        separator();
+        file << "{\"name\":\"Frame " << i << "\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":0"
+             << ",\"ts\":" << micros(frameStart) << ",\"dur\":" << (frameEnd - frameStart) / 1000.0 << "}";
+    }
+
+    separator();
+    file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Frames\"}}";
+    file << "\n]}\n";
+
+    LOGGER_INFO("Profiler") << "Wrote " << zoneCount << " zones to " << path;
+    return true;
+}
+
+#endif
@@ -0,0 +1,112 @@
+#include <utils/thread_pool.h>
+#include <utils/profiler.h>
+
+#include <algorithm>
+
+namespace
+{
+    constexpr int SPIN_ATTEMPTS = 256;
+
+    // Set on workers, and on a caller while it helps with its own loop
+    thread_local bool t_InsideLoop = false;
+}
+
+ThreadPool::ThreadPool(int workerCount)
+{
+    if (workerCount <= 0)
+        workerCount = (std::max)(1, static_cast<int>(std::thread::hardware_concurrency())) - 1;
+
+    m_Workers.reserve(workerCount);
+    for (int i = 0; i < workerCount; ++i)
+        m_Workers.emplace_back(&ThreadPool::WorkerLoop, this);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stopping = true;
+    }
+    m_Wake.notify_all();
+    for (std::thread &worker : m_Workers)
+        worker.join();
+}
+
+void ThreadPool::ParallelFor(int begin, int end, int grainSize, const std::function<void(int, int)> &body)
+{
+    if (begin >= end)
+        return;
+
+    grainSize = (std::max)(grainSize, 1);
+    if (m_Workers.empty() || t_InsideLoop || end - begin <= grainSize)
+    {
+        body(begin, end);
+        return;
+    }
+
+    std::lock_guard<std::mutex> submit(m_SubmitMutex);
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Body = &body;
+        m_End = end;
+        m_Grain = grainSize;
+        m_Next.store(begin, std::memory_order_relaxed);
+        m_Busy.store(GetWorkerCount(), std::memory_order_relaxed);
+        m_Generation.fetch_add(1, std::memory_order_release);
+    }
+    m_Wake.notify_all();
+
+    t_InsideLoop = true;
+    RunChunks();
+    t_InsideLoop = false;
+
+    // Workers may still be finishing their last chunk, and must be done with m_Body before we return
+    while (m_Busy.load(std::memory_order_acquire) > 0)
+        std::this_thread::yield();
+
+    m_Body = nullptr;
+}
+
+void ThreadPool::RunChunks()
+{
+    const std::function<void(int, int)> &body = *m_Body;
+    for (;;)
+    {
+        int chunkBegin = m_Next.fetch_add(m_Grain, std::memory_order_relaxed);
+        if (chunkBegin >= m_End)
+            break;
+        body(chunkBegin, (std::min)(chunkBegin + m_Grain, m_End));
+    }
+}
+
+void ThreadPool::WorkerLoop()
+{
+    AXIS_PROFILE_THREAD("Worker");
+    t_InsideLoop = true;
+
+    uint64_t seen = 0;
+    for (;;)
+    {
+        // Loops usually come in bursts (one physics step issues several), so spin before sleeping
+        bool ready = false;
+        for (int attempt = 0; attempt < SPIN_ATTEMPTS && !ready; ++attempt)
+        {
+            ready = m_Generation.load(std::memory_order_acquire) != seen;
+            if (!ready)
+                std::this_thread::yield();
+        }
+
+        if (!ready)
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_Wake.wait(lock, [&]()
+                        { return m_Stopping || m_Generation.load(std::memory_order_acquire) != seen; });
+            if (m_Stopping)
+                return;
+        }
+
+        seen = m_Generation.load(std::memory_order_acquire);
+        RunChunks();
+        m_Busy.fetch_sub(1, std::memory_order_release);
+    }
+}
@@ -0,0 +1,933 @@
+// axis_bench: deterministic frame-time benchmark.
+//
+// Loads a scene on the headless render device, steps N frames with a fixed dt straight through
+// SystemManager (Fixed/Update/Shadows/Render) and prints per-system percentiles, allocations per
+// frame and entity counts as JSON.
+//
+//   axis_bench --scene "scenes/game(rigid).scene" --frames 600
+//   axis_bench --sweep 1000,10000,100000 --seed 42 --out bench.json
+//   axis_bench --skeleton 100
+//   axis_bench --parse 20 --scene "scenes/game(rigid).scene"
+//   axis_bench --check
+
+#include <app/application.h>
+#include <app/system_manager.h>
+#include <ecs/systems/transform_system.h>
+#include <graphic/core/render_device.h>
+#include <graphic/geometry/animation.h>
+#include <graphic/geometry/animator.h>
+#include <scene/scene.h>
+#include <scene/scene_tokenizer.h>
+#include <utils/filesystem.h>
+#include <utils/logger.h>
+#include <utils/mapped_file.h>
+#include <utils/profiler.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+// Allocation counting (global operator new replacement, bench binary only)
+// ---------------------------------------------------------------------------
+static std::atomic<uint64_t> g_AllocCount{0};
+static std::atomic<uint64_t> g_AllocBytes{0};
+
+void *operator new(std::size_t size)
+{
+    g_AllocCount.fetch_add(1, std::memory_order_relaxed);
+    g_AllocBytes.fetch_add(size, std::memory_order_relaxed);
+    if (void *ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void *operator new(std::size_t size, std::align_val_t align)
+{
+    g_AllocCount.fetch_add(1, std::memory_order_relaxed);
+    g_AllocBytes.fetch_add(size, std::memory_order_relaxed);
+    const std::size_t alignment = static_cast<std::size_t>(align);
+#ifdef _WIN32
+    if (void *ptr = _aligned_malloc(size ? size : 1, alignment))
+        return ptr;
+#else
+    const std::size_t rounded = ((size ? size : 1) + alignment - 1) / alignment * alignment;
+    if (void *ptr = std::aligned_alloc(alignment, rounded))
+        return ptr;
+#endif
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, std::align_val_t) noexcept
+{
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+void operator delete(void *ptr, std::size_t, std::align_val_t align) noexcept { operator delete(ptr, align); }
+
+// ---------------------------------------------------------------------------
+
+struct BenchOptions
+{
+    std::string scene = "scenes/game(rigid).scene";
+    std::vector<int> sweep;
+    int skeletonBones = 0;
+    int parseRepeats = 0;
+    bool checks = false;
+    uint32_t seed = 1337;
+    int frames = 600;
+    int warmup = 60;
+    float fixedDt = 1.0f / 60.0f;
+    bool physics = true;
+    bool parallelPhysics = false;
+    bool pipelinedPhysics = false;
+    std::string label;
+    std::string out;
+    std::string trace;
+};
+
+struct Percentiles
+{
+    double p50 = 0.0, p95 = 0.0, p99 = 0.0, mean = 0.0, max = 0.0;
+};
+
+static Percentiles ComputePercentiles(std::vector<double> samples)
+{
+    Percentiles result;
+    if (samples.empty())
+        return result;
+
+    std::sort(samples.begin(), samples.end());
+    auto rank = [&](double p)
+    {
+        size_t index = static_cast<size_t>(p * (samples.size() - 1) + 0.5);
+        return samples[(std::min)(index, samples.size() - 1)];
+    };
+
+    double sum = 0.0;
+    for (double v : samples)
+        sum += v;
+
+    result.p50 = rank(0.50);
+    result.p95 = rank(0.95);
+    result.p99 = rank(0.99);
+    result.mean = sum / samples.size();
+    result.max = samples.back();
+    return result;
+}
+
+static void WritePercentiles(std::ostream &os, const Percentiles &p)
+{
+    os << "{\"p50\": " << p.p50 << ", \"p95\": " << p.p95 << ", \"p99\": " << p.p99
+       << ", \"mean\": " << p.mean << ", \"max\": " << p.max << "}";
+}
+
+static std::string JsonEscape(const std::string &text)
+{
+    std::string escaped;
+    for (char c : text)
+    {
+        if (c == '"' || c == '\\')
+            escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+// Mirrors scene_gen/add_dummies.py / add_rigidbodies.py, but seeded. Uses raw mt19937 output
+// instead of std::uniform_real_distribution so the same seed yields the same scene on every STL.
+static std::string GenerateScene(int entityCount, uint32_t seed, bool physics)
+{
+    std::string relPath = "bin/bench/generated_" + std::to_string(entityCount) + "_" + std::to_string(seed) + (physics ? "" : "_nophys") + ".scene";
+    std::string fullPath = FileSystem::getPath(relPath);
+    std::filesystem::create_directories(std::filesystem::path(fullPath).parent_path());
+
+    std::mt19937 rng(seed);
+    auto uniform = [&](float a, float b)
+    { return a + (b - a) * static_cast<float>(rng() / 4294967296.0); };
+
+    std::ofstream file(fullPath, std::ios::trunc);
+    file << std::fixed << std::setprecision(2);
+    file << "CONFIG SHADOWS 1\nCONFIG INSTANCING 1\nCONFIG FRUSTUM 1\nCONFIG SHADOW_FRUSTUM 1\n";
+    file << "CONFIG SHADOW_DISTANCE 100.0\nCONFIG PHYSICS_MODE FAST\n\n";
+    file << "NEW_ENTITY MainCamera\nTRANSFORM 0.0 4.0 10.0 0.0 0.0 0.0 1.0 1.0 1.0\nCAMERA 1 90.0 -90.0 0.0 0.1 1000.0\n\n";
+    file << "NEW_ENTITY Sun\nTRANSFORM 0.0 0.0 0.0 14.0 0.0 0.0 1.0 1.0 1.0\nLIGHT_DIR 1 1 0.8 0.1 0.3 1\n\n";
+    file << "NEW_ENTITY Plane\nTRANSFORM 0.0 0.0 0.0 0.0 0.0 0.0 1 1 1\nRENDERER planeModel phongLitShadowShader\n";
+    file << "MATERIAL PHONG 32 0.5 0.5 0.5\n";
+    if (physics)
+        file << "RIGIDBODY BOX 0.0 50.0 0.1 50.0 STATIC RESTITUTION 1.0\n";
+    file << "\n";
+
+    for (int i = 1; i <= entityCount; ++i)
+    {
+        float x = uniform(-100.0f, 100.0f);
+        float y = uniform(10.0f, 150.0f);
+        float z = uniform(-100.0f, 100.0f);
+        float rx = uniform(0.0f, 360.0f);
+        float ry = uniform(0.0f, 360.0f);
+        float rz = uniform(0.0f, 360.0f);
+
+        file << "NEW_ENTITY Dummy" << i << "\n";
+        file << "TRANSFORM " << x << " " << y << " " << z << " " << rx << " " << ry << " " << rz << " 0.01 0.01 0.01\n";
+        file << "RENDERER dummyModel phongLitShadowShader\n";
+        file << "MATERIAL PHONG 32 0.5 0.5 0.5\n";
+        if (physics)
+            file << "RIGIDBODY CAPSULE 1.0 1.0 1.8 OFFSET 0.0 2.0 0.0 DYNAMIC RESTITUTION 0.8\n";
+        file << "\n";
+    }
+
+    return relPath;
+}
+
+static void RunBenchmark(Application &app, const std::string &scenePath, int generatedCount, const BenchOptions &options, std::ostream &json)
+{
+    Scene &scene = app.GetScene();
+    SystemManager &systems = app.GetSystemManager();
+
+    auto loadStart = std::chrono::high_resolution_clock::now();
+    app.GetSceneManager().LoadScene(scenePath);
+    double loadMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - loadStart).count();
+
+    if (options.parallelPhysics)
+        app.GetPhysicsWorld().SetParallel(&app.GetThreadPool());
+    systems.GetPhysicsSystem().SetPipelined(options.pipelinedPhysics);
+
+    std::map<std::string, std::vector<double>> systemSamples;
+    std::vector<double> frameSamples;
+    std::vector<double> allocSamples;
+    std::vector<double> allocByteSamples;
+    RenderDeviceStats renderTotals;
+    double animatorsUpdated = 0.0, animatorsSkipped = 0.0;
+    double bodiesFromPhysics = 0.0, bodiesToPhysics = 0.0;
+
+    frameSamples.reserve(options.frames);
+    allocSamples.reserve(options.frames);
+    allocByteSamples.reserve(options.frames);
+
+    systems.SetTimingEnabled(true);
+
+    const float dt = options.fixedDt;
+    for (int frame = 0; frame < options.warmup + options.frames; ++frame)
+    {
+        const bool measured = frame >= options.warmup;
+        if (frame == options.warmup && !options.trace.empty())
+            AXIS_PROFILE_CAPTURE(options.frames, options.trace);
+
+        AXIS_PROFILE_FRAME();
+        systems.ClearTimings();
+
+        uint64_t allocsBefore = g_AllocCount.load(std::memory_order_relaxed);
+        uint64_t bytesBefore = g_AllocBytes.load(std::memory_order_relaxed);
+        auto frameStart = std::chrono::high_resolution_clock::now();
+
+        systems.FixedUpdateSystems(scene, app.GetPhysicsWorld(), dt);
+        systems.InterpolatePhysics(0.0f);
+        systems.UpdateSystems(scene, dt, dt, &app, app.GetResourceManager(), app.GetSoundManager(), app.GetMouse());
+        systems.RenderShadows(scene);
+        systems.RenderSystems(scene, app.GetResourceManager(), app.GetWidth(), app.GetHeight());
+
+        auto frameEnd = std::chrono::high_resolution_clock::now();
+        uint64_t allocs = g_AllocCount.load(std::memory_order_relaxed) - allocsBefore;
+        uint64_t bytes = g_AllocBytes.load(std::memory_order_relaxed) - bytesBefore;
+
+        RenderDevice::EndFrame();
+
+        if (!measured)
+            continue;
+
+        frameSamples.push_back(std::chrono::duration<double, std::milli>(frameEnd - frameStart).count());
+        allocSamples.push_back(static_cast<double>(allocs));
+        allocByteSamples.push_back(static_cast<double>(bytes));
+        renderTotals.Accumulate(RenderDevice::GetFrameStats());
+        animatorsUpdated += app.GetAnimationSystem().GetStats().updated;
+        animatorsSkipped += app.GetAnimationSystem().GetStats().skipped;
+        bodiesFromPhysics += app.GetPhysicsSystem().GetSyncStats().fromPhysics;
+        bodiesToPhysics += app.GetPhysicsSystem().GetSyncStats().toPhysics;
+
+        std::map<std::string, double> frameSystems;
+        for (const SystemTiming &timing : systems.GetTimings())
+            frameSystems[timing.name] += timing.milliseconds;
+        for (const auto &[name, ms] : frameSystems)
+            systemSamples[name].push_back(ms);
+    }
+
+    AXIS_PROFILE_FRAME();
+    systems.SetTimingEnabled(false);
+
+    auto &registry = scene.registry;
+    size_t entityCount = registry.storage<entt::entity>().free_list();
+    size_t rendererCount = registry.view<MeshRendererComponent>().size();
+    size_t rigidBodyCount = registry.view<RigidBodyComponent>().size();
+    size_t animatorCount = registry.view<AnimationComponent>().size();
+    size_t scriptCount = registry.view<ScriptComponent>().size();
+    const double frames = (std::max)(options.frames, 1);
+
+    json << "    {\n";
+    json << "      \"scene\": \"" << JsonEscape(scenePath) << "\",\n";
+    if (!options.label.empty())
+        json << "      \"label\": \"" << JsonEscape(options.label) << "\",\n";
+    json << "      \"generatedEntities\": " << generatedCount << ",\n";
+    json << "      \"seed\": " << options.seed << ",\n";
+    json << "      \"frames\": " << options.frames << ",\n";
+    json << "      \"warmup\": " << options.warmup << ",\n";
+    json << "      \"fixedDt\": " << options.fixedDt << ",\n";
+    json << "      \"loadMs\": " << loadMs << ",\n";
+    json << "      \"physicsThreads\": " << (app.GetPhysicsWorld().IsParallel() ? app.GetThreadPool().GetThreadCount() : 1) << ",\n";
+    json << "      \"physicsShapes\": {\"unique\": " << app.GetPhysicsWorld().GetShapeCache().GetUniqueCount()
+         << ", \"requests\": " << app.GetPhysicsWorld().GetShapeCache().GetRequestCount() << "},\n";
+    json << "      \"physicsPipelined\": " << (options.pipelinedPhysics ? "true" : "false") << ",\n";
+    json << "      \"entities\": {\"total\": " << entityCount << ", \"renderers\": " << rendererCount
+         << ", \"rigidBodies\": " << rigidBodyCount << ", \"animators\": " << animatorCount
+         << ", \"scripts\": " << scriptCount << ", \"rendered\": " << app.GetRenderSystem().GetRenderedCount() << "},\n";
+    json << "      \"frameMs\": ";
+    WritePercentiles(json, ComputePercentiles(frameSamples));
+    json << ",\n      \"systemsMs\": {\n";
+    size_t index = 0;
+    for (const auto &[name, samples] : systemSamples)
+    {
+        json << "        \"" << name << "\": ";
+        WritePercentiles(json, ComputePercentiles(samples));
+        json << (++index < systemSamples.size() ? ",\n" : "\n");
+    }
+    json << "      },\n";
+    json << "      \"allocationsPerFrame\": ";
+    WritePercentiles(json, ComputePercentiles(allocSamples));
+    json << ",\n      \"allocatedBytesPerFrame\": ";
+    WritePercentiles(json, ComputePercentiles(allocByteSamples));
+    json << ",\n      \"renderPerFrame\": {\"drawCalls\": " << renderTotals.drawCalls / frames
+         << ", \"instances\": " << renderTotals.instancesDrawn / frames
+         << ", \"indirectCommands\": " << renderTotals.indirectCommands / frames
+         << ", \"stateChanges\": " << renderTotals.stateChanges / frames
+         << ", \"uniformUploads\": " << renderTotals.uniformUploads / frames
+         << ", \"bufferUploads\": " << renderTotals.bufferUploads / frames
+         << ", \"bytesUploaded\": " << renderTotals.bytesUploaded / frames << "},\n";
+    json << "      \"animationPerFrame\": {\"updated\": " << animatorsUpdated / frames
+         << ", \"skipped\": " << animatorsSkipped / frames << "},\n";
+    json << "      \"physicsSyncPerFrame\": {\"fromPhysics\": " << bodiesFromPhysics / frames
+         << ", \"toPhysics\": " << bodiesToPhysics / frames << "}\n";
+    json << "    }";
+
+    app.GetSceneManager().UnloadScene(scenePath);
+}
+
+// ---------------------------------------------------------------------------
+// Skeleton benchmark: the recursive, name-keyed pose pass Animator used before skeletons were
+// flattened, against Animator::UpdateAnimation on the same synthetic rig.
+// ---------------------------------------------------------------------------
+
+// Random tree of boneCount animated nodes under a static root, one clip with 30 keys per track
+static std::unique_ptr<aiScene> BuildSyntheticRig(int boneCount, std::mt19937 &rng)
+{
+    auto uniform = [&](float a, float b)
+    { return a + (b - a) * static_cast<float>(rng() / 4294967296.0); };
+
+    auto scene = std::make_unique<aiScene>();
+    std::vector<aiNode *> nodes;
+    std::vector<std::vector<aiNode *>> children(boneCount + 1);
+
+    nodes.push_back(new aiNode("Root"));
+    for (int i = 1; i <= boneCount; ++i)
+    {
+        aiNode *node = new aiNode("Bone" + std::to_string(i));
+        node->mTransformation = aiMatrix4x4::Translation(aiVector3D(0.0f, uniform(0.1f, 0.5f), 0.0f), node->mTransformation);
+        nodes.push_back(node);
+
+        // Spine-like chains with occasional branches, like a humanoid with fingers
+        int parent = (std::max)(0, i - 1 - static_cast<int>(rng() % 4));
+        children[parent].push_back(node);
+    }
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        if (!children[i].empty())
+            nodes[i]->addChildren(static_cast<unsigned int>(children[i].size()), children[i].data());
+    }
+    scene->mRootNode = nodes[0];
+
+    const unsigned int keyCount = 30;
+    aiAnimation *animation = new aiAnimation();
+    animation->mDuration = keyCount - 1;
+    animation->mTicksPerSecond = 30.0;
+    animation->mNumChannels = boneCount;
+    animation->mChannels = new aiNodeAnim *[boneCount];
+    for (int i = 0; i < boneCount; ++i)
+    {
+        aiNodeAnim *channel = new aiNodeAnim();
+        channel->mNodeName = nodes[i + 1]->mName;
+        channel->mNumPositionKeys = keyCount;
+        channel->mPositionKeys = new aiVectorKey[keyCount];
+        channel->mNumRotationKeys = keyCount;
+        channel->mRotationKeys = new aiQuatKey[keyCount];
+        channel->mNumScalingKeys = 2;
+        channel->mScalingKeys = new aiVectorKey[2];
+
+        for (unsigned int k = 0; k < keyCount; ++k)
+        {
+            channel->mPositionKeys[k] = aiVectorKey(k, aiVector3D(uniform(-0.1f, 0.1f), uniform(0.1f, 0.5f), uniform(-0.1f, 0.1f)));
+            aiVector3D axis(uniform(-1.0f, 1.0f), uniform(-1.0f, 1.0f), uniform(-1.0f, 1.0f));
+            channel->mRotationKeys[k] = aiQuatKey(k, aiQuaternion(axis.NormalizeSafe(), uniform(-1.0f, 1.0f)));
+        }
+        channel->mScalingKeys[0] = aiVectorKey(0.0, aiVector3D(1.0f));
+        channel->mScalingKeys[1] = aiVectorKey(keyCount - 1, aiVector3D(1.0f));
+        animation->mChannels[i] = channel;
+    }
+    scene->mNumAnimations = 1;
+    scene->mAnimations = new aiAnimation *[1]{animation};
+
+    return scene;
+}
+
+// Verbatim port of the old Animator::CalculateBoneTransform
+struct LegacyPose
+{
+    const Animation *current = nullptr;
+    const Animation *next = nullptr;
+    float currentTime = 0.0f;
+    float nextTime = 0.0f;
+    float blendFactor = 0.0f;
+    std::vector<BoneCursor> cursors;
+    std::vector<BoneCursor> nextCursors;
+    std::vector<glm::mat4> palette = std::vector<glm::mat4>(100, glm::mat4(1.0f));
+
+    void Update(float dt)
+    {
+        currentTime = std::fmod(currentTime + current->GetTicksPerSecond() * dt, current->GetDuration());
+        if (next)
+            nextTime = std::fmod(nextTime + next->GetTicksPerSecond() * dt, next->GetDuration());
+        Evaluate(&current->GetRootNode(), glm::mat4(1.0f));
+    }
+
+    void Evaluate(const AssimpNodeData *node, const glm::mat4 &parentTransform)
+    {
+        const std::string &nodeName = node->name;
+        glm::mat4 nodeTransform = node->transformation;
+
+        if (node->channel >= 0)
+        {
+            const Bone &boneA = current->GetBone(node->channel);
+            BoneCursor &cursorA = cursors[node->channel];
+
+            int channelB = (next && (blendFactor > 0.001f)) ? next->FindChannel(nodeName) : -1;
+            if (channelB >= 0)
+            {
+                glm::vec3 posA, posB, scaleA, scaleB;
+                glm::quat rotA, rotB;
+                boneA.Sample(currentTime, cursorA, posA, rotA, scaleA);
+                next->GetBone(channelB).Sample(nextTime, nextCursors[channelB], posB, rotB, scaleB);
+
+                nodeTransform = glm::translate(glm::mat4(1.0f), glm::mix(posA, posB, blendFactor)) *
+                                glm::toMat4(glm::slerp(rotA, rotB, blendFactor)) *
+                                glm::scale(glm::mat4(1.0f), glm::mix(scaleA, scaleB, blendFactor));
+            }
+            else
+            {
+                nodeTransform = boneA.SampleLocalTransform(currentTime, cursorA);
+            }
+        }
+
+        glm::mat4 globalTransformation = parentTransform * nodeTransform;
+
+        const auto &boneInfoMap = current->GetBoneIDMap();
+        auto it = boneInfoMap.find(nodeName);
+        if (it != boneInfoMap.end() && it->second.id < static_cast<int>(palette.size()))
+            palette[it->second.id] = globalTransformation * it->second.offset;
+
+        for (int i = 0; i < node->childrenCount; i++)
+            Evaluate(&node->children[i], globalTransformation);
+    }
+};
+
+static float MaxPaletteError(const std::vector<glm::mat4> &a, const std::vector<glm::mat4> &b)
+{
+    float error = 0.0f;
+    for (size_t i = 0; i < (std::min)(a.size(), b.size()); ++i)
+    {
+        for (int c = 0; c < 4; ++c)
+        {
+            for (int r = 0; r < 4; ++r)
+                error = (std::max)(error, std::abs(a[i][c][r] - b[i][c][r]));
+        }
+    }
+    return error;
+}
+
+static void RunSkeletonBenchmark(const BenchOptions &options, std::ostream &json)
+{
+    std::mt19937 rng(options.seed);
+    std::unordered_map<std::string, BoneInfo> boneInfoMap;
+    int boneCount = 0;
+
+    std::unique_ptr<aiScene> sceneA = BuildSyntheticRig(options.skeletonBones, rng);
+    std::mt19937 rngB(options.seed);
+    std::unique_ptr<aiScene> sceneB = BuildSyntheticRig(options.skeletonBones, rngB);
+    // Same hierarchy, motion played backwards
+    for (unsigned int i = 0; i < sceneB->mAnimations[0]->mNumChannels; ++i)
+    {
+        aiNodeAnim *channel = sceneB->mAnimations[0]->mChannels[i];
+        for (unsigned int k = 0; k < channel->mNumPositionKeys / 2; ++k)
+            std::swap(channel->mPositionKeys[k].mValue, channel->mPositionKeys[channel->mNumPositionKeys - 1 - k].mValue);
+    }
+
+    // Identity inverse bind matrices, so the palettes compared below are the global transforms
+    for (int i = 1; i <= options.skeletonBones; ++i)
+        boneInfoMap["Bone" + std::to_string(i)] = {boneCount++, glm::mat4(1.0f)};
+
+    Animation clipA(sceneA.get(), boneInfoMap, boneCount);
+    Animation clipB(sceneB.get(), boneInfoMap, boneCount);
+
+    const int poses = (std::max)(options.frames, 1) * 50;
+    const float dt = options.fixedDt;
+
+    auto timeLegacy = [&](LegacyPose &legacy)
+    {
+        legacy.cursors.resize(legacy.current->GetBoneCount());
+        if (legacy.next)
+            legacy.nextCursors.resize(legacy.next->GetBoneCount());
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < poses; ++i)
+            legacy.Update(dt);
+        return std::chrono::duration<double, std::nano>(std::chrono::high_resolution_clock::now() - start).count() / poses;
+    };
+    auto timeFlat = [&](Animator &animator)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < poses; ++i)
+            animator.UpdateAnimation(dt);
+        return std::chrono::duration<double, std::nano>(std::chrono::high_resolution_clock::now() - start).count() / poses;
+    };
+
+    LegacyPose legacy;
+    legacy.current = &clipA;
+    Animator flat(&clipA);
+    double legacyNs = timeLegacy(legacy);
+    double flatNs = timeFlat(flat);
+    float error = MaxPaletteError(legacy.palette, flat.GetFinalBoneMatrices());
+
+    LegacyPose legacyBlend;
+    legacyBlend.current = &clipA;
+    legacyBlend.next = &clipB;
+    legacyBlend.blendFactor = 0.5f;
+    Animator flatBlend(&clipA);
+    flatBlend.AddAnimation("B", &clipB);
+    flatBlend.PlayBlend("Default", "B", 0.5f);
+    double legacyBlendNs = timeLegacy(legacyBlend);
+    double flatBlendNs = timeFlat(flatBlend);
+    error = (std::max)(error, MaxPaletteError(legacyBlend.palette, flatBlend.GetFinalBoneMatrices()));
+
+    // Same clip with quantized keys, compared against the float clip's pose
+    Animation clipCompressed(sceneA.get(), boneInfoMap, boneCount);
+    clipCompressed.Compress(ClipCompressionSettings());
+    Animator flatReference(&clipA);
+    Animator flatCompressed(&clipCompressed);
+    double referenceNs = timeFlat(flatReference);
+    double compressedNs = timeFlat(flatCompressed);
+    float compressedError = MaxPaletteError(flatReference.GetFinalBoneMatrices(), flatCompressed.GetFinalBoneMatrices());
+    const ClipCompressionReport &report = clipCompressed.GetCompressionReport();
+
+    json << "  \"skeleton\": {\"bones\": " << options.skeletonBones
+         << ", \"nodes\": " << clipA.GetSkeleton().size()
+         << ", \"poses\": " << poses
+         << ", \"seed\": " << options.seed << ",\n";
+    if (!options.label.empty())
+        json << "    \"label\": \"" << JsonEscape(options.label) << "\",\n";
+    json << "    \"legacyNsPerPose\": " << legacyNs << ", \"flatNsPerPose\": " << flatNs
+         << ", \"speedup\": " << legacyNs / (std::max)(flatNs, 1e-9) << ",\n";
+    json << "    \"legacyBlendNsPerPose\": " << legacyBlendNs << ", \"flatBlendNsPerPose\": " << flatBlendNs
+         << ", \"blendSpeedup\": " << legacyBlendNs / (std::max)(flatBlendNs, 1e-9) << ",\n";
+    json << "    \"maxPaletteError\": " << error << ",\n";
+    json << "    \"compressed\": {\"nsPerPose\": " << compressedNs << ", \"floatNsPerPose\": " << referenceNs
+         << ", \"rawBytes\": " << report.rawBytes << ", \"compressedBytes\": " << report.compressedBytes
+         << ", \"rawKeys\": " << report.rawKeys << ", \"keptKeys\": " << report.keptKeys
+         << ", \"maxPositionError\": " << report.maxPositionError << ", \"maxRotationError\": " << report.maxRotationError
+         << ", \"maxPaletteError\": " << compressedError << "}\n  }\n";
+}
+
+// ---------------------------------------------------------------------------
+// Scene parse benchmark (--parse): tokenizing only, no entities are created
+// ---------------------------------------------------------------------------
+
+static void RunParseBenchmark(const BenchOptions &options, std::ostream &json)
+{
+    const std::string path = FileSystem::getPath(options.scene);
+    const int repeats = (std::max)(options.parseRepeats, 1);
+    // Both passes sum what they read, so the totals double as a check that they agree
+    double streamSum = 0.0, tokenSum = 0.0;
+    size_t lineCount = 0, commandCount = 0;
+
+    // What SceneLoader did before the tokenizer: getline, a stream per line, a map of handlers
+    auto streamStart = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < repeats; ++r)
+    {
+        std::unordered_map<std::string, std::function<void(std::stringstream &)>> dispatchMap;
+        dispatchMap["TRANSFORM"] = [&](std::stringstream &ss)
+        {
+            float value;
+            for (int i = 0; i < 9 && ss >> value; ++i)
+                streamSum += value;
+        };
+        auto drain = [&](std::stringstream &ss)
+        {
+            std::string word;
+            while (ss >> word)
+                streamSum += static_cast<double>(word.size());
+        };
+#define AXIS_BENCH_STREAM_COMMAND(name) dispatchMap.try_emplace(#name, drain);
+        AXIS_SCENE_COMMANDS(AXIS_BENCH_STREAM_COMMAND)
+#undef AXIS_BENCH_STREAM_COMMAND
+
+        std::ifstream file(path);
+        std::string line;
+        while (std::getline(file, line))
+        {
+            if (line.empty() || line[0] == '#')
+                continue;
+            std::stringstream ss(line);
+            std::string command;
+            ss >> command;
+            auto it = dispatchMap.find(command);
+            if (it != dispatchMap.end())
+                it->second(ss);
+        }
+    }
+    double streamMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - streamStart).count() / repeats;
+
+    auto tokenStart = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < repeats; ++r)
+    {
+        MappedFile file;
+        if (!file.Open(path))
+        {
+            LOGGER_ERROR("AxisBench") << "Could not open scene file: " << path;
+            return;
+        }
+
+        SceneLineReader lines(file.View());
+        std::string_view line;
+        lineCount = commandCount = 0;
+        while (lines.NextLine(line))
+        {
+            ++lineCount;
+            if (line.empty() || line[0] == '#')
+                continue;
+            SceneTokens tokens(line);
+            SceneCommand command = LookupSceneCommand(tokens.Next());
+            if (command == SceneCommand::Unknown)
+                continue;
+
+            ++commandCount;
+            if (command == SceneCommand::TRANSFORM)
+            {
+                float value;
+                for (int i = 0; i < 9 && tokens.Next(value); ++i)
+                    tokenSum += value;
+                continue;
+            }
+            for (std::string_view word = tokens.Next(); !word.empty(); word = tokens.Next())
+                tokenSum += static_cast<double>(word.size());
+        }
+    }
+    double tokenMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - tokenStart).count() / repeats;
+
+    json << "  \"parse\": {\"scene\": \"" << JsonEscape(options.scene) << "\", \"repeats\": " << repeats
+         << ", \"lines\": " << lineCount << ", \"commands\": " << commandCount << ",\n";
+    if (!options.label.empty())
+        json << "    \"label\": \"" << JsonEscape(options.label) << "\",\n";
+    json << "    \"streamMs\": " << streamMs << ", \"tokenizerMs\": " << tokenMs
+         << ", \"speedup\": " << streamMs / (std::max)(tokenMs, 1e-9)
+         << ", \"valuesMatch\": " << (streamSum == tokenSum ? "true" : "false") << "}\n";
+}
+
+// ---------------------------------------------------------------------------
+// Regression checks (--check): small deterministic scenarios on a bare Scene, no GL
+// ---------------------------------------------------------------------------
+
+static int g_CheckFailures = 0;
+
+static void Expect(bool condition, const char *what)
+{
+    std::cout << (condition ? "  ok    " : "  FAIL  ") << what << "\n";
+    if (!condition)
+        ++g_CheckFailures;
+}
+
+static void CheckNameIndexDuplicates()
+{
+    std::cout << "SceneNameIndex\n";
+    Scene scene;
+    entt::entity first = scene.createEntity();
+    entt::entity second = scene.createEntity();
+    entt::entity third = scene.createEntity();
+    for (entt::entity entity : {first, second, third})
+        scene.registry.emplace<InfoComponent>(entity, "Crate", "Prop");
+
+    Expect(scene.FindByName("Crate") == third, "duplicate names resolve to the newest entity");
+
+    scene.destroyEntity(second);
+    const auto &crates = scene.GetNameIndex().FindAllByName("Crate");
+    Expect(crates.size() == 2 && crates[0] == first && crates[1] == third, "removal keeps the remaining entities in creation order");
+    Expect(scene.FindByName("Crate") == third, "removing an older duplicate keeps the newest");
+
+    scene.destroyEntity(third);
+    Expect(scene.FindByName("Crate") == first, "removing the newest falls back to the next newest");
+}
+
+static bool MovedExactly(const TransformSystem &transforms, std::vector<entt::entity> expected)
+{
+    std::vector<entt::entity> moved = transforms.GetMovedEntities();
+    std::sort(moved.begin(), moved.end());
+    std::sort(expected.begin(), expected.end());
+    return moved == expected;
+}
+
+static void CheckTransformRebuildMoved()
+{
+    std::cout << "TransformSystem\n";
+    Scene scene;
+    TransformSystem transforms;
+
+    std::vector<entt::entity> roots;
+    for (int i = 0; i < 8; ++i)
+    {
+        entt::entity entity = scene.createEntity();
+        scene.registry.get<TransformComponent>(entity).position = glm::vec3(static_cast<float>(i), 0.0f, 0.0f);
+        roots.push_back(entity);
+    }
+    entt::entity child = scene.createEntity();
+    scene.registry.get<TransformComponent>(child).SetParent(child, roots[0], scene.registry);
+
+    transforms.Update(scene);
+    transforms.ClearMoved();
+    transforms.Update(scene);
+    Expect(transforms.GetMovedEntities().empty(), "an idle pass moves nothing");
+
+    entt::entity spawned = scene.createEntity();
+    scene.registry.get<TransformComponent>(spawned).position = glm::vec3(0.0f, 5.0f, 0.0f);
+    transforms.Update(scene);
+    Expect(MovedExactly(transforms, {spawned}), "spawning one entity moves only that entity");
+    transforms.ClearMoved();
+
+    scene.registry.get<TransformComponent>(roots[1]).SetParent(roots[1], roots[2], scene.registry);
+    transforms.Update(scene);
+    Expect(MovedExactly(transforms, {roots[1]}), "reparenting moves only the reparented entity");
+    transforms.ClearMoved();
+
+    scene.destroyEntity(roots[3]);
+    transforms.Update(scene);
+    Expect(transforms.GetMovedEntities().empty(), "destroying an entity moves nothing else");
+
+    scene.registry.get<TransformComponent>(roots[0]).position.y = 1.0f;
+    transforms.Update(scene);
+    Expect(MovedExactly(transforms, {roots[0], child}), "moving a parent moves its subtree");
+}
+
+static void CheckRaycastOnBoxFace()
+{
+    std::cout << "Scene::Raycast\n";
+    Scene scene;
+    entt::entity box = scene.createEntity();
+    const glm::vec3 min(0.0f), max(1.0f);
+    scene.registry.emplace<WorldBoundsComponent>(box, min, max);
+    scene.GetSpatialTree().CreateProxy(min, max, box);
+
+    SceneRaycastHit hit;
+    bool alongFace = scene.Raycast(glm::vec3(0.0f, 0.5f, -2.0f), glm::vec3(0.0f, 0.0f, 1.0f), 10.0f, hit);
+    Expect(alongFace && hit.entity == box && std::abs(hit.distance - 2.0f) < 1e-5f, "axis-aligned ray in the plane of a face hits");
+
+    bool fromFace = scene.Raycast(glm::vec3(0.0f, 0.5f, 0.5f), glm::vec3(0.0f, 1.0f, 0.0f), 10.0f, hit);
+    Expect(fromFace && hit.entity == box && hit.distance == 0.0f, "axis-aligned ray starting on a face hits at 0");
+
+    bool outside = scene.Raycast(glm::vec3(-0.01f, 0.5f, -2.0f), glm::vec3(0.0f, 0.0f, 1.0f), 10.0f, hit);
+    Expect(!outside, "parallel ray just outside a face misses");
+}
+
+static int RunChecks()
+{
+    CheckNameIndexDuplicates();
+    CheckTransformRebuildMoved();
+    CheckRaycastOnBoxFace();
+
+    std::cout << (g_CheckFailures ? "FAILED: " : "passed, failures: ") << g_CheckFailures << "\n";
+    return g_CheckFailures ? 1 : 0;
+}
+
+static std::vector<int> ParseList(const std::string &text)
+{
+    std::vector<int> values;
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, ','))
+    {
+        if (!item.empty())
+            values.push_back(std::atoi(item.c_str()));
+    }
+    return values;
+}
+
+static int WriteResults(const BenchOptions &options, const std::string &json)
+{
+    if (options.out.empty())
+    {
+        std::cout << json;
+    }
+    else
+    {
+        std::ofstream file(options.out, std::ios::trunc);
+        file << json;
+        LOGGER_INFO("AxisBench") << "Results written to " << options.out;
+    }
+    return 0;
+}
+
+static void PrintUsage()
+{
+    std::cout << "Usage: axis_bench [options]\n"
+              << "  --scene <path>        Scene to benchmark (default: scenes/game(rigid).scene)\n"
+              << "  --entities <n>        Generate a seeded scene with n dummies instead of --scene\n"
+              << "  --sweep <a,b,c>       Generate and run one scene per entity count\n"
+              << "  --seed <n>            Seed for generated scenes (default: 1337)\n"
+              << "  --no-physics          Generated dummies have no rigid bodies\n"
+              << "  --parallel-physics    Step btDiscreteDynamicsWorldMt on the engine thread pool\n"
+              << "  --pipelined-physics   Overlap each physics step with the rest of the frame\n"
+              << "  --frames <n>          Measured frames (default: 600)\n"
+              << "  --warmup <n>          Unmeasured frames before measuring (default: 60)\n"
+              << "  --dt <seconds>        Fixed frame delta (default: 1/60)\n"
+              << "  --label <text>        Tag copied into every run (e.g. a commit hash)\n"
+              << "  --out <file>          Write JSON to file instead of stdout\n"
+              << "  --trace <file>        Chrome trace of the measured frames (needs AXIS_ENABLE_PROFILER)\n"
+              << "  --skeleton <bones>    Compare the recursive and flat pose passes on a synthetic rig (no scene)\n"
+              << "  --parse <repeats>     Time tokenizing --scene with the old stream parser and the mapped tokenizer\n"
+              << "  --check               Run the regression checks (no scene, no GL); exit code 1 on failure\n";
+}
+
+int main(int argc, char **argv)
+{
+    BenchOptions options;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        auto next = [&]() -> std::string
+        { return (i + 1 < argc) ? argv[++i] : ""; };
+
+        if (arg == "--scene")
+            options.scene = next();
+        else if (arg == "--entities")
+            options.sweep = {std::atoi(next().c_str())};
+        else if (arg == "--sweep")
+            options.sweep = ParseList(next());
+        else if (arg == "--seed")
+            options.seed = static_cast<uint32_t>(std::strtoul(next().c_str(), nullptr, 10));
+        else if (arg == "--skeleton")
+            options.skeletonBones = std::atoi(next().c_str());
+        else if (arg == "--parse")
+            options.parseRepeats = std::atoi(next().c_str());
+        else if (arg == "--check")
+            options.checks = true;
+        else if (arg == "--no-physics")
+            options.physics = false;
+        else if (arg == "--parallel-physics")
+            options.parallelPhysics = true;
+        else if (arg == "--pipelined-physics")
+            options.pipelinedPhysics = true;
+        else if (arg == "--frames")
+            options.frames = std::atoi(next().c_str());
+        else if (arg == "--warmup")
+            options.warmup = std::atoi(next().c_str());
+        else if (arg == "--dt")
+            options.fixedDt = std::strtof(next().c_str(), nullptr);
+        else if (arg == "--label")
+            options.label = next();
+        else if (arg == "--out")
+            options.out = next();
+        else if (arg == "--trace")
+            options.trace = next();
+        else if (arg == "--help" || arg == "-h")
+        {
+            PrintUsage();
+            return 0;
+        }
+        else
+        {
+            std::cerr << "Unknown argument: " << arg << "\n";
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    AXIS_PROFILE_THREAD("Main");
+
+    if (options.checks)
+        return RunChecks();
+
+    std::ostringstream json;
+    json << std::fixed << std::setprecision(4);
+
+    if (options.skeletonBones > 0)
+    {
+        json << "{\n";
+        RunSkeletonBenchmark(options, json);
+        json << "}\n";
+        return WriteResults(options, json.str());
+    }
+
+    if (options.parseRepeats > 0)
+    {
+        json << "{\n";
+        RunParseBenchmark(options, json);
+        json << "}\n";
+        return WriteResults(options, json.str());
+    }
+
+    char headlessArg[] = "--headless";
+    char *appArgs[] = {argv[0], headlessArg};
+
+    Application app;
+    if (!app.Init(2, appArgs))
+    {
+        std::cerr << "Failed to initialize application\n";
+        return 1;
+    }
+
+    json << "{\n  \"runs\": [\n";
+
+    if (options.sweep.empty())
+    {
+        RunBenchmark(app, options.scene, 0, options, json);
+        json << "\n";
+    }
+    else
+    {
+        for (size_t i = 0; i < options.sweep.size(); ++i)
+        {
+            int count = options.sweep[i];
+            std::string path = GenerateScene(count, options.seed, options.physics);
+            RunBenchmark(app, path, count, options, json);
+            json << (i + 1 < options.sweep.size() ? ",\n" : "\n");
+        }
+    }
+
+    json << "  ]\n}\n";
+
+    return WriteResults(options, json.str());
+}
@@ -0,0 +1,74 @@
+// scene_cook: compiles text scenes into the binary layout SceneLoader maps directly.
+//
+// Each input is written next to itself with the .scenec extension unless --out is given (single
+// input only). SceneLoader picks the cooked file up whenever it is at least as new as the text.
+//
+//   scene_cook "scenes/game(rigid).scene"
+//   scene_cook scenes/game.scene --out build/game.scenec
+
+#include <scene/scene_cooker.h>
+#include <utils/logger.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+static void PrintUsage()
+{
+    std::cout << "Usage: scene_cook <scene>... [options]\n"
+              << "  --out <file>   Output path (one input only; default: <scene> with .scenec)\n";
+}
+
+int main(int argc, char **argv)
+{
+    std::vector<std::string> inputs;
+    std::string out;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--out")
+            out = (i + 1 < argc) ? argv[++i] : "";
+        else if (arg == "--help" || arg == "-h")
+        {
+            PrintUsage();
+            return 0;
+        }
+        else if (!arg.empty() && arg[0] == '-')
+        {
+            std::cerr << "Unknown argument: " << arg << "\n";
+            PrintUsage();
+            return 1;
+        }
+        else
+            inputs.push_back(arg);
+    }
+
+    if (inputs.empty() || (!out.empty() && inputs.size() > 1))
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    int failures = 0;
+    for (const std::string &input : inputs)
+    {
+        std::string output = out.empty() ? SceneCooker::GetCookedPath(input) : out;
+
+        auto start = std::chrono::high_resolution_clock::now();
+        SceneCookStats stats;
+        if (!SceneCooker::Cook(input, output, &stats))
+        {
+            ++failures;
+            continue;
+        }
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+        LOGGER_INFO("SceneCook") << input << " -> " << output << " (" << stats.bytes << " bytes, " << ms << " ms): "
+                                 << stats.entities << " entities, " << stats.transforms << " transforms, "
+                                 << stats.renderers << " renderers, " << stats.materials << " materials, "
+                                 << stats.bodies << " bodies, " << stats.commands << " text commands, "
+                                 << stats.strings << " strings";
+    }
+    return failures == 0 ? 0 : 1;
+}